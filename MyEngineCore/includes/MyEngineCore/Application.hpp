@@ -4,6 +4,8 @@
 #include "MyEngineCore/Event.hpp"
 #include "MyEngineCore/Camera.hpp"
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 
 namespace MyEngine {
@@ -11,6 +13,16 @@ namespace MyEngine {
 	//  
 	class Application {
 	public:
+		//  :  ( ),  (G-   )  
+		// (  CPU,    ).          OpenGL,
+		//    GPU    start  render_software
+
+		enum class RenderPath {
+			Forward,
+			Deferred,
+			Software
+		};
+
 		//   
 		Application();
 		virtual ~Application();
@@ -24,6 +36,10 @@ namespace MyEngine {
 		// ,     (  )  
 		virtual int start(unsigned int window_width, unsigned int window_height, const char* title);
 
+		//    , GLFW  OpenGL: frames_count     CPU   
+		// (   on_update),     output_path (TGA).   -   start
+		int render_software(unsigned int width, unsigned int height, const char* output_path, unsigned int frames_count = 1);
+
 		//    
 		void close();
 
@@ -49,16 +65,65 @@ namespace MyEngine {
 		float diffuse_factor = 1.0f;
 		float specular_factor = 0.5f;
 		float shininess = 32.f;
+		//     ( )
+		int point_lights_count = 256;
+		RenderPath render_path = RenderPath::Forward;
+		//      (      )
+		bool depth_prepass = false;
+		//  :        
+		bool overdraw_visualization = false;
+		//   ():     ,   
+		float sun_direction[3] = { -0.4f, -0.3f, -1.f };
+		float sun_color[3] = { 1.f, 0.95f, 0.85f };
+		float sun_intensity = 0.5f;
+		//         
+		bool shadows_enabled = true;
+		int shadow_updates_per_frame = 8;
+		//  :   GPU  ,      
+		bool dynamic_resolution = false;
+		float dynamic_resolution_target_ms = 8.f;
+		float dynamic_resolution_min_scale = 0.5f;
+		float upscale_sharpness = 0.3f;
+		//       GPU (0 - )        
+		int gpu_culled_instances_count = 0;
+		bool gpu_occlusion_culling = true;
+		//    (0 -   )
+		int software_threads_count = 0;
+		//      BC1   ( 6   RGB8,    ).
+		//   ,        BC1  
+		bool compress_color_textures_bc1 = false;
 
 	private:
+		//      ( )
+		int run();
 		void draw();
+		//    ,     ( )
+		size_t update_point_lights();
+		//     (lights_count - ,  )
+		void draw_scene(const RenderPath path, const size_t lights_count);
+		//  :   indirect   GPU,      
+		void draw_gpu_culled_instances();
+		//    ( )
+		struct DirectionalLight get_sun() const;
+		//   GPU        
+		void run_render_path_benchmark();
+		void on_render_path_ui_draw();
+		//  :      CPU,   CPU,      ,
+		//    OpenGL       
+		void submit_software_scene(const size_t lights_count);
+		void render_software_frame(const size_t lights_count);
+		void draw_software_scene(const size_t lights_count);
+		void run_software_comparison(const size_t lights_count);
+		void run_software_scaling_benchmark(const size_t lights_count);
+		//     
+		void process_events();
 
 		//     
 		std::unique_ptr<class Window> m_pWindow;
 
-		//       
+		//        (  )
 		EventDispatcher m_event_dispatcher;
-		bool m_bCloseWindow = false;
+		std::atomic<bool> m_bCloseWindow{ false };
 	};
 
 }
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
 
+#include <array>
+
 namespace MyEngine {
 
     class Camera {
@@ -29,10 +32,20 @@ namespace MyEngine {
         void set_field_of_view(const float fov);
         const glm::mat4& get_view_matrix();
         const glm::mat4& get_projection_matrix() const { return m_projection_matrix; }
+        //    :    ,     
+        const glm::mat4& get_view_projection_matrix();
+        //       (xyz -  , w - ;  ):
+        // , , , , , 
+        std::array<glm::vec4, 6> get_frustum_planes();
+        //          (   ..)
+        static std::array<glm::vec4, 6> get_frustum_planes(const glm::mat4& view_projection);
         //    ( ,   )
         const float get_far_clip_plane() const { return m_far_clip_plane; }
         const float get_near_clip_plane() const { return m_near_clip_plane; }
         const float get_field_of_view() const { return m_field_of_view; }
+        const float get_viewport_width() const { return m_viewport_width; }
+        const float get_viewport_height() const { return m_viewport_height; }
+        const ProjectionMode get_projection_mode() const { return m_projection_mode; }
 
         //  ,   
         void move_forward(const float delta);
@@ -78,6 +91,7 @@ namespace MyEngine {
         //    ,  
         glm::mat4 m_view_matrix;
         glm::mat4 m_projection_matrix;
+        glm::mat4 m_view_projection_matrix;
         bool m_update_view_matrix = false;
     };
 }
\ No newline at end of file
@@ -4,8 +4,12 @@
 
 #include "Keys.hpp"
 
-#include <functional>
 #include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <variant>
+#include <vector>
 
 namespace MyEngine {
 	
@@ -13,8 +17,12 @@ namespace MyEngine {
 
 		//  
 		WindowResize = 0,
+		//     ( )
+		FramebufferResize,
 		//  
 		WindowClose,
+		//     
+		WindowFocus,
 
 		//  
 		KeyPressed,
@@ -27,55 +35,24 @@ namespace MyEngine {
 		MouseButtonReleased,
 		//  
 		MouseMoved,
+		//  
+		MouseScrolled,
+		//        
+		CursorEnter,
+
+		//  
+		CharTyped,
 
 		//   
 		EventsCount
 	};
 
-	//  
-	struct BaseEvent {
-		virtual ~BaseEvent() = default;
-		virtual EventType get_type() const = 0;
-	};
-
-	//   
-	class EventDispatcher{
-	public:
-		template<typename EventType>
-		//  
-		void add_event_listener(std::function<void(EventType&)> callback){
-			//   
-			auto baseCallback = [func = std::move(callback)](BaseEvent& e){
-					if (e.get_type() == EventType::type){
-						func(static_cast<EventType&>(e));
-					}
-				};
-			m_eventCallbacks[static_cast<size_t>(EventType::type)] = std::move(baseCallback);
-		}
-
-		//  
-		void dispatch(BaseEvent& event){
-			auto& callback = m_eventCallbacks[static_cast<size_t>(event.get_type())];
-			if (callback){
-				callback(event);
-			}
-		}
-
-	private:
-		//   ,  
-		std::array<std::function<void(BaseEvent&)>, static_cast<size_t>(EventType::EventsCount)> m_eventCallbacks;
-	};
-
 	//    " "
-	struct EventMouseMoved : public BaseEvent {
-		//  
+	struct EventMouseMoved {
+		// 
+		EventMouseMoved() = default;
 		EventMouseMoved(const double new_x, const double new_y): x(new_x), y(new_y) {}
 
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
-
 		//   
 		double x;
 		double y;
@@ -85,15 +62,11 @@ namespace MyEngine {
 	};
 
 	//    " "
-	struct EventWindowResize : public BaseEvent {
-		// 
+	struct EventWindowResize {
+		// 
+		EventWindowResize() = default;
 		EventWindowResize(const unsigned int new_width, const unsigned int new_heigth) : width(new_width), height(new_heigth) {}
 
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
-
 		//   
 		unsigned int width;
 		unsigned int height;
@@ -102,90 +75,244 @@ namespace MyEngine {
 		static const EventType type = EventType::WindowResize;
 	};
 
-	//    " "
-	struct EventWindowClose : public BaseEvent {
+	//    "   "
+	struct EventFramebufferResize {
+		// 
+		EventFramebufferResize() = default;
+		EventFramebufferResize(const unsigned int new_width, const unsigned int new_height) : width(new_width), height(new_height) {}
 
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
+		//    (        )
+		unsigned int width;
+		unsigned int height;
 
+		//  
+		static const EventType type = EventType::FramebufferResize;
+	};
+
+	//    " "
+	struct EventWindowClose {
 		//  
 		static const EventType type = EventType::WindowClose;
 	};
 
-	//     
-	struct EventKeyPressed : public BaseEvent {
-		//     
-		EventKeyPressed(const KeyCode key_code, const bool repeated) : key_code(key_code), repeated(repeated) {}
+	//    " "
+	struct EventWindowFocus {
+		// 
+		EventWindowFocus() = default;
+		EventWindowFocus(const bool focused) : focused(focused) {}
 
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
+		//    (false - )
+		bool focused;
+
+		//  
+		static const EventType type = EventType::WindowFocus;
+	};
+
+	//     
+	struct EventKeyPressed {
+		//     
+		EventKeyPressed() = default;
+		EventKeyPressed(const KeyCode key_code, const bool repeated, const int mods = 0) : key_code(key_code), repeated(repeated), mods(mods) {}
 
-		//      
+		//  ,      ( s_mod_*)   
 		KeyCode key_code;
 		bool repeated;
+		int mods;
 
 		//  
 		static const EventType type = EventType::KeyPressed;
 	};
 
 	//     
-	struct EventKeyReleased : public BaseEvent {
-		//     
-		EventKeyReleased(const KeyCode key_code) : key_code(key_code) {}
-
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
+	struct EventKeyReleased {
+		//     
+		EventKeyReleased() = default;
+		EventKeyReleased(const KeyCode key_code, const int mods = 0) : key_code(key_code), mods(mods) {}
 
-		//  
+		//    
 		KeyCode key_code;
+		int mods;
 
 		//  
 		static const EventType type = EventType::KeyReleased;
 	};
 
 	//     
-	struct EventMouseButtonPressed : public BaseEvent {
-		//     
-		EventMouseButtonPressed(const MouseButton mouse_button, const double x_pos, const double y_pos)
-			: mouse_button(mouse_button), x_pos(x_pos), y_pos(y_pos) {}
-
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
+	struct EventMouseButtonPressed {
+		//     
+		EventMouseButtonPressed() = default;
+		EventMouseButtonPressed(const MouseButton mouse_button, const double x_pos, const double y_pos, const int mods = 0)
+			: mouse_button(mouse_button), x_pos(x_pos), y_pos(y_pos), mods(mods) {}
 
-		//      x  y
+		//  ,   x  y  
 		MouseButton mouse_button;
 		double x_pos;
 		double y_pos;
+		int mods;
 
 		//  
 		static const EventType type = EventType::MouseButtonPressed;
 	};
 
 	//     
-	struct EventMouseButtonReleased : public BaseEvent {
-		//     
-		EventMouseButtonReleased(const MouseButton mouse_button, const double x_pos, const double y_pos)
-			: mouse_button(mouse_button), x_pos(x_pos), y_pos(y_pos) {}
-
-		//   
-		virtual EventType get_type() const override {
-			return type;
-		}
+	struct EventMouseButtonReleased {
+		//     
+		EventMouseButtonReleased() = default;
+		EventMouseButtonReleased(const MouseButton mouse_button, const double x_pos, const double y_pos, const int mods = 0)
+			: mouse_button(mouse_button), x_pos(x_pos), y_pos(y_pos), mods(mods) {}
 
-		//      x  y
+		//  ,   x  y  
 		MouseButton mouse_button;
 		double x_pos;
 		double y_pos;
+		int mods;
 
 		//  
 		static const EventType type = EventType::MouseButtonReleased;
 	};
+
+	//      
+	struct EventMouseScrolled {
+		// 
+		EventMouseScrolled() = default;
+		EventMouseScrolled(const double x_offset, const double y_offset) : x_offset(x_offset), y_offset(y_offset) {}
+
+		//   x  y
+		double x_offset;
+		double y_offset;
+
+		//  
+		static const EventType type = EventType::MouseScrolled;
+	};
+
+	//    "   "
+	struct EventCursorEnter {
+		// 
+		EventCursorEnter() = default;
+		EventCursorEnter(const bool entered) : entered(entered) {}
+
+		//     (false - )
+		bool entered;
+
+		//  
+		static const EventType type = EventType::CursorEnter;
+	};
+
+	//      (  )
+	struct EventCharTyped {
+		// 
+		EventCharTyped() = default;
+		EventCharTyped(const unsigned int codepoint) : codepoint(codepoint) {}
+
+		//   Unicode
+		unsigned int codepoint;
+
+		//  
+		static const EventType type = EventType::CharTyped;
+	};
+
+	//    (   )
+	inline bool is_input_event(const EventType type) {
+		return type == EventType::KeyPressed || type == EventType::KeyReleased || type == EventType::MouseButtonPressed
+			|| type == EventType::MouseButtonReleased || type == EventType::MouseMoved || type == EventType::MouseScrolled
+			|| type == EventType::CharTyped;
+	}
+
+	//      (,  )
+	inline uint64_t get_event_timestamp() {
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	//   : ,       (  ,   )
+	struct Event {
+		Event() = default;
+		template<typename T>
+		Event(const T& event, const uint64_t timestamp = 0) : type(T::type), timestamp(timestamp), data(event) {}
+
+		template<typename T>
+		T& get() { return *std::get_if<T>(&data); }
+		template<typename T>
+		const T& get() const { return *std::get_if<T>(&data); }
+
+		EventType type = EventType::EventsCount;
+		//    (get_event_timestamp),    -  
+		uint64_t timestamp = 0;
+		std::variant<EventWindowResize, EventFramebufferResize, EventWindowClose, EventWindowFocus, EventKeyPressed, EventKeyReleased,
+			EventMouseButtonPressed, EventMouseButtonReleased, EventMouseMoved, EventMouseScrolled, EventCursorEnter, EventCharTyped> data;
+	};
+
+	//     (0 -  )
+	using EventListenerId = uint32_t;
+
+	//  :      ,     
+	// (  -   ).          
+	// ,    ,       .    .
+	//     (       Window)
+	class EventDispatcher {
+	public:
+		//   
+		static constexpr size_t s_queue_size = 1024;
+
+		//  
+		struct Stats {
+			size_t events_posted = 0;
+			size_t events_coalesced = 0;
+			size_t events_dropped = 0;
+			//     dispatch_queued
+			size_t events_dispatched = 0;
+		};
+
+		//     ( - )
+		template<typename T>
+		EventListenerId add_event_listener(std::function<void(T&)> callback, const int priority = 0) {
+			return add_listener(T::type, priority, [func = std::move(callback)](Event& event) {
+				func(event.get<T>());
+			});
+		}
+		//   (   )
+		void remove_event_listener(const EventListenerId id);
+
+		//    
+		void post(const Event& event);
+		//    
+		void dispatch(Event& event);
+		//     ,     
+		void dispatch_queued();
+
+		const Stats& get_stats() const { return m_stats; }
+
+	private:
+		//  
+		struct Listener {
+			EventListenerId id = 0;
+			int priority = 0;
+			//  (,    :     )
+			bool removed = false;
+			std::function<void(Event&)> callback;
+		};
+
+		EventListenerId add_listener(const EventType type, const int priority, std::function<void(Event&)> callback);
+		//       
+		void insert_listener(const EventType type, Listener listener);
+		//         
+		void apply_pending_changes();
+
+		//    
+		std::array<std::vector<Listener>, static_cast<size_t>(EventType::EventsCount)> m_listeners;
+		// ,     (  )
+		std::vector<std::pair<EventType, Listener>> m_pending_listeners;
+		EventListenerId m_next_listener_id = 1;
+		bool m_has_removed_listeners = false;
+		//    dispatch
+		uint32_t m_dispatch_depth = 0;
+
+		//    (  ,  -   )
+		std::array<Event, s_queue_size> m_queue;
+		size_t m_read_index = 0;
+		size_t m_write_index = 0;
+		bool m_draining = false;
+
+		Stats m_stats;
+	};
 }
\ No newline at end of file
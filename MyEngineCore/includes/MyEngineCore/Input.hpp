@@ -2,24 +2,64 @@
 
 #include "Keys.hpp"
 
+#include <bitset>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
 namespace MyEngine {
 
-    //  
+    //    :  ,       ()   .
+    //        :   ,   
+    struct InputSnapshot {
+        static constexpr size_t s_keys_count = static_cast<size_t>(KeyCode::KEY_LAST) + 1;
+        static constexpr size_t s_mouse_buttons_count = static_cast<size_t>(MouseButton::MOUSE_BUTTON_LAST) + 1;
+
+        std::bitset<s_keys_count> keys_down;
+        std::bitset<s_keys_count> keys_pressed;
+        std::bitset<s_keys_count> keys_released;
+        std::bitset<s_mouse_buttons_count> mouse_buttons_down;
+        std::bitset<s_mouse_buttons_count> mouse_buttons_pressed;
+        std::bitset<s_mouse_buttons_count> mouse_buttons_released;
+        glm::vec2 mouse_position{ 0.f, 0.f };
+        //    ,    (get_event_timestamp)
+        uint64_t timestamp = 0;
+        //        (0 -   ),     
+        uint64_t first_input_timestamp = 0;
+        //  
+        uint64_t frame = 0;
+    };
+
+    //  .     , NewFrame    ,
+    //      .      
     class Input {
     public:
-        //       (  )
+        //   ,         (  )
         static bool IsKeyPressed(const KeyCode key_code);
+        static bool IsKeyJustPressed(const KeyCode key_code);
+        static bool IsKeyJustReleased(const KeyCode key_code);
         static void PressKey(const KeyCode key_code);
         static void ReleaseKey(const KeyCode key_code);
 
-        //       (  )
+        //   ,         (  )
         static bool IsMouseButtonPressed(const MouseButton mouse_button);
+        static bool IsMouseButtonJustPressed(const MouseButton mouse_button);
+        static bool IsMouseButtonJustReleased(const MouseButton mouse_button);
         static void PressMouseButton(const MouseButton mouse_button);
         static void ReleaseMouseButton(const MouseButton mouse_button);
 
+        //  
+        static glm::vec2 GetMousePosition();
+        static void MoveMouse(const double x_pos, const double y_pos);
+
+        //   
+        static const InputSnapshot& GetSnapshot();
+        //         (  ,   ).
+        // timestamp -      , first_input_timestamp -    (0 -   )
+        static void NewFrame(const uint64_t timestamp = 0, const uint64_t first_input_timestamp = 0);
+
     private:
-        //    
-        static bool m_keys_pressed[];
-        static bool m_mouse_buttons_pressed[];
+        //     
+        static InputSnapshot m_snapshot;
+        static InputSnapshot m_pending;
     };
 }
\ No newline at end of file
@@ -133,6 +133,12 @@ namespace MyEngine {
         KEY_LAST = KEY_MENU
     };
 
+    //  -      ( GLFW_MOD_*)
+    constexpr int s_mod_shift = 0x1;
+    constexpr int s_mod_control = 0x2;
+    constexpr int s_mod_alt = 0x4;
+    constexpr int s_mod_super = 0x8;
+
     //       (  openGL)
     enum class MouseButton {
         MOUSE_BUTTON_1 = 0,
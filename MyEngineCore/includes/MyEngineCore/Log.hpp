@@ -2,22 +2,270 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 namespace MyEngine {
 
-#ifdef NDEBUG
+    //  
+    enum class ELogLevel : uint8_t {
+        Trace,
+        Info,
+        Warn,
+        Error,
+        Critical,
+        Off
+    };
+
+    //  :     
+    enum class ELogCategory : uint8_t {
+        Core,
+        Render,
+        Resources,
+        Input,
+        Jobs,
+        Count
+    };
+
+    //      (0 - Trace ... 5 - Off),  -DMYENGINE_LOG_LEVEL_INPUT=0.
+    //     Info,    ,   ,  Critical.       
+#ifndef MYENGINE_LOG_LEVEL_DEFAULT
+    #ifdef NDEBUG
+        #define MYENGINE_LOG_LEVEL_DEFAULT 5
+    #else
+        #define MYENGINE_LOG_LEVEL_DEFAULT 1
+    #endif
+#endif
+#ifndef MYENGINE_LOG_LEVEL_CORE
+    #define MYENGINE_LOG_LEVEL_CORE MYENGINE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef MYENGINE_LOG_LEVEL_RENDER
+    #define MYENGINE_LOG_LEVEL_RENDER MYENGINE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef MYENGINE_LOG_LEVEL_RESOURCES
+    #define MYENGINE_LOG_LEVEL_RESOURCES MYENGINE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef MYENGINE_LOG_LEVEL_INPUT
+    #define MYENGINE_LOG_LEVEL_INPUT MYENGINE_LOG_LEVEL_DEFAULT
+#endif
+#ifndef MYENGINE_LOG_LEVEL_JOBS
+    #define MYENGINE_LOG_LEVEL_JOBS MYENGINE_LOG_LEVEL_DEFAULT
+#endif
+
+    constexpr ELogLevel get_min_log_level(const ELogCategory category) {
+        switch (category) {
+        case ELogCategory::Render: return static_cast<ELogLevel>(MYENGINE_LOG_LEVEL_RENDER);
+        case ELogCategory::Resources: return static_cast<ELogLevel>(MYENGINE_LOG_LEVEL_RESOURCES);
+        case ELogCategory::Input: return static_cast<ELogLevel>(MYENGINE_LOG_LEVEL_INPUT);
+        case ELogCategory::Jobs: return static_cast<ELogLevel>(MYENGINE_LOG_LEVEL_JOBS);
+        default: return static_cast<ELogLevel>(MYENGINE_LOG_LEVEL_CORE);
+        }
+    }
 
-#define LOG_INFO(...)		
-#define LOG_WARN(...)		
-#define LOG_ERROR(...)		
-#define LOG_CRITICAL(...)  
+    // Critical  ,     :     
+    constexpr bool is_log_enabled(const ELogCategory category, const ELogLevel level) {
+        return level == ELogLevel::Critical || (level != ELogLevel::Off && level >= get_min_log_level(category));
+    }
 
-#else
+    //   (   ): ,     
+    struct LogSite {
+        ELogLevel level;
+        ELogCategory category;
+        const char* file;
+        int line;
+        //    (),        
+        std::atomic<int64_t> window_start{ 0 };
+        std::atomic<uint32_t> window_count{ 0 };
+        std::atomic<uint32_t> suppressed_count{ 0 };
+    };
 
-	#define LOG_INFO(...)		spdlog::info(__VA_ARGS__)
-	#define LOG_WARN(...)		spdlog::warn(__VA_ARGS__)
-	#define LOG_ERROR(...)		spdlog::error(__VA_ARGS__)
-	#define LOG_CRITICAL(...)   spdlog::critical(__VA_ARGS__)
+    //    : ,      (  )
+    struct LogRecordHeader {
+        //     ( 8)
+        uint32_t size;
+        uint32_t args_count;
+        uint32_t suppressed_count;
+        const LogSite* pSite;
+        const char* format;
+        //   (    system_clock)
+        int64_t time;
+    };
 
-#endif
+    //    
+    enum class ELogArgType : uint8_t {
+        Bool,
+        Char,
+        Int,
+        UInt,
+        Double,
+        Pointer,
+        String
+    };
+
+    //      :        ,
+    //   (    )  
+    template<typename T>
+    auto convert_log_arg(const T& value) {
+        using Type = std::decay_t<T>;
+        if constexpr (std::is_same_v<Type, bool> || std::is_same_v<Type, char>) {
+            return value;
+        }
+        else if constexpr (std::is_floating_point_v<Type>) {
+            return static_cast<double>(value);
+        }
+        else if constexpr (std::is_enum_v<Type>) {
+            return convert_log_arg(static_cast<std::underlying_type_t<Type>>(value));
+        }
+        else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            return static_cast<int64_t>(value);
+        }
+        else if constexpr (std::is_integral_v<Type>) {
+            return static_cast<uint64_t>(value);
+        }
+        else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+            return std::string_view(value ? value : "(null)");
+        }
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            return std::string_view(value);
+        }
+        else if constexpr (std::is_pointer_v<Type>) {
+            return static_cast<const void*>(value);
+        }
+        else {
+            return fmt::format("{}", value);
+        }
+    }
+
+    //  ,     ,      
+    template<typename... Args>
+    using LogFormatString = spdlog::format_string_t<decltype(convert_log_arg(std::declval<const Args&>()))...>;
+
+    //  .            
+    // (    ),     spdlog  .   
+    //   ,      . Critical  
+    // (,  flush):     
+    class Log {
+    public:
+        // 
+        struct Stats {
+            size_t written_count = 0;
+            size_t dropped_count = 0;
+            size_t suppressed_count = 0;
+        };
+
+        //      ,  
+        static constexpr uint32_t s_rate_limit_per_second = 20;
+        //    
+        static constexpr size_t s_max_string_length = 4096;
+
+        //   - :       
+        template<typename... Args>
+        static void write(LogSite& site, LogFormatString<Args...> format_string, const Args&... args) {
+            const char* format = spdlog::string_view_t(format_string).data();
+            const int64_t time = get_time();
+            if (site.level == ELogLevel::Critical) {
+                const auto converted = std::make_tuple(convert_log_arg(args)...);
+                write_critical(site, time, std::apply([format](const auto&... values) {
+                    return fmt::vformat(format, fmt::make_format_args(values...));
+                }, converted));
+                return;
+            }
+            uint32_t suppressed_count = 0;
+            if (!pass_rate_limit(site, time, suppressed_count)) {
+                return;
+            }
+            const auto converted = std::make_tuple(convert_log_arg(args)...);
+            const size_t size = (sizeof(LogRecordHeader) + std::apply([](const auto&... values) {
+                return (size_t(0) + ... + get_arg_size(values));
+            }, converted) + 7) & ~size_t(7);
+            unsigned char* pData = begin_record(size);
+            if (!pData) {
+                return;
+            }
+            const LogRecordHeader header{ static_cast<uint32_t>(size), static_cast<uint32_t>(sizeof...(Args)), suppressed_count, &site, format, time };
+            std::memcpy(pData, &header, sizeof(header));
+            unsigned char* pArgs = pData + sizeof(header);
+            std::apply([&pArgs](const auto&... values) { (write_arg(pArgs, values), ...); }, converted);
+            end_record();
+        }
+
+        //    ,   
+        static void flush();
+        //        (  write   )
+        static void shutdown();
+        static Stats get_stats();
+
+    private:
+        static int64_t get_time();
+        static bool pass_rate_limit(LogSite& site, const int64_t time, uint32_t& suppressed_count);
+        static void write_critical(const LogSite& site, const int64_t time, const std::string& message);
+        //        (nullptr -  ,  )   
+        static unsigned char* begin_record(const size_t size);
+        static void end_record();
+
+        template<typename T>
+        static size_t get_arg_size(const T& value) {
+            if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>) {
+                return 1 + sizeof(uint32_t) + std::min(value.size(), s_max_string_length);
+            }
+            else {
+                return 1 + sizeof(T);
+            }
+        }
+
+        template<typename T>
+        static void write_arg(unsigned char*& pData, const T& value) {
+            if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>) {
+                const uint32_t length = static_cast<uint32_t>(std::min(value.size(), s_max_string_length));
+                *pData++ = static_cast<unsigned char>(ELogArgType::String);
+                std::memcpy(pData, &length, sizeof(length));
+                std::memcpy(pData + sizeof(length), value.data(), length);
+                pData += sizeof(length) + length;
+            }
+            else {
+                ELogArgType type = ELogArgType::Pointer;
+                if constexpr (std::is_same_v<T, bool>) { type = ELogArgType::Bool; }
+                else if constexpr (std::is_same_v<T, char>) { type = ELogArgType::Char; }
+                else if constexpr (std::is_same_v<T, int64_t>) { type = ELogArgType::Int; }
+                else if constexpr (std::is_same_v<T, uint64_t>) { type = ELogArgType::UInt; }
+                else if constexpr (std::is_same_v<T, double>) { type = ELogArgType::Double; }
+                *pData++ = static_cast<unsigned char>(type);
+                std::memcpy(pData, &value, sizeof(T));
+                pData += sizeof(T);
+            }
+        }
+    };
+
+    //     :     constexpr 
+#define MYENGINE_LOG(category, level, ...) \
+    do { \
+        if constexpr (::MyEngine::is_log_enabled(::MyEngine::ELogCategory::category, ::MyEngine::ELogLevel::level)) { \
+            ::MyEngine::Log::write([]() -> ::MyEngine::LogSite& { \
+                static ::MyEngine::LogSite s_log_site{ ::MyEngine::ELogLevel::level, ::MyEngine::ELogCategory::category, __FILE__, __LINE__ }; \
+                return s_log_site; \
+            }(), __VA_ARGS__); \
+        } \
+    } while (false)
+
+    //   Core
+    #define LOG_TRACE(...)      MYENGINE_LOG(Core, Trace, __VA_ARGS__)
+    #define LOG_INFO(...)       MYENGINE_LOG(Core, Info, __VA_ARGS__)
+    #define LOG_WARN(...)       MYENGINE_LOG(Core, Warn, __VA_ARGS__)
+    #define LOG_ERROR(...)      MYENGINE_LOG(Core, Error, __VA_ARGS__)
+    #define LOG_CRITICAL(...)   MYENGINE_LOG(Core, Critical, __VA_ARGS__)
+
+    //    (  ELogCategory: Render, Resources, Input, Jobs)
+    #define LOG_CATEGORY_TRACE(category, ...)      MYENGINE_LOG(category, Trace, __VA_ARGS__)
+    #define LOG_CATEGORY_INFO(category, ...)       MYENGINE_LOG(category, Info, __VA_ARGS__)
+    #define LOG_CATEGORY_WARN(category, ...)       MYENGINE_LOG(category, Warn, __VA_ARGS__)
+    #define LOG_CATEGORY_ERROR(category, ...)      MYENGINE_LOG(category, Error, __VA_ARGS__)
+    #define LOG_CATEGORY_CRITICAL(category, ...)   MYENGINE_LOG(category, Critical, __VA_ARGS__)
 
 }
\ No newline at end of file
@@ -9,17 +9,53 @@
 #include "MyEngineCore/Rendering/OpenGL/VertexArray.hpp"
 #include "MyEngineCore/Rendering/OpenGL/IndexBuffer.hpp"
 #include "MyEngineCore/Rendering/OpenGL/Texture_2D.hpp"
+#include "MyEngineCore/Rendering/OpenGL/TextureStreamer.hpp"
+#include "MyEngineCore/Rendering/OpenGL/StagingBuffer.hpp"
+#include "MyEngineCore/Rendering/OpenGL/LightClusters.hpp"
+#include "MyEngineCore/Rendering/OpenGL/DeferredRenderer.hpp"
+#include "MyEngineCore/Rendering/OpenGL/DynamicResolution.hpp"
+#include "MyEngineCore/Rendering/OpenGL/GpuCulling.hpp"
+#include "MyEngineCore/Rendering/OpenGL/ShadowMaps.hpp"
+#include "MyEngineCore/Rendering/OpenGL/GpuTimer.hpp"
+#include "MyEngineCore/Rendering/OpenGL/Mesh.hpp"
+#include "MyEngineCore/Rendering/OpenGL/Framebuffer.hpp"
+#include "MyEngineCore/Rendering/Software/SoftwareRenderer.hpp"
+#include "MyEngineCore/Rendering/Software/SoftwareTexture.hpp"
+#include "MyEngineCore/Resources/AssetManager.hpp"
+#include "MyEngineCore/Resources/MeshImporter.hpp"
+#include "MyEngineCore/Resources/ProceduralTexture.hpp"
+#include "MyEngineCore/Resources/TextureCompressor.hpp"
 #include "MyEngineCore/Camera.hpp"
 #include "MyEngineCore/Rendering/OpenGL/Render_OpenGL.hpp"
 #include "MyEngineCore/Modules/UIModule.hpp"
+#include "MyEngineCore/Modules/ProfilerModule.hpp"
+#include "MyEngineCore/Rendering/OpenGL/GpuMemoryTracker.hpp"
+#include "MyEngineCore/Rendering/OpenGL/LatencyTracker.hpp"
+#include "MyEngineCore/Core/JobSystem.hpp"
+#include "MyEngineCore/Core/FrameAllocator.hpp"
+#include "MyEngineCore/Core/AllocationCounter.hpp"
+#include "MyEngineCore/Core/TransformBatch.hpp"
+#include "MyEngineCore/Core/Parallel.hpp"
 
 #include <imgui/imgui.h>
 #include <glm/mat3x3.hpp>
+#include <glm/geometric.hpp>
 #include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include <glm/trigonometric.hpp>
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <numeric>
 #include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace MyEngine {
 
@@ -76,60 +112,24 @@ namespace MyEngine {
         20, 21, 22, 22, 23, 20  // bottom
     };
 
-    //   
-    void generate_circle(unsigned char* data, const unsigned int width, const unsigned int height, const unsigned int center_x,
-        const unsigned int center_y, const unsigned int radius, const unsigned char color_r, const unsigned char color_g,
-        const unsigned char color_b){
-        for (unsigned int x = 0; x < width; ++x){
-            for (unsigned int y = 0; y < height; ++y){
-                if ((x - center_x) * (x - center_x) + (y - center_y) * (y - center_y) < radius * radius){
-                    data[3 * (x + width * y) + 0] = color_r;
-                    data[3 * (x + width * y) + 1] = color_g;
-                    data[3 * (x + width * y) + 2] = color_b;
+    //       :      
+    // (   PBO   ),        
+    TextureStreamer::MipProvider create_procedural_mip_provider(ProceduralTexture (*create)(const unsigned int, const unsigned int),
+        const unsigned int width, const unsigned int height, const ETextureFormat format) {
+        return [=](const unsigned int level, unsigned char* destination, const size_t size) {
+            const ProceduralTexture procedural_texture = create(std::max(width >> level, 1u), std::max(height >> level, 1u));
+            if (format == ETextureFormat::RGB8) {
+                if (procedural_texture.get_data_size() != size) {
+                    return false;
                 }
+                procedural_texture.generate(destination);
+                return true;
             }
-        }
-    }
-
-    //   
-    void generate_smile_texture(unsigned char* data, const unsigned int width, const unsigned int height){
-        // background
-        for (unsigned int x = 0; x < width; ++x){
-            for (unsigned int y = 0; y < height; ++y){
-                data[3 * (x + width * y) + 0] = 200;
-                data[3 * (x + width * y) + 1] = 191;
-                data[3 * (x + width * y) + 2] = 231;
-            }
-        }
-
-        // face - 
-        generate_circle(data, width, height, width * 0.5, height * 0.5, width * 0.4, 255, 255, 0);
-
-        // smile - /
-        generate_circle(data, width, height, width * 0.5, height * 0.4, width * 0.2, 0, 0, 0);
-        generate_circle(data, width, height, width * 0.5, height * 0.45, width * 0.2, 255, 255, 0);
-
-        // eyes - 
-        generate_circle(data, width, height, width * 0.35, height * 0.6, width * 0.07, 255, 0, 255);
-        generate_circle(data, width, height, width * 0.65, height * 0.6, width * 0.07, 0, 0, 255);
-    }
-
-    //    
-    void generate_quads_texture(unsigned char* data, const unsigned int width, const unsigned int height) {
-        for (unsigned int x = 0; x < width; ++x){
-            for (unsigned int y = 0; y < height; ++y){
-                if ((x < width / 2 && y < height / 2) || x >= width / 2 && y >= height / 2){
-                    data[3 * (x + width * y) + 0] = 0;
-                    data[3 * (x + width * y) + 1] = 0;
-                    data[3 * (x + width * y) + 2] = 0;
-                }
-                else {
-                    data[3 * (x + width * y) + 0] = 255;
-                    data[3 * (x + width * y) + 1] = 255;
-                    data[3 * (x + width * y) + 2] = 255;
-                }
-            }
-        }
+            std::vector<unsigned char> pixels(procedural_texture.get_data_size());
+            procedural_texture.generate(pixels.data());
+            return TextureCompressor::compress(pixels.data(), procedural_texture.get_width(), procedural_texture.get_height(), 3,
+                format, ECompressionQuality::Fast, destination);
+        };
     }
 
     //   (      ) 
@@ -141,17 +141,26 @@ namespace MyEngine {
         layout(location = 1) in vec3 vertex_normal;
         layout(location = 2) in vec2 texture_coord;
 
-        //  ,     
-        uniform mat4 model_view_matrix;
-        uniform mat4 mvp_matrix;
-        uniform mat3 normal_matrix;
+        //   (   CPU     ),     
+        struct ObjectMatrices {
+            mat4 model_view_matrix;
+            mat4 mvp_matrix;
+            mat3 normal_matrix;
+        };
+        layout(std430, binding = 0) readonly buffer ObjectMatricesBuffer {
+            ObjectMatrices objects[];
+        };
+        uniform int object_index;
         uniform int current_frame;  
 
-        //    (       )
+        //    (       ,      )
         out vec2 tex_coord_smile;
         out vec2 tex_coord_quads;
         out vec3 frag_position_eye;
         out vec3 frag_normal_eye;
+        out vec4 frag_clip_position;
+        //    ,    :        GL_EQUAL
+        invariant gl_Position;
 
         //   
         void main() {
@@ -161,28 +170,48 @@ namespace MyEngine {
             tex_coord_quads = texture_coord + vec2(current_frame / 1000.f, current_frame / 1000.f);
 
             //    (4  - )
-           frag_normal_eye = normal_matrix * vertex_normal;
-           frag_position_eye = vec3(model_view_matrix * vec4(vertex_position, 1.0));
-           gl_Position = mvp_matrix * vec4(vertex_position, 1.0);
+           frag_normal_eye = objects[object_index].normal_matrix * vertex_normal;
+           frag_position_eye = vec3(objects[object_index].model_view_matrix * vec4(vertex_position, 1.0));
+           gl_Position = objects[object_index].mvp_matrix * vec4(vertex_position, 1.0);
+           frag_clip_position = gl_Position;
         })";
 
-    //  
+    //   (          )
     const char* fragment_shader =
-        R"(//  
-        #version 460
-
+        R"(
         //   (    )
         in vec2 tex_coord_smile;
         in vec2 tex_coord_quads;
         in vec3 frag_position_eye;
         in vec3 frag_normal_eye;
+        in vec4 frag_clip_position;
 
         layout (binding = 0) uniform sampler2D InTexture_Smile;
         layout (binding = 1) uniform sampler2D InTexture_Quads;
+
+        //     ,       ,  
+        struct PointLight {
+            vec4 position_radius;
+            vec4 color_intensity;
+        };
+        layout(std430, binding = 1) readonly buffer LightsBuffer {
+            PointLight lights[];
+        };
+        layout(std430, binding = 2) readonly buffer ClustersBuffer {
+            uvec2 clusters[];
+        };
+        layout(std430, binding = 3) readonly buffer LightIndicesBuffer {
+            uint light_indices[];
+        };
+        //       :  = log() * x + y
+        uniform vec3 cluster_grid;
+        uniform vec4 cluster_depth_params;
         
-        //  ,     
-        uniform vec3 light_position_eye;
+        //    (  )
         uniform vec3 light_color;
+        // :     ,   
+        uniform vec3 sun_direction_eye;
+        uniform vec3 sun_radiance;
 
         //     (, , )
         uniform float ambient_factor;
@@ -197,19 +226,105 @@ namespace MyEngine {
         void main() {
            // ambient
               vec3 ambient = ambient_factor * light_color;
-              // diffuse
               vec3 normal = normalize(frag_normal_eye);
-              vec3 light_dir = normalize(light_position_eye - frag_position_eye);
-              vec3 diffuse = diffuse_factor * light_color * max(dot(normal, light_dir), 0.0);
-              // specular
               vec3 view_dir = normalize(-frag_position_eye);
-              vec3 reflect_dir = reflect(-light_dir, normal);
-              float specular_value = pow(max(dot(view_dir, reflect_dir), 0.0), shininess);
-              vec3 specular = specular_factor * specular_value * light_color;
+
+              //  :    NDC    
+              vec3 cluster_position = vec3((frag_clip_position.xy / frag_clip_position.w * 0.5 + 0.5) * cluster_grid.xy,
+                  log(-frag_position_eye.z) * cluster_depth_params.x + cluster_depth_params.y);
+              uvec3 cluster_id = uvec3(clamp(cluster_position, vec3(0.0), cluster_grid - 1.0));
+              uvec2 cluster = clusters[cluster_id.x + uint(cluster_grid.x) * (cluster_id.y + uint(cluster_grid.y) * cluster_id.z)];
+
+              //    
+              vec3 sun_radiance_shadowed = sun_radiance * get_sun_shadow(frag_position_eye);
+              vec3 diffuse = diffuse_factor * sun_radiance_shadowed * max(dot(normal, -sun_direction_eye), 0.0);
+              vec3 specular = specular_factor * sun_radiance_shadowed * pow(max(dot(view_dir, reflect(sun_direction_eye, normal)), 0.0), shininess);
+
+              // diffuse  specular    ,       
+              for (uint i = 0; i < cluster.y; ++i) {
+                  uint light_index = light_indices[cluster.x + i];
+                  PointLight light = lights[light_index];
+                  vec3 to_light = light.position_radius.xyz - frag_position_eye;
+                  float distance_squared = dot(to_light, to_light);
+                  float falloff = clamp(1.0 - distance_squared / (light.position_radius.w * light.position_radius.w), 0.0, 1.0);
+                  if (falloff <= 0.0) {
+                      continue;
+                  }
+                  vec3 radiance = light.color_intensity.rgb * (light.color_intensity.w * falloff * falloff)
+                      * get_point_shadow(light_index, frag_position_eye, light.position_radius.xyz);
+                  vec3 light_dir = to_light * inversesqrt(distance_squared);
+                  diffuse += diffuse_factor * radiance * max(dot(normal, light_dir), 0.0);
+                  vec3 reflect_dir = reflect(-light_dir, normal);
+                  specular += specular_factor * radiance * pow(max(dot(view_dir, reflect_dir), 0.0), shininess);
+              }
               //frag_color = texture(InTexture_Smile, tex_coord_smile) * texture(InTexture_Quads, tex_coord_quads);
               frag_color = texture(InTexture_Smile, tex_coord_smile) * vec4(ambient + diffuse + specular, 1.f);
            })";
 
+    //       (     )
+    const char* gbuffer_fragment_shader =
+        R"(#version 460
+
+        in vec2 tex_coord_smile;
+        in vec3 frag_normal_eye;
+
+        layout (binding = 0) uniform sampler2D InTexture_Smile;
+
+        //  :     ( G-    max_shininess)
+        uniform float specular_factor;
+        uniform float shininess;
+        uniform float max_shininess;
+
+        //  G-:    ,   
+        layout(location = 0) out vec4 gbuffer_albedo_specular;
+        layout(location = 1) out vec4 gbuffer_normal_shininess;
+
+        //     [0, 1]^2
+        vec2 encode_normal(vec3 n) {
+            n /= abs(n.x) + abs(n.y) + abs(n.z);
+            vec2 encoded = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+            return encoded * 0.5 + 0.5;
+        }
+
+        void main() {
+            gbuffer_albedo_specular = vec4(texture(InTexture_Smile, tex_coord_smile).rgb, specular_factor);
+            gbuffer_normal_shininess = vec4(encode_normal(normalize(frag_normal_eye)), shininess / max_shininess, 0.0);
+        })";
+
+    //   :      ,    (  )
+    const char* depth_prepass_vertex_shader =
+        R"(#version 460
+        layout(location = 0) in vec3 vertex_position;
+
+        struct ObjectMatrices {
+            mat4 model_view_matrix;
+            mat4 mvp_matrix;
+            mat3 normal_matrix;
+        };
+        layout(std430, binding = 0) readonly buffer ObjectMatricesBuffer {
+            ObjectMatrices objects[];
+        };
+        uniform int object_index;
+
+        invariant gl_Position;
+
+        void main() {
+            gl_Position = objects[object_index].mvp_matrix * vec4(vertex_position, 1.0);
+        })";
+
+    const char* depth_prepass_fragment_shader =
+        R"(#version 460
+        void main() {
+        })";
+
+    //  :     1/8 ( ),  - 8     
+    const char* overdraw_fragment_shader =
+        R"(#version 460
+        out vec4 frag_color;
+        void main() {
+            frag_color = vec4(vec3(0.125), 1.0);
+        })";
+
     //     (   )
     const char* light_source_vertex_shader =
         R"(#version 460
@@ -232,15 +347,86 @@ namespace MyEngine {
            }
         )";
 
+    //  :         ,  
+    const char* instance_field_vertex_shader =
+        R"(
+        layout(location = 0) in vec3 vertex_position;
+        layout(location = 1) in vec3 vertex_normal;
+        uniform mat4 view_projection_matrix;
+        out vec3 frag_normal;
+        void main() {
+            mat4 model = get_instance_model();
+            frag_normal = mat3(model) * vertex_normal;
+            gl_Position = view_projection_matrix * model * vec4(vertex_position, 1.0);
+        })";
+
+    const char* instance_field_fragment_shader =
+        R"(#version 460
+        in vec3 frag_normal;
+        uniform vec3 sun_direction;
+        uniform vec3 sun_radiance;
+        uniform vec3 ambient_color;
+        out vec4 frag_color;
+        void main() {
+            vec3 albedo = vec3(0.55, 0.6, 0.7);
+            float lambert = max(dot(normalize(frag_normal), -sun_direction), 0.0);
+            frag_color = vec4(albedo * (ambient_color + sun_radiance * lambert), 1.0);
+        })";
+
     //    
     std::unique_ptr<ShaderProgram> p_shader_program;
     std::unique_ptr<ShaderProgram> p_light_source_shader_program;
-    //     ,          
-    std::unique_ptr<VertexBuffer> p_cube_positions_vbo;
-    std::unique_ptr<IndexBuffer> p_cube_index_buffer;
-    std::unique_ptr<Texture2D> p_texture_smile;
-    std::unique_ptr<Texture2D> p_texture_quads;
-    std::unique_ptr<VertexArray> p_cube_vao;
+    std::unique_ptr<ShaderProgram> p_gbuffer_shader_program;
+    std::unique_ptr<ShaderProgram> p_depth_prepass_shader_program;
+    std::unique_ptr<ShaderProgram> p_overdraw_shader_program;
+    //   (G-   )   GPU  
+    std::unique_ptr<DeferredRenderer> p_deferred_renderer;
+    std::unique_ptr<GpuTimer> p_scene_gpu_timer;
+    //        
+    std::unique_ptr<DynamicResolution> p_dynamic_resolution;
+    //       
+    std::unique_ptr<ShadowMaps> p_shadow_maps;
+    //    GPU:    ,      (-1 -  )
+    std::unique_ptr<GpuCulling> p_gpu_culling;
+    std::unique_ptr<ShaderProgram> p_instance_field_shader_program;
+    TransformsSoA instance_field_transforms;
+    int instance_field_uploaded_count = -1;
+    //  :       ,     CPU  
+    std::unique_ptr<SoftwareRenderer> p_software_renderer;
+    std::unique_ptr<SoftwareTexture> p_software_smile_texture;
+    SoftwareMesh software_cube_mesh;
+    std::unique_ptr<Framebuffer> p_software_target;
+    //   OpenGL      :     
+    struct SoftwareScalingResult {
+        size_t threads_count = 0;
+        double frame_ms = 0.0;
+    };
+    bool software_comparison_requested = false;
+    bool software_comparison_done = false;
+    SoftwareRenderer::ImageDifference software_comparison_result;
+    bool software_scaling_requested = false;
+    std::vector<SoftwareScalingResult> software_scaling_results;
+    //   :     
+    struct RenderPathBenchmarkResult {
+        size_t lights_count = 0;
+        double forward_ms = 0.0;
+        double deferred_ms = 0.0;
+    };
+    bool render_path_benchmark_requested = false;
+    std::vector<RenderPathBenchmarkResult> render_path_benchmark_results;
+    //     
+    std::unique_ptr<AssetManager> p_asset_manager;
+    MeshHandle cube_mesh;
+    //       
+    std::unique_ptr<TextureStreamer> p_texture_streamer;
+    //       (  )   
+    std::unique_ptr<StagingBuffer> p_object_matrices_buffer;
+    TransformsSoA cube_transforms;
+    //  :  0 -  (  ),   
+    std::unique_ptr<LightClusters> p_light_clusters;
+    std::vector<PointLight> point_lights;
+    size_t texture_smile = 0;
+    size_t texture_quads = 0;
     //     
     float m_background_color[4] = { 0.33f, 0.33f, 0.33f, 0.f };
 
@@ -253,6 +439,67 @@ namespace MyEngine {
             glm::vec3(1.f, -7.f,  1.f)
     };
 
+    //    (  OpenGL      )
+    constexpr unsigned int s_texture_size = 1000;
+
+    //   : ,    (  TransformBatch)
+    static glm::mat4 get_model_matrix(const TransformsSoA& transforms, const size_t index) {
+        const glm::vec3 position(transforms.position_x[index], transforms.position_y[index], transforms.position_z[index]);
+        const glm::quat rotation(transforms.rotation_w[index], transforms.rotation_x[index], transforms.rotation_y[index], transforms.rotation_z[index]);
+        const glm::vec3 scale(transforms.scale_x[index], transforms.scale_y[index], transforms.scale_z[index]);
+        return glm::translate(glm::mat4(1.f), position) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.f), scale);
+    }
+
+    //     OpenGL:   (    )  .
+    //     ,       
+    // (   ,  point_lights_count)
+    static void create_scene_objects() {
+        cube_transforms.resize(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            cube_transforms.set(i, positions[i]);
+        }
+
+        point_lights.resize(LightClusters::s_max_lights);
+        point_lights[0] = PointLight{ glm::vec3(0.f), 1.f, glm::vec3(1.f), 1.f };
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> offset(-1.f, 1.f);
+        std::uniform_real_distribution<float> unit(0.f, 1.f);
+        for (size_t i = 1; i < point_lights.size(); ++i) {
+            point_lights[i].position = glm::vec3(offset(random) * 12.f, offset(random) * 12.f, offset(random) * 6.f);
+            point_lights[i].radius = 1.f + unit(random) * 1.5f;
+            point_lights[i].color = glm::vec3(unit(random), unit(random), unit(random));
+            point_lights[i].intensity = 0.5f;
+        }
+    }
+
+    //    frame_width x frame_height     .     
+    //   (get_software_smile_texture):   OpenGL   
+    static void create_software_renderer(const unsigned int frame_width, const unsigned int frame_height) {
+        MeshData cube_mesh_data;
+        std::vector<MeshVertex> vertices(sizeof(pos_norm_uv) / sizeof(MeshVertex));
+        std::memcpy(vertices.data(), pos_norm_uv, sizeof(pos_norm_uv));
+        MeshImporter::build_mesh_data(std::move(vertices), std::vector<uint32_t>(std::begin(indices), std::end(indices)), {}, cube_mesh_data);
+        software_cube_mesh.create(cube_mesh_data);
+
+        p_software_renderer = std::make_unique<SoftwareRenderer>(frame_width, frame_height);
+    }
+
+    //    s_texture_size x s_texture_size   (     ,
+    //    ),    
+    static const SoftwareTexture* get_software_smile_texture() {
+        if (!p_software_smile_texture) {
+            p_software_smile_texture = std::make_unique<SoftwareTexture>(s_texture_size, s_texture_size);
+            for (unsigned int level = 0; level < p_software_smile_texture->get_levels_count(); ++level) {
+                const ProceduralTexture procedural_texture = ProceduralTexture::smile(std::max(s_texture_size >> level, 1u),
+                    std::max(s_texture_size >> level, 1u));
+                std::vector<unsigned char> pixels(procedural_texture.get_data_size());
+                procedural_texture.generate(pixels.data());
+                p_software_smile_texture->set_level(level, pixels.data(), 3);
+            }
+        }
+        return p_software_smile_texture.get();
+    }
+
     //  
 	Application::Application() {
         LOG_INFO("Starting Application!");
@@ -264,13 +511,175 @@ namespace MyEngine {
     }
 
 
+    //       :    
+    size_t Application::update_point_lights() {
+        point_lights[0].position = glm::vec3(light_source_position[0], light_source_position[1], light_source_position[2]);
+        point_lights[0].color = glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]);
+        point_lights[0].radius = 2.f * camera.get_far_clip_plane();
+        return std::min<size_t>(static_cast<size_t>(std::max(point_lights_count, 0)) + 1, point_lights.size());
+    }
+
     void Application::draw(){
-        //     
-        Render_OpenGL::set_clear_color(m_background_color[0], m_background_color[1], m_background_color[2], m_background_color[3]);
+        const size_t lights_count = update_point_lights();
+
+        //     OpenGL      ( ,     )
+        if (software_comparison_requested) {
+            software_comparison_requested = false;
+            run_software_comparison(lights_count);
+        }
+        if (software_scaling_requested) {
+            software_scaling_requested = false;
+            run_software_scaling_benchmark(lights_count);
+        }
+
+        //  :    ,      
+        p_shadow_maps->update(camera.get_view_matrix(), camera.get_projection_matrix(), camera.get_near_clip_plane(), camera.get_far_clip_plane(),
+            get_sun(), point_lights.data(), lights_count, cube_transforms, p_asset_manager->get(cube_mesh),
+            static_cast<size_t>(std::max(shadow_updates_per_frame, 0)), shadows_enabled);
+
+        //        ( ,   )
+        if (render_path_benchmark_requested) {
+            render_path_benchmark_requested = false;
+            run_render_path_benchmark();
+        }
+
+        //        ,      .   
+        //  GPU     ,      CPU
+        const double scene_ms = render_path == RenderPath::Software ? p_software_renderer->get_stats().total_ms
+            : p_scene_gpu_timer->get_elapsed_ms();
+        p_dynamic_resolution->update(scene_ms, dynamic_resolution, dynamic_resolution_target_ms, dynamic_resolution_min_scale);
+        p_dynamic_resolution->begin_frame();
+
+        //      (    )
+        if (overdraw_visualization) {
+            Render_OpenGL::set_clear_color(0.f, 0.f, 0.f, 0.f);
+        }
+        else {
+            Render_OpenGL::set_clear_color(m_background_color[0], m_background_color[1], m_background_color[2], m_background_color[3]);
+        }
         Render_OpenGL::clear();
 
+        p_scene_gpu_timer->begin();
+        if (render_path == RenderPath::Software) {
+            draw_software_scene(lights_count);
+        }
+        else {
+            draw_scene(render_path, lights_count);
+        }
+        p_scene_gpu_timer->end();
+
+        // light source (         G-,   -   )
+        if (render_path != RenderPath::Software) {
+            p_light_source_shader_program->bind();
+            glm::mat4 translate_matrix(1, 0, 0, 0,
+                0, 1, 0, 0,
+                0, 0, 1, 0,
+                light_source_position[0], light_source_position[1], light_source_position[2], 1);
+            p_light_source_shader_program->set_matrix4("mvp_matrix", camera.get_view_projection_matrix() * translate_matrix);
+            p_light_source_shader_program->set_vec3("light_color", glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]));
+            if (const Mesh* p_cube_mesh = p_asset_manager->get(cube_mesh)) {
+                Render_OpenGL::draw(p_cube_mesh->get_vertex_array());
+            }
+        }
+
+        if (!overdraw_visualization && render_path != RenderPath::Software) {
+            draw_gpu_culled_instances();
+        }
+
+        //      :     ,  GPU  
+        p_object_matrices_buffer->flush();
+        p_light_clusters->end_frame();
+        p_shadow_maps->end_frame();
+
+        //   ,    
+        p_texture_streamer->update();
+
+        //      : ImGui    
+        p_dynamic_resolution->end_frame(upscale_sharpness);
+
+        //   (, , )
+        UIModule::on_ui_draw_begin(m_pWindow->get_width(), m_pWindow->get_height(), m_pWindow->get_framebuffer_width(),
+            m_pWindow->get_framebuffer_height());
+        on_ui_draw();
+        p_asset_manager->on_ui_draw();
+        p_light_clusters->on_ui_draw();
+        p_shadow_maps->on_ui_draw();
+        p_dynamic_resolution->on_ui_draw();
+        p_gpu_culling->on_ui_draw();
+        p_software_renderer->on_ui_draw();
+        on_render_path_ui_draw();
+        Render_OpenGL::on_ui_draw();
+        ProfilerModule::on_ui_draw();
+        UIModule::on_ui_draw_end();
+
+        //    (      ),     
+        GpuMemoryTracker::update();
+        p_asset_manager->update();
+
+        //  ,          
+        m_pWindow->on_update();
+        process_events();
+        on_update();
+        //     :        
+        LatencyTracker::on_input_consumed(Input::GetSnapshot().first_input_timestamp);
+
+        //  :   N - 1 ,       OpenGL   
+        FrameAllocator::end_frame();
+        AllocationCounter::end_frame();
+        Render_OpenGL::end_frame();
+    }
+
+    //  :      ,    G-,    
+    void Application::draw_scene(const RenderPath path, const size_t lights_count) {
+        //      ,     .
+        //      G-   
+        const bool overdraw = overdraw_visualization;
+        const bool deferred = !overdraw && path == RenderPath::Deferred && p_deferred_renderer->is_ready() && p_gbuffer_shader_program->is_compiled();
+        const ShaderProgram& scene_shader_program = overdraw ? *p_overdraw_shader_program : deferred ? *p_gbuffer_shader_program : *p_shader_program;
+        if (deferred) {
+            p_deferred_renderer->begin_geometry_pass(p_dynamic_resolution->get_render_width(), p_dynamic_resolution->get_render_height());
+        }
+
+        //      
+        const Mesh* p_cube_mesh = p_asset_manager->get(cube_mesh);
+
+        //         ,   
+        const size_t matrices_size = cube_transforms.size() * sizeof(ObjectMatrices);
+        size_t matrices_offset = 0;
+        ObjectMatrices* pObjectMatrices = static_cast<ObjectMatrices*>(p_object_matrices_buffer->allocate(matrices_size, 256, matrices_offset));
+        if (pObjectMatrices) {
+            TransformBatch::calculate(cube_transforms, camera.get_view_matrix(), camera.get_view_projection_matrix(), pObjectMatrices);
+            Render_OpenGL::bind_storage_buffer(0, p_object_matrices_buffer->get_handle(), matrices_offset, matrices_size);
+        }
+        const bool can_draw = p_cube_mesh && pObjectMatrices;
+
+        //       (    ):      
+        const glm::mat4& view_matrix = camera.get_view_matrix();
+        const auto get_view_depth = [&view_matrix](const glm::vec3& position) {
+            return -(view_matrix[0][2] * position.x + view_matrix[1][2] * position.y + view_matrix[2][2] * position.z + view_matrix[3][2]);
+        };
+        FrameVector<size_t> draw_order(positions.size(), FrameAllocator::get_resource());
+        std::iota(draw_order.begin(), draw_order.end(), size_t(0));
+        std::sort(draw_order.begin(), draw_order.end(), [&](const size_t a, const size_t b) {
+            return get_view_depth(positions[a]) < get_view_depth(positions[b]);
+        });
+
+        //  :             
+        const bool prepass = depth_prepass && can_draw;
+        if (prepass) {
+            Render_OpenGL::set_color_write(false);
+            p_depth_prepass_shader_program->bind();
+            for (const size_t i : draw_order) {
+                p_depth_prepass_shader_program->set_int("object_index", static_cast<int>(i));
+                Render_OpenGL::draw(p_cube_mesh->get_vertex_array());
+            }
+            Render_OpenGL::set_color_write(true);
+            Render_OpenGL::set_depth_function(EDepthFunction::Equal);
+            Render_OpenGL::set_depth_write(false);
+        }
+
         //     
-        p_shader_program->bind();
+        scene_shader_program.bind();
 
         //  
         /*glm::mat4 scale_matrix(scale[0], 0, 0, 0,
@@ -293,68 +702,434 @@ namespace MyEngine {
 
         //  
         static int current_frame = 0;
-        p_shader_program->set_int("current_frame", current_frame++);
+        scene_shader_program.set_int("current_frame", current_frame++);
+
+        p_light_clusters->update(point_lights.data(), lights_count, camera.get_view_matrix(), camera.get_projection_matrix(),
+            camera.get_near_clip_plane(), camera.get_far_clip_plane());
+        if (overdraw) {
+            //     
+            Render_OpenGL::set_additive_blending(true);
+        }
+        else if (deferred) {
+            //      ,  G-    
+            p_light_clusters->bind_lights();
+            scene_shader_program.set_float("specular_factor", specular_factor);
+            scene_shader_program.set_float("shininess", shininess);
+            scene_shader_program.set_float("max_shininess", DeferredRenderer::s_max_shininess);
+        }
+        else {
+            p_light_clusters->bind(scene_shader_program);
+            p_shadow_maps->bind(scene_shader_program);
+            const DirectionalLight sun = get_sun();
+            scene_shader_program.set_vec3("sun_direction_eye", glm::mat3(camera.get_view_matrix()) * sun.direction);
+            scene_shader_program.set_vec3("sun_radiance", sun.color * sun.intensity);
+            scene_shader_program.set_vec3("light_color", glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]));
+            scene_shader_program.set_float("ambient_factor", ambient_factor);
+            scene_shader_program.set_float("diffuse_factor", diffuse_factor);
+            scene_shader_program.set_float("specular_factor", specular_factor);
+            scene_shader_program.set_float("shininess", shininess);
+        }
 
-        p_shader_program->set_vec3("light_position_eye", glm::vec3(camera.get_view_matrix() * glm::vec4(light_source_position[0], light_source_position[1], 
-            light_source_position[2], 1.f)));
-        p_shader_program->set_vec3("light_color", glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]));
-        p_shader_program->set_float("ambient_factor", ambient_factor);
-        p_shader_program->set_float("diffuse_factor", diffuse_factor);
-        p_shader_program->set_float("specular_factor", specular_factor);
-        p_shader_program->set_float("shininess", shininess);
+        //    :      
+        p_texture_streamer->get_texture(texture_smile).bind(0);
+        p_texture_streamer->get_texture(texture_quads).bind(1);
 
         //    
-        for (const glm::vec3& current_position : positions) {
-            glm::mat4 translate_matrix(1, 0, 0, 0,
-                0, 1, 0, 0,
-                0, 0, 1, 0,
-                current_position[0], current_position[1], current_position[2], 1);
-            const glm::mat4 model_view_matrix = camera.get_view_matrix() * translate_matrix;
-            p_shader_program->set_matrix4("model_view_matrix", model_view_matrix);
-            p_shader_program->set_matrix4("mvp_matrix", camera.get_projection_matrix() * model_view_matrix);
-            p_shader_program->set_matrix3("normal_matrix", glm::transpose(glm::inverse(glm::mat3(model_view_matrix))));
-            Render_OpenGL::draw(*p_cube_vao);
+        for (const size_t i : draw_order) {
+            //    (   sqrt(3))    
+            const float screen_size = TextureStreamer::calculate_screen_size(camera, &positions[i][0], 1.733f);
+            p_texture_streamer->request_screen_size(texture_smile, screen_size);
+            p_texture_streamer->request_screen_size(texture_quads, screen_size);
+            scene_shader_program.set_int("object_index", static_cast<int>(i));
+            if (can_draw) {
+                Render_OpenGL::draw(p_cube_mesh->get_vertex_array());
+            }
         }
 
-        // light source
-        {
-            p_light_source_shader_program->bind();
-            glm::mat4 translate_matrix(1, 0, 0, 0,
-                0, 1, 0, 0,
-                0, 0, 1, 0,
-                light_source_position[0], light_source_position[1], light_source_position[2], 1);
-            p_light_source_shader_program->set_matrix4("mvp_matrix", camera.get_projection_matrix() * camera.get_view_matrix() * translate_matrix);
-            p_light_source_shader_program->set_vec3("light_color", glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]));
-            Render_OpenGL::draw(*p_cube_vao);
+        //          
+        if (prepass) {
+            Render_OpenGL::set_depth_function(EDepthFunction::Less);
+            Render_OpenGL::set_depth_write(true);
+        }
+        if (overdraw) {
+            Render_OpenGL::set_additive_blending(false);
         }
 
-        //   (, , )
-        UIModule::on_ui_draw_begin();
-        on_ui_draw();
-        UIModule::on_ui_draw_end();
+        if (deferred) {
+            const glm::vec3 light_color(light_source_color[0], light_source_color[1], light_source_color[2]);
+            const DirectionalLight sun = get_sun();
+            p_deferred_renderer->lighting_pass(lights_count, camera.get_projection_matrix(), ambient_factor * light_color, diffuse_factor,
+                glm::mat3(camera.get_view_matrix()) * sun.direction, sun.color * sun.intensity, *p_shadow_maps,
+                p_dynamic_resolution->get_scene_target());
+        }
+    }
 
-        m_pWindow->on_update();
-        on_update();
+    //     ,      (   )
+    void Application::draw_gpu_culled_instances() {
+        constexpr float s_spacing = 2.5f;
+        constexpr float s_ground_height = -8.f;
+        const Mesh* p_cube_mesh = p_asset_manager->get(cube_mesh);
+        if (!p_cube_mesh || !p_gpu_culling->is_ready() || !p_instance_field_shader_program->is_compiled()) {
+            return;
+        }
+        const int instances_count = std::max(gpu_culled_instances_count, 0);
+        if (instances_count != instance_field_uploaded_count) {
+            const size_t side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(instances_count))));
+            const float half_extent = 0.5f * s_spacing * static_cast<float>(side);
+            instance_field_transforms.resize(static_cast<size_t>(instances_count));
+            for (size_t i = 0; i < instance_field_transforms.size(); ++i) {
+                const float height = 1.f + static_cast<float>(((i * 2654435761u) >> 28) & 3u);
+                const glm::vec3 position(static_cast<float>(i % side) * s_spacing - half_extent, static_cast<float>(i / side) * s_spacing - half_extent,
+                    s_ground_height + height);
+                instance_field_transforms.set(i, position, glm::quat(1.f, 0.f, 0.f, 0.f), glm::vec3(1.f, 1.f, height));
+            }
+            p_gpu_culling->set_instances(instance_field_transforms, *p_cube_mesh);
+            instance_field_uploaded_count = instances_count;
+        }
+        if (instances_count == 0) {
+            return;
+        }
+
+        p_gpu_culling->cull(camera, *p_cube_mesh, gpu_occlusion_culling);
+        const DirectionalLight sun = get_sun();
+        p_instance_field_shader_program->bind();
+        p_instance_field_shader_program->set_matrix4("view_projection_matrix", camera.get_view_projection_matrix());
+        p_instance_field_shader_program->set_vec3("sun_direction", sun.direction);
+        p_instance_field_shader_program->set_vec3("sun_radiance", sun.color * sun.intensity);
+        p_instance_field_shader_program->set_vec3("ambient_color",
+            ambient_factor * glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]));
+        p_gpu_culling->draw(*p_cube_mesh);
+
+        p_gpu_culling->build_depth_pyramid(p_dynamic_resolution->get_scene_target(), p_dynamic_resolution->get_render_width(),
+            p_dynamic_resolution->get_render_height(), camera.get_view_projection_matrix());
+    }
+
+    //   :    
+    DirectionalLight Application::get_sun() const {
+        glm::vec3 direction(sun_direction[0], sun_direction[1], sun_direction[2]);
+        const float length = glm::length(direction);
+        direction = length > 1e-4f ? direction / length : glm::vec3(0.f, 0.f, -1.f);
+        return DirectionalLight{ direction, std::max(sun_intensity, 0.f), glm::vec3(sun_color[0], sun_color[1], sun_color[2]) };
+    }
+
+    //       ,  GPU  .     
+    // ,  fence   
+    void Application::run_render_path_benchmark() {
+        constexpr int s_repeats_count = 10;
+        if (!p_deferred_renderer->is_ready() || !p_gbuffer_shader_program->is_compiled()) {
+            LOG_CATEGORY_ERROR(Render, "Render path benchmark: deferred renderer is not ready");
+            return;
+        }
+        GpuTimer timer;
+        render_path_benchmark_results.clear();
+        for (size_t lights_count = 64; lights_count <= point_lights.size(); lights_count *= 4) {
+            RenderPathBenchmarkResult result;
+            result.lights_count = lights_count;
+            for (const RenderPath path : { RenderPath::Forward, RenderPath::Deferred }) {
+                double total_ms = 0.0;
+                for (int repeat = 0; repeat < s_repeats_count; ++repeat) {
+                    Render_OpenGL::clear();
+                    timer.begin();
+                    draw_scene(path, lights_count);
+                    timer.end();
+                    p_object_matrices_buffer->flush();
+                    p_light_clusters->end_frame();
+                    total_ms += timer.wait_elapsed_ms();
+                }
+                (path == RenderPath::Forward ? result.forward_ms : result.deferred_ms) = total_ms / s_repeats_count;
+            }
+            render_path_benchmark_results.push_back(result);
+            LOG_CATEGORY_INFO(Render, "Render paths: {0} lights - forward {1:.3f} ms, deferred {2:.3f} ms (GPU)",
+                result.lights_count, result.forward_ms, result.deferred_ms);
+        }
+    }
+
+    //   :       .    -    ,
+    //   (render_software) -  ,    
+    void Application::submit_software_scene(const size_t lights_count) {
+        if (p_dynamic_resolution) {
+            const unsigned int width = p_dynamic_resolution->get_render_width();
+            const unsigned int height = p_dynamic_resolution->get_render_height();
+            if (p_software_renderer->get_width() != width || p_software_renderer->get_height() != height) {
+                p_software_renderer->resize(width, height);
+            }
+        }
+
+        const DirectionalLight sun = get_sun();
+        SoftwareLighting lighting;
+        lighting.ambient_color = ambient_factor * glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]);
+        lighting.diffuse_factor = diffuse_factor;
+        lighting.specular_factor = specular_factor;
+        lighting.shininess = shininess;
+        lighting.sun_direction = sun.direction;
+        lighting.sun_radiance = sun.color * sun.intensity;
+        lighting.pLights = point_lights.data();
+        lighting.lights_count = lights_count;
+        p_software_renderer->begin_frame(glm::vec4(m_background_color[0], m_background_color[1], m_background_color[2], m_background_color[3]),
+            camera.get_view_matrix(), camera.get_projection_matrix(), lighting);
+
+        SoftwareMaterial material;
+        material.pTexture = get_software_smile_texture();
+        for (size_t i = 0; i < cube_transforms.size(); ++i) {
+            p_software_renderer->draw(software_cube_mesh, get_model_matrix(cube_transforms, i), material);
+        }
+    }
+
+    //   CPU    (  )
+    void Application::render_software_frame(const size_t lights_count) {
+        submit_software_scene(lights_count);
+        SoftwareMaterial light_source_material;
+        light_source_material.color = glm::vec3(light_source_color[0], light_source_color[1], light_source_color[2]);
+        light_source_material.lit = false;
+        const glm::mat4 light_source_model = glm::scale(glm::translate(glm::mat4(1.f),
+            glm::vec3(light_source_position[0], light_source_position[1], light_source_position[2])), glm::vec3(0.1f));
+        p_software_renderer->draw(software_cube_mesh, light_source_model, light_source_material);
+        p_software_renderer->end_frame(static_cast<size_t>(std::max(software_threads_count, 0)));
+    }
+
+    //   CPU,         
+    void Application::draw_software_scene(const size_t lights_count) {
+        render_software_frame(lights_count);
+
+        const unsigned int width = p_software_renderer->get_width();
+        const unsigned int height = p_software_renderer->get_height();
+        p_software_target->upload_color(0, width, height, p_software_renderer->get_color_data());
+        p_software_target->blit_color(p_dynamic_resolution->get_scene_target(), width, height);
+    }
+
+    //   OpenGL   (    )      CPU.  OpenGL  
+    //   ,         s_tolerance
+    void Application::run_software_comparison(const size_t lights_count) {
+        constexpr unsigned int s_tolerance = 8;
+        p_shadow_maps->update(camera.get_view_matrix(), camera.get_projection_matrix(), camera.get_near_clip_plane(), camera.get_far_clip_plane(),
+            get_sun(), point_lights.data(), lights_count, cube_transforms, p_asset_manager->get(cube_mesh), 0, false);
+        p_dynamic_resolution->begin_frame();
+        const unsigned int width = p_dynamic_resolution->get_render_width();
+        const unsigned int height = p_dynamic_resolution->get_render_height();
+
+        const bool overdraw = overdraw_visualization;
+        overdraw_visualization = false;
+        Render_OpenGL::set_clear_color(m_background_color[0], m_background_color[1], m_background_color[2], m_background_color[3]);
+        Render_OpenGL::clear();
+        draw_scene(RenderPath::Forward, lights_count);
+        overdraw_visualization = overdraw;
+        std::vector<uint32_t> gl_pixels(static_cast<size_t>(width) * height);
+        Render_OpenGL::read_pixels(width, height, gl_pixels.data());
+        p_object_matrices_buffer->flush();
+        p_light_clusters->end_frame();
+
+        submit_software_scene(lights_count);
+        p_software_renderer->end_frame(static_cast<size_t>(std::max(software_threads_count, 0)));
+        software_comparison_result = SoftwareRenderer::compare(gl_pixels.data(), p_software_renderer->get_color_data(), gl_pixels.size(), s_tolerance);
+        software_comparison_done = true;
+        LOG_CATEGORY_INFO(Render, "Software renderer vs OpenGL at {0}x{1}: mean error {2:.3f}, max error {3}, {4:.3f}% pixels differ by more than {5}",
+            width, height, software_comparison_result.mean_error, software_comparison_result.max_error,
+            software_comparison_result.mismatched_fraction * 100.0, s_tolerance);
+    }
+
+    //     1, 2, 4, ...      ,    
+    void Application::run_software_scaling_benchmark(const size_t lights_count) {
+        constexpr int s_repeats_count = 10;
+        const size_t workers_count = get_workers_count();
+        software_scaling_results.clear();
+        for (size_t threads_count = 1;; threads_count = std::min(threads_count * 2, workers_count)) {
+            double total_ms = 0.0;
+            for (int repeat = 0; repeat < s_repeats_count; ++repeat) {
+                submit_software_scene(lights_count);
+                p_software_renderer->end_frame(threads_count);
+                total_ms += p_software_renderer->get_stats().total_ms;
+            }
+            software_scaling_results.push_back(SoftwareScalingResult{ threads_count, total_ms / s_repeats_count });
+            LOG_CATEGORY_INFO(Render, "Software renderer: {0} threads - {1:.3f} ms", threads_count, software_scaling_results.back().frame_ms);
+            if (threads_count == workers_count) {
+                break;
+            }
+        }
+    }
+
+    //   :  GPU  , G-   
+    void Application::on_render_path_ui_draw() {
+        ImGui::Begin("Render path");
+        const char* const path_names[] = { "forward", "deferred", "software" };
+        ImGui::Text("Path: %s", path_names[static_cast<size_t>(render_path)]);
+        ImGui::Text("Scene GPU: %.3f ms", p_scene_gpu_timer->get_elapsed_ms());
+        ImGui::Text("Depth pre-pass: %s", depth_prepass ? "on" : "off");
+        const Framebuffer& gbuffer = p_deferred_renderer->get_gbuffer();
+        ImGui::Text("G-buffer: %ux%u, %zu KB", gbuffer.get_width(), gbuffer.get_height(), gbuffer.get_memory_size() / 1024);
+        if (ImGui::Button("Benchmark render paths")) {
+            render_path_benchmark_requested = true;
+        }
+        if (!render_path_benchmark_results.empty() && ImGui::BeginTable("render_path_benchmark", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Lights");
+            ImGui::TableSetupColumn("Forward, ms");
+            ImGui::TableSetupColumn("Deferred, ms");
+            ImGui::TableHeadersRow();
+            for (const RenderPathBenchmarkResult& result : render_path_benchmark_results) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", result.lights_count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", result.forward_ms);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", result.deferred_ms);
+            }
+            ImGui::EndTable();
+        }
+
+        //  :   OpenGL     (    1 )
+        if (ImGui::Button("Compare software with GL")) {
+            software_comparison_requested = true;
+        }
+        if (software_comparison_done) {
+            ImGui::Text("Mean error: %.3f, max error: %u, mismatched: %.3f%%", software_comparison_result.mean_error,
+                software_comparison_result.max_error, software_comparison_result.mismatched_fraction * 100.0);
+        }
+        if (ImGui::Button("Benchmark software threads")) {
+            software_scaling_requested = true;
+        }
+        if (!software_scaling_results.empty() && ImGui::BeginTable("software_scaling", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Threads");
+            ImGui::TableSetupColumn("Frame, ms");
+            ImGui::TableSetupColumn("Speedup");
+            ImGui::TableSetupColumn("Efficiency");
+            ImGui::TableHeadersRow();
+            const double single_thread_ms = software_scaling_results.front().frame_ms;
+            for (const SoftwareScalingResult& result : software_scaling_results) {
+                const double speedup = result.frame_ms > 0.0 ? single_thread_ms / result.frame_ms : 0.0;
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", result.threads_count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", result.frame_ms);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2fx", speedup);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f%%", speedup / static_cast<double>(result.threads_count) * 100.0);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+
+    //    :    ,  -    
+    void Application::process_events() {
+        Event event;
+        uint64_t last_event_timestamp = 0;
+        uint64_t first_input_timestamp = 0;
+        while (m_pWindow->pop_event(event)) {
+            UIModule::on_event(event);
+            m_event_dispatcher.post(event);
+            last_event_timestamp = event.timestamp;
+            if (first_input_timestamp == 0 && is_input_event(event.type)) {
+                first_input_timestamp = event.timestamp;
+            }
+        }
+        m_event_dispatcher.dispatch_queued();
+        Input::NewFrame(last_event_timestamp, first_input_timestamp);
+    }
+
+    //      OpenGL:    CPU   ,     
+    int Application::render_software(unsigned int width, unsigned int height, const char* output_path, unsigned int frames_count) {
+        if (width == 0 || height == 0 || frames_count == 0) {
+            LOG_CATEGORY_ERROR(Render, "Software output: invalid frame {0}x{1}, {2} frames", width, height, frames_count);
+            return -1;
+        }
+        camera.set_viewport_size(static_cast<float>(width), static_cast<float>(height));
+        JobSystem::initialize();
+        create_scene_objects();
+        create_software_renderer(width, height);
+
+        for (unsigned int frame = 0; frame < frames_count; ++frame) {
+            on_update();
+            render_software_frame(update_point_lights());
+        }
+        const SoftwareRenderer::Stats& stats = p_software_renderer->get_stats();
+        LOG_CATEGORY_INFO(Render, "Software output: {0} frames of {1}x{2}, last frame {3:.3f} ms on {4} threads",
+            frames_count, width, height, stats.total_ms, stats.threads_count);
+        const bool written = p_software_renderer->write_image(output_path);
+
+        p_software_renderer = nullptr;
+        p_software_smile_texture = nullptr;
+        JobSystem::shutdown();
+        Log::shutdown();
+        return written ? 0 : -1;
     }
 
     //   .           
 	int Application::start(unsigned int window_width, unsigned int window_height, const char* title) {
-        //   : ,   
+        //   : ,   .    ,    
         m_pWindow = std::make_unique<Window>(title, window_width, window_height);
+        if (!m_pWindow->is_created()) {
+            m_pWindow = nullptr;
+            Log::shutdown();
+            return -1;
+        }
         camera.set_viewport_size(static_cast<float>(window_width), static_cast<float>(window_height));
 
+        //  OpenGL   :      .
+        //    ,     
+        m_pWindow->make_context_current(false);
+        int result_code = 0;
+        std::thread update_thread([this, &result_code]() {
+            m_pWindow->make_context_current(true);
+            //     ,    
+            JobSystem::initialize();
+
+            result_code = run();
+
+            p_texture_streamer = nullptr;
+            p_object_matrices_buffer = nullptr;
+            p_light_clusters = nullptr;
+            p_deferred_renderer = nullptr;
+            p_dynamic_resolution = nullptr;
+            p_scene_gpu_timer = nullptr;
+            p_shadow_maps = nullptr;
+            p_gpu_culling = nullptr;
+            p_instance_field_shader_program = nullptr;
+            p_software_renderer = nullptr;
+            p_software_smile_texture = nullptr;
+            p_software_target = nullptr;
+            p_asset_manager = nullptr;
+            LatencyTracker::shutdown();
+            JobSystem::shutdown();
+            m_pWindow->make_context_current(false);
+            m_bCloseWindow.store(true);
+            m_pWindow->wake_event_loop();
+        });
+        m_pWindow->run_event_loop(m_bCloseWindow);
+        update_thread.join();
+
+        m_pWindow = nullptr;
+        //     
+        Log::shutdown();
+        return result_code;
+    }
+
+    //      ( )
+    int Application::run() {
         //    
         m_event_dispatcher.add_event_listener<EventMouseMoved>(
             [&](EventMouseMoved& event) {
                 //LOG_INFO("[MouseMoved] Mouse moved to {0}x{1}", event.x, event.y);
+                Input::MoveMouse(event.x, event.y);
             });
 
-        //      
+        //      .    :
+        //    ,       
         m_event_dispatcher.add_event_listener<EventWindowResize>(
             [&](EventWindowResize& event) {
                 LOG_INFO("[Resized] Changed size to {0}x{1}", event.width, event.height);
                 camera.set_viewport_size(static_cast<float>(event.width), static_cast<float>(event.height));
-                draw();
+            });
+
+        //        
+        m_event_dispatcher.add_event_listener<EventFramebufferResize>(
+            [&](EventFramebufferResize& event) {
+                Render_OpenGL::set_viewport(event.width, event.height);
+                p_deferred_renderer->resize(event.width, event.height);
+                p_dynamic_resolution->resize(event.width, event.height);
+                p_gpu_culling->resize(event.width, event.height);
+                p_software_target->resize(event.width, event.height);
             });
 
         //     
@@ -366,14 +1141,14 @@ namespace MyEngine {
 
         //    
         m_event_dispatcher.add_event_listener<EventMouseButtonPressed>([&](EventMouseButtonPressed& event){
-                LOG_INFO("[Mouse button pressed: {0}, at ({1}, {2})", static_cast<int>(event.mouse_button), event.x_pos, event.y_pos);
+                LOG_CATEGORY_TRACE(Input, "[Mouse button pressed: {0}, at ({1}, {2})", static_cast<int>(event.mouse_button), event.x_pos, event.y_pos);
                 Input::PressMouseButton(event.mouse_button);
                 on_mouse_button_event(event.mouse_button, event.x_pos, event.y_pos, true);
             });
 
         //    
         m_event_dispatcher.add_event_listener<EventMouseButtonReleased>([&](EventMouseButtonReleased& event){
-                LOG_INFO("[Mouse button released: {0}, at ({1}, {2})", static_cast<int>(event.mouse_button), event.x_pos, event.y_pos);
+                LOG_CATEGORY_TRACE(Input, "[Mouse button released: {0}, at ({1}, {2})", static_cast<int>(event.mouse_button), event.x_pos, event.y_pos);
                 Input::ReleaseMouseButton(event.mouse_button);
                 on_mouse_button_event(event.mouse_button, event.x_pos, event.y_pos, false);
             });
@@ -384,10 +1159,10 @@ namespace MyEngine {
             if (event.key_code <= KeyCode::KEY_Z) {
                 // ,      
                 if (event.repeated) {
-                    LOG_INFO("[Key pressed: {0}, repeated", static_cast<char>(event.key_code));
+                    LOG_CATEGORY_TRACE(Input, "[Key pressed: {0}, repeated", static_cast<char>(event.key_code));
                 }
                 else {
-                    LOG_INFO("[Key pressed: {0}", static_cast<char>(event.key_code));
+                    LOG_CATEGORY_TRACE(Input, "[Key pressed: {0}", static_cast<char>(event.key_code));
                 }
             }
             Input::PressKey(event.key_code);
@@ -397,72 +1172,107 @@ namespace MyEngine {
         m_event_dispatcher.add_event_listener<EventKeyReleased>([&](EventKeyReleased& event) {
             //  char ,      "z"
             if (event.key_code <= KeyCode::KEY_Z){
-                LOG_INFO("[Key released: {0}", static_cast<char>(event.key_code));
+                LOG_CATEGORY_TRACE(Input, "[Key released: {0}", static_cast<char>(event.key_code));
             }
             Input::ReleaseKey(event.key_code);
         });
 
-        //   
-        m_pWindow->set_event_callback(
-            [&](BaseEvent& event){
-                m_event_dispatcher.dispatch(event);
-            });
-
         //    
-        const unsigned int width = 1000;
-        const unsigned int height = 1000;
-        const unsigned int channels = 3;
-        auto* data = new unsigned char[width * height * channels];
-
-        //   ,     
-        generate_smile_texture(data, width, height);
-        p_texture_smile = std::make_unique<Texture2D>(data, width, height);
-        p_texture_smile->bind(0);
-        
-        //    ,     
-        generate_quads_texture(data, width, height);
-        p_texture_quads = std::make_unique<Texture2D>(data, width, height);
-        p_texture_quads->bind(1);
-
-        delete[] data;
+        const unsigned int width = s_texture_size;
+        const unsigned int height = s_texture_size;
+        //   -  : BC1   ,   
+        const ETextureFormat texture_format = select_texture_format(ETextureUsage::Color,
+            compress_color_textures_bc1 && Texture2D::is_format_supported(ETextureFormat::BC1), false);
+        const auto textures_start_time = std::chrono::steady_clock::now();
+
+        //     ,       
+        p_texture_streamer = std::make_unique<TextureStreamer>();
+        texture_smile = p_texture_streamer->add_texture(width, height, texture_format, 0,
+            create_procedural_mip_provider(&ProceduralTexture::smile, width, height, texture_format));
+        texture_quads = p_texture_streamer->add_texture(width, height, texture_format, 0,
+            create_procedural_mip_provider(&ProceduralTexture::quads, width, height, texture_format));
+        if (texture_smile == TextureStreamer::s_invalid_texture || texture_quads == TextureStreamer::s_invalid_texture) { return -1; }
+
+        LOG_INFO("Procedural textures registered in {0:.3f} ms, {1} KB of video memory in {2}, resident level {3}",
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - textures_start_time).count(),
+            (p_texture_streamer->get_texture(texture_smile).get_memory_size() + p_texture_streamer->get_texture(texture_quads).get_memory_size()) / 1024,
+            get_format_name(texture_format), p_texture_streamer->get_resident_level(texture_smile));
 
         //    
         //---------------------------------------//
         //      
-        p_shader_program = std::make_unique<ShaderProgram>(vertex_shader, fragment_shader);
-        if (!p_shader_program->is_compiled()) { return false; }
+        p_shader_program = std::make_unique<ShaderProgram>(vertex_shader,
+            (std::string("#version 460\n") + ShadowMaps::get_shader_source() + fragment_shader).c_str());
+        if (!p_shader_program->is_compiled()) { return -1; }
+
+        //          ,  ,   
+        p_asset_manager = std::make_unique<AssetManager>();
+        cube_mesh = p_asset_manager->add_mesh("cube", [](MeshData& mesh_data) {
+            std::vector<MeshVertex> vertices(sizeof(pos_norm_uv) / sizeof(MeshVertex));
+            std::memcpy(vertices.data(), pos_norm_uv, sizeof(pos_norm_uv));
+            MeshImporter::build_mesh_data(std::move(vertices), std::vector<uint32_t>(std::begin(indices), std::end(indices)), {}, mesh_data);
+            return true;
+        });
+        const auto cube_start_time = std::chrono::steady_clock::now();
+        p_asset_manager->on_ready(cube_mesh, [cube_start_time](const bool loaded) {
+            LOG_INFO("Cube mesh {0} in {1:.3f} ms", loaded ? "ready" : "failed",
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cube_start_time).count());
+        });
 
-        //     
+        //---------------------------------------//
 
-        //     
-        BufferLayout buffer_layout_1vec3{
-            ShaderDataType::Float3
-        };
+        //    
+        p_light_source_shader_program = std::make_unique<ShaderProgram>(light_source_vertex_shader, light_source_fragment_shader);
+        if (!p_light_source_shader_program->is_compiled()){
+            return -1;
+        }
 
-        BufferLayout buffer_layout_vec3_vec3_vec2{
-            ShaderDataType::Float3,
-            ShaderDataType::Float3,
-            ShaderDataType::Float2
-        };
 
-        //  
+        //    ,   
+        create_scene_objects();
+        p_object_matrices_buffer = std::make_unique<StagingBuffer>(StagingBuffer::s_blocks_count * 64 * 1024);
+        LOG_INFO("Transform kernel: {0}", TransformBatch::get_kernel_name(TransformBatch::get_kernel()));
 
-        //        
-        p_cube_vao = std::make_unique<VertexArray>();
-        p_cube_positions_vbo = std::make_unique<VertexBuffer>(pos_norm_uv, sizeof(pos_norm_uv), buffer_layout_vec3_vec3_vec2);
-        p_cube_index_buffer = std::make_unique<IndexBuffer>(indices, sizeof(indices) / sizeof(GLuint));
+        //       (   ,  point_lights_count)
+        p_light_clusters = std::make_unique<LightClusters>();
 
-        p_cube_vao->add_vertex_buffer(*p_cube_positions_vbo);
-        p_cube_vao->set_index_buffer(*p_cube_index_buffer);
+        //  : G-   ,   
+        p_gbuffer_shader_program = std::make_unique<ShaderProgram>(vertex_shader, gbuffer_fragment_shader);
+        p_deferred_renderer = std::make_unique<DeferredRenderer>(m_pWindow->get_width(), m_pWindow->get_height());
+        if (!p_gbuffer_shader_program->is_compiled() || !p_deferred_renderer->is_ready()) {
+            LOG_CATEGORY_ERROR(Render, "Deferred renderer is not available, forward path is used");
+        }
+        p_scene_gpu_timer = std::make_unique<GpuTimer>();
+        p_dynamic_resolution = std::make_unique<DynamicResolution>(m_pWindow->get_width(), m_pWindow->get_height());
+        if (!p_dynamic_resolution->is_ready()) {
+            LOG_CATEGORY_ERROR(Render, "Dynamic resolution is not available, scene is drawn at window resolution");
+        }
 
-        //---------------------------------------//
+        //   
+        p_shadow_maps = std::make_unique<ShadowMaps>();
+        if (!p_shadow_maps->is_ready()) {
+            LOG_CATEGORY_ERROR(Render, "Shadow maps are not available, scene is drawn without shadows");
+        }
 
-        //    
-        p_light_source_shader_program = std::make_unique<ShaderProgram>(light_source_vertex_shader, light_source_fragment_shader);
-        if (!p_light_source_shader_program->is_compiled()){
-            return false;
+        //    GPU
+        p_gpu_culling = std::make_unique<GpuCulling>(m_pWindow->get_width(), m_pWindow->get_height());
+        p_instance_field_shader_program = std::make_unique<ShaderProgram>(
+            (std::string("#version 460\n") + GpuCulling::get_shader_source() + instance_field_vertex_shader).c_str(), instance_field_fragment_shader);
+        if (!p_gpu_culling->is_ready() || !p_instance_field_shader_program->is_compiled()) {
+            LOG_CATEGORY_ERROR(Render, "GPU culling is not available, instance field is not drawn");
         }
 
+        //          
+        create_software_renderer(m_pWindow->get_width(), m_pWindow->get_height());
+        p_software_target = std::make_unique<Framebuffer>(m_pWindow->get_width(), m_pWindow->get_height(),
+            std::initializer_list<ERenderTargetFormat>{ ERenderTargetFormat::RGBA8 });
+
+        //     
+        p_depth_prepass_shader_program = std::make_unique<ShaderProgram>(depth_prepass_vertex_shader, depth_prepass_fragment_shader);
+        p_overdraw_shader_program = std::make_unique<ShaderProgram>(vertex_shader, overdraw_fragment_shader);
+        if (!p_depth_prepass_shader_program->is_compiled() || !p_overdraw_shader_program->is_compiled()) {
+            return -1;
+        }
 
         //   
         Render_OpenGL::enable_depth_test();
@@ -471,15 +1281,14 @@ namespace MyEngine {
         while (!m_bCloseWindow) {
             draw();
         }
-        m_pWindow = nullptr;
         //---------------------------------------//
 
         return 0;
 	}
 
-    //   
+    //    (    )
     glm::vec2 Application::get_current_cursor_position() const {
-        return m_pWindow->get_current_cursor_position();
+        return Input::GetMousePosition();
     }
 
     //     
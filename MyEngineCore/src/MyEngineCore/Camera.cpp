@@ -1,5 +1,6 @@
 #include "MyEngineCore/Camera.hpp"
 
+#include <glm/geometric.hpp>
 #include <glm/trigonometric.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -22,6 +23,32 @@ namespace MyEngine {
         return m_view_matrix;
     }
 
+    //    
+    const glm::mat4& Camera::get_view_projection_matrix() {
+        get_view_matrix();
+        return m_view_projection_matrix;
+    }
+
+    //    
+    std::array<glm::vec4, 6> Camera::get_frustum_planes() {
+        return get_frustum_planes(get_view_projection_matrix());
+    }
+
+    //         
+    std::array<glm::vec4, 6> Camera::get_frustum_planes(const glm::mat4& view_projection) {
+        const glm::vec4 w_row(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+        std::array<glm::vec4, 6> planes;
+        for (int i = 0; i < 3; ++i) {
+            const glm::vec4 row(view_projection[0][i], view_projection[1][i], view_projection[2][i], view_projection[3][i]);
+            planes[2 * i] = w_row + row;
+            planes[2 * i + 1] = w_row - row;
+        }
+        for (glm::vec4& plane : planes) {
+            plane /= glm::length(glm::vec3(plane));
+        }
+        return planes;
+    }
+
     //   
     void Camera::update_view_matrix() {
 
@@ -55,6 +82,7 @@ namespace MyEngine {
 
         //  
         m_view_matrix = glm::lookAt(m_position, m_position + m_direction, m_up);
+        m_view_projection_matrix = m_projection_matrix * m_view_matrix;
     }
 
     //   
@@ -77,6 +105,7 @@ namespace MyEngine {
                 0, 0, -2 / (f - n), 0,
                 0, 0, (-f - n) / (f - n), 1);
         }
+        m_view_projection_matrix = m_projection_matrix * m_view_matrix;
     }
 
     //   
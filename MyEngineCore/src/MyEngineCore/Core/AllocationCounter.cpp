@@ -0,0 +1,147 @@
+#include "AllocationCounter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace MyEngine {
+
+    //    operator new,       
+    static std::atomic<size_t> s_allocations_count{ 0 };
+    static std::atomic<size_t> s_allocated_bytes{ 0 };
+
+    //         
+    static size_t s_frame_start_allocations = 0;
+    static size_t s_frame_start_bytes = 0;
+    static size_t s_frame_allocations = 0;
+    static size_t s_frame_bytes = 0;
+    static size_t s_peak_frame_allocations = 0;
+
+    bool AllocationCounter::is_enabled() {
+#ifdef MYENGINE_COUNT_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void AllocationCounter::end_frame() {
+        const size_t allocations = s_allocations_count.load(std::memory_order_relaxed);
+        const size_t bytes = s_allocated_bytes.load(std::memory_order_relaxed);
+        s_frame_allocations = allocations - s_frame_start_allocations;
+        s_frame_bytes = bytes - s_frame_start_bytes;
+        s_peak_frame_allocations = std::max(s_peak_frame_allocations, s_frame_allocations);
+        s_frame_start_allocations = allocations;
+        s_frame_start_bytes = bytes;
+    }
+
+    size_t AllocationCounter::get_frame_allocations() {
+        return s_frame_allocations;
+    }
+
+    size_t AllocationCounter::get_frame_bytes() {
+        return s_frame_bytes;
+    }
+
+    size_t AllocationCounter::get_peak_frame_allocations() {
+        return s_peak_frame_allocations;
+    }
+
+    size_t AllocationCounter::get_total_allocations() {
+        return s_allocations_count.load(std::memory_order_relaxed);
+    }
+
+#ifdef MYENGINE_COUNT_ALLOCATIONS
+    //   
+    static void* counted_allocate(const size_t size, const size_t alignment) {
+        s_allocations_count.fetch_add(1, std::memory_order_relaxed);
+        s_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+        const size_t allocation_size = size > 0 ? size : 1;
+#ifdef _WIN32
+        return alignment > alignof(std::max_align_t) ? _aligned_malloc(allocation_size, alignment) : std::malloc(allocation_size);
+#else
+        return alignment > alignof(std::max_align_t)
+            ? std::aligned_alloc(alignment, (allocation_size + alignment - 1) / alignment * alignment) : std::malloc(allocation_size);
+#endif
+    }
+
+    static void counted_free(void* pointer, const size_t alignment) {
+#ifdef _WIN32
+        if (alignment > alignof(std::max_align_t)) {
+            _aligned_free(pointer);
+            return;
+        }
+#else
+        (void)alignment;
+#endif
+        std::free(pointer);
+    }
+#endif
+
+}
+
+#ifdef MYENGINE_COUNT_ALLOCATIONS
+//   operator new/delete
+void* operator new(const size_t size) {
+    if (void* pointer = MyEngine::counted_allocate(size, alignof(std::max_align_t))) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size) {
+    return operator new(size);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+    return MyEngine::counted_allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept {
+    return MyEngine::counted_allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment) {
+    if (void* pointer = MyEngine::counted_allocate(size, static_cast<size_t>(alignment))) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+    MyEngine::counted_free(pointer, alignof(std::max_align_t));
+}
+
+void operator delete[](void* pointer) noexcept {
+    MyEngine::counted_free(pointer, alignof(std::max_align_t));
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    MyEngine::counted_free(pointer, alignof(std::max_align_t));
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    MyEngine::counted_free(pointer, alignof(std::max_align_t));
+}
+
+void operator delete(void* pointer, const std::align_val_t alignment) noexcept {
+    MyEngine::counted_free(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, const std::align_val_t alignment) noexcept {
+    MyEngine::counted_free(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* pointer, size_t, const std::align_val_t alignment) noexcept {
+    MyEngine::counted_free(pointer, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* pointer, size_t, const std::align_val_t alignment) noexcept {
+    MyEngine::counted_free(pointer, static_cast<size_t>(alignment));
+}
+#endif
\ No newline at end of file
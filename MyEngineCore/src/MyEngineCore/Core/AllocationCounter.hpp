@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace MyEngine {
+
+    //     ().    MYENGINE_COUNT_ALLOCATIONS  operator new/delete
+    //  ,    .  -        
+    class AllocationCounter {
+    public:
+        static bool is_enabled();
+
+        //  :    
+        static void end_frame();
+
+        static size_t get_frame_allocations();
+        static size_t get_frame_bytes();
+        //     
+        static size_t get_peak_frame_allocations();
+        static size_t get_total_allocations();
+    };
+
+}
\ No newline at end of file
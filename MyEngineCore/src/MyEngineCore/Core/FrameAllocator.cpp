@@ -0,0 +1,58 @@
+#include "FrameAllocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace MyEngine {
+
+    //    
+    constexpr size_t s_frame_memory_size = 4 * 1024 * 1024;
+
+    // :     pmr 
+    struct FrameAllocatorState {
+        LinearAllocator allocators[2] = { LinearAllocator(s_frame_memory_size), LinearAllocator(s_frame_memory_size) };
+        LinearMemoryResource resources[2] = { LinearMemoryResource(allocators[0]), LinearMemoryResource(allocators[1]) };
+        std::atomic<size_t> current{ 0 };
+    };
+
+    static FrameAllocatorState& get_state() {
+        static FrameAllocatorState state;
+        return state;
+    }
+
+    LinearAllocator& FrameAllocator::get_current() {
+        FrameAllocatorState& state = get_state();
+        return state.allocators[state.current.load(std::memory_order_relaxed)];
+    }
+
+    void* FrameAllocator::allocate(const size_t size, const size_t alignment) {
+        return get_current().allocate(size, alignment);
+    }
+
+    std::pmr::memory_resource* FrameAllocator::get_resource() {
+        FrameAllocatorState& state = get_state();
+        return &state.resources[state.current.load(std::memory_order_relaxed)];
+    }
+
+    //    N - 1:      
+    void FrameAllocator::end_frame() {
+        FrameAllocatorState& state = get_state();
+        const size_t next = state.current.load(std::memory_order_relaxed) ^ 1;
+        state.allocators[next].reset();
+        state.current.store(next, std::memory_order_relaxed);
+    }
+
+    size_t FrameAllocator::get_used() {
+        return get_current().get_used();
+    }
+
+    size_t FrameAllocator::get_capacity() {
+        return get_current().get_capacity();
+    }
+
+    size_t FrameAllocator::get_peak() {
+        const FrameAllocatorState& state = get_state();
+        return std::max(state.allocators[0].get_peak(), state.allocators[1].get_peak());
+    }
+
+}
\ No newline at end of file
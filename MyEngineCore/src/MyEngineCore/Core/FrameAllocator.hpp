@@ -0,0 +1,41 @@
+#pragma once
+
+#include "LinearAllocator.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace MyEngine {
+
+    //    : FrameVector<T> values(FrameAllocator::get_resource())
+    template<typename T>
+    using FrameVector = std::pmr::vector<T>;
+
+    //    :     .    N     N + 1,
+    //      ,    .  
+    class FrameAllocator {
+    public:
+        static void* allocate(const size_t size, const size_t alignment = alignof(std::max_align_t));
+
+        template<typename T, typename... Args>
+        static T* create(Args&&... args) { return get_current().create<T>(std::forward<Args>(args)...); }
+        template<typename T>
+        static T* allocate_array(const size_t count) { return get_current().allocate_array<T>(count); }
+
+        // pmr   
+        static std::pmr::memory_resource* get_resource();
+
+        //  :        (   )
+        static void end_frame();
+
+        //    ,     
+        static size_t get_used();
+        static size_t get_capacity();
+        static size_t get_peak();
+
+    private:
+        static LinearAllocator& get_current();
+    };
+
+}
\ No newline at end of file
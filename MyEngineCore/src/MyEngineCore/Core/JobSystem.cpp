@@ -0,0 +1,453 @@
+#include "JobSystem.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace MyEngine {
+
+    //        ( )
+    constexpr int64_t s_deque_capacity = 1024;
+    constexpr size_t s_jobs_per_thread = 1024;
+    //         
+    constexpr size_t s_idle_spins_count = 64;
+
+    //  Chase-Lev  :       ,    
+    class JobDeque {
+    public:
+        //  ( ). false -  
+        bool push(Job* pJob) {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_acquire);
+            if (bottom - top >= s_deque_capacity) {
+                return false;
+            }
+            m_buffer[bottom & (s_deque_capacity - 1)].store(pJob, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_release);
+            return true;
+        }
+
+        //    ( )
+        Job* pop() {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+            if (top > bottom) {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Job* pJob = m_buffer[bottom & (s_deque_capacity - 1)].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                //  :    
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    pJob = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return pJob;
+        }
+
+        //    ( )
+        Job* steal() {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom) {
+                return nullptr;
+            }
+            Job* pJob = m_buffer[top & (s_deque_capacity - 1)].load(std::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return pJob;
+        }
+
+    private:
+        alignas(64) std::atomic<int64_t> m_top{ 0 };
+        alignas(64) std::atomic<int64_t> m_bottom{ 0 };
+        std::atomic<Job*> m_buffer[s_deque_capacity] = {};
+    };
+
+    //  : ,    
+    struct alignas(64) JobThreadData {
+        JobDeque deque;
+        std::unique_ptr<Job[]> jobs = std::make_unique<Job[]>(s_jobs_per_thread);
+        size_t next_job = 0;
+        std::atomic<size_t> jobs_executed{ 0 };
+        std::atomic<size_t> jobs_stolen{ 0 };
+    };
+
+    //   
+    struct JobSystemState {
+        std::mutex initialize_mutex;
+        std::atomic<bool> initialized{ false };
+        size_t workers_count = 0;
+        // workers_count      
+        std::unique_ptr<JobThreadData[]> threads;
+        std::vector<std::thread> workers;
+        std::mutex external_jobs_mutex;
+
+        //  :   ,      
+        std::mutex queues_mutex;
+        std::deque<Job*> shared_jobs;
+        std::deque<Job*> background_jobs;
+        std::atomic<size_t> shared_jobs_count{ 0 };
+        std::atomic<size_t> background_jobs_count{ 0 };
+
+        //    
+        std::atomic<int64_t> queued_count{ 0 };
+        std::atomic<int32_t> sleeping_count{ 0 };
+        std::mutex sleep_mutex;
+        std::condition_variable sleep_condition;
+        std::atomic<bool> stop{ false };
+    };
+
+    static JobSystemState& get_state() {
+        static JobSystemState state;
+        return state;
+    }
+
+    //   (SIZE_MAX -  )       
+    static thread_local size_t t_thread_index = SIZE_MAX;
+    static thread_local uint32_t t_random_state = 0;
+
+    static void ensure_initialized() {
+        if (!get_state().initialized.load(std::memory_order_acquire)) {
+            JobSystem::initialize();
+        }
+    }
+
+    //     
+    static void pin_current_thread(const size_t core) {
+        const size_t cores_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+#ifdef _WIN32
+        SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << (core % cores_count % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(core % cores_count % CPU_SETSIZE, &cpu_set);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#else
+        (void)core;
+        (void)cores_count;
+#endif
+    }
+
+    static void lock_dependents(Job& job) {
+        while (job.dependents_lock.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    static void unlock_dependents(Job& job) {
+        job.dependents_lock.clear(std::memory_order_release);
+    }
+
+    //         
+    static void push_job(Job* pJob) {
+        JobSystemState& state = get_state();
+        const size_t index = JobSystem::get_thread_index();
+        if (pJob->background) {
+            std::lock_guard<std::mutex> lock(state.queues_mutex);
+            state.background_jobs.push_back(pJob);
+            state.background_jobs_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (index >= state.workers_count || !state.threads[index].deque.push(pJob)) {
+            std::lock_guard<std::mutex> lock(state.queues_mutex);
+            state.shared_jobs.push_back(pJob);
+            state.shared_jobs_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        //      (   - )   
+        state.queued_count.fetch_add(1, std::memory_order_seq_cst);
+        if (state.sleeping_count.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(state.sleep_mutex);
+            state.sleep_condition.notify_one();
+        }
+    }
+
+    //    
+    static Job* pop_queue(std::deque<Job*>& jobs, std::atomic<size_t>& jobs_count) {
+        if (jobs_count.load(std::memory_order_relaxed) == 0) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(get_state().queues_mutex);
+        if (jobs.empty()) {
+            return nullptr;
+        }
+        Job* pJob = jobs.front();
+        jobs.pop_front();
+        jobs_count.fetch_sub(1, std::memory_order_relaxed);
+        return pJob;
+    }
+
+    //  :  ,  ,    ,  
+    static Job* take_job(const size_t index, const bool allow_background) {
+        JobSystemState& state = get_state();
+        Job* pJob = nullptr;
+        if (index < state.workers_count) {
+            pJob = state.threads[index].deque.pop();
+        }
+        if (!pJob) {
+            pJob = pop_queue(state.shared_jobs, state.shared_jobs_count);
+        }
+        if (!pJob && state.workers_count > 1) {
+            t_random_state = t_random_state * 1664525u + 1013904223u;
+            const size_t first_victim = (t_random_state >> 8) % state.workers_count;
+            for (size_t i = 0; i < state.workers_count && !pJob; ++i) {
+                const size_t victim = (first_victim + i) % state.workers_count;
+                if (victim != index) {
+                    pJob = state.threads[victim].deque.steal();
+                }
+            }
+            if (pJob) {
+                state.threads[index].jobs_stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (!pJob && allow_background) {
+            pJob = pop_queue(state.background_jobs, state.background_jobs_count);
+        }
+        if (pJob) {
+            state.queued_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return pJob;
+    }
+
+    //  :   ,   
+    static void finish_job(Job* pJob) {
+        while (pJob && pJob->unfinished_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Job* dependents[Job::s_max_dependents];
+            lock_dependents(*pJob);
+            pJob->finished = true;
+            const uint32_t dependents_count = pJob->dependents_count;
+            std::copy(pJob->dependents, pJob->dependents + dependents_count, dependents);
+            unlock_dependents(*pJob);
+            for (uint32_t i = 0; i < dependents_count; ++i) {
+                if (dependents[i]->pending_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    push_job(dependents[i]);
+                }
+            }
+            Job* pParent = pJob->pParent;
+            pJob->generation.fetch_add(1, std::memory_order_release);
+            pJob->in_use.store(false, std::memory_order_release);
+            pJob = pParent;
+        }
+    }
+
+    static void execute_job(const size_t index, Job* pJob) {
+        pJob->function(pJob->data);
+        get_state().threads[index].jobs_executed.fetch_add(1, std::memory_order_relaxed);
+        finish_job(pJob);
+    }
+
+    //  :  ,   ,   
+    static void worker_loop(const size_t index, const bool pin_thread) {
+        JobSystemState& state = get_state();
+        t_thread_index = index;
+        t_random_state = static_cast<uint32_t>(index * 2654435761u);
+        if (pin_thread) {
+            pin_current_thread(index);
+        }
+        size_t idle_spins = 0;
+        while (!state.stop.load(std::memory_order_acquire)) {
+            if (Job* pJob = take_job(index, true)) {
+                execute_job(index, pJob);
+                idle_spins = 0;
+                continue;
+            }
+            if (++idle_spins < s_idle_spins_count) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(state.sleep_mutex);
+            state.sleeping_count.fetch_add(1, std::memory_order_seq_cst);
+            state.sleep_condition.wait(lock, [&state]() {
+                return state.queued_count.load(std::memory_order_seq_cst) > 0 || state.stop.load(std::memory_order_acquire);
+            });
+            state.sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+            idle_spins = 0;
+        }
+    }
+
+    //   .   ,      
+    void JobSystem::initialize(const size_t workers_count, const bool pin_threads) {
+        JobSystemState& state = get_state();
+        std::lock_guard<std::mutex> lock(state.initialize_mutex);
+        if (state.initialized.load(std::memory_order_relaxed)) {
+            return;
+        }
+        state.workers_count = std::max<size_t>(2, workers_count > 0 ? workers_count : std::thread::hardware_concurrency());
+        state.threads = std::make_unique<JobThreadData[]>(state.workers_count + 1);
+        state.stop.store(false, std::memory_order_relaxed);
+        t_thread_index = 0;
+        if (pin_threads) {
+            pin_current_thread(0);
+        }
+        for (size_t i = 1; i < state.workers_count; ++i) {
+            state.workers.emplace_back(worker_loop, i, pin_threads);
+        }
+        state.initialized.store(true, std::memory_order_release);
+        LOG_CATEGORY_INFO(Jobs, "JobSystem: {0} workers{1}", state.workers_count, pin_threads ? ", pinned to cores" : "");
+    }
+
+    //   
+    void JobSystem::shutdown() {
+        JobSystemState& state = get_state();
+        std::lock_guard<std::mutex> lock(state.initialize_mutex);
+        if (!state.initialized.load(std::memory_order_relaxed)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> sleep_lock(state.sleep_mutex);
+            state.stop.store(true, std::memory_order_release);
+        }
+        state.sleep_condition.notify_all();
+        for (std::thread& worker : state.workers) {
+            worker.join();
+        }
+        state.workers.clear();
+        state.shared_jobs.clear();
+        state.background_jobs.clear();
+        state.shared_jobs_count.store(0, std::memory_order_relaxed);
+        state.background_jobs_count.store(0, std::memory_order_relaxed);
+        state.queued_count.store(0, std::memory_order_relaxed);
+        state.threads.reset();
+        state.workers_count = 0;
+        state.initialized.store(false, std::memory_order_release);
+    }
+
+    size_t JobSystem::get_workers_count() {
+        ensure_initialized();
+        return get_state().workers_count;
+    }
+
+    size_t JobSystem::get_thread_index() {
+        ensure_initialized();
+        return std::min(t_thread_index, get_state().workers_count);
+    }
+
+    //      .    -  ,    
+    JobHandle JobSystem::allocate_job(const JobHandle parent, const bool background) {
+        JobSystemState& state = get_state();
+        const size_t index = get_thread_index();
+        const bool external = index == state.workers_count;
+        JobThreadData& thread = state.threads[index];
+        while (true) {
+            if (external) {
+                state.external_jobs_mutex.lock();
+            }
+            for (size_t attempt = 0; attempt < s_jobs_per_thread; ++attempt) {
+                Job& job = thread.jobs[thread.next_job++ & (s_jobs_per_thread - 1)];
+                if (job.in_use.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                job.in_use.store(true, std::memory_order_relaxed);
+                if (external) {
+                    state.external_jobs_mutex.unlock();
+                }
+                job.function = nullptr;
+                job.pParent = parent.pJob;
+                if (parent.pJob) {
+                    parent.pJob->unfinished_count.fetch_add(1, std::memory_order_relaxed);
+                }
+                job.unfinished_count.store(1, std::memory_order_relaxed);
+                job.pending_count.store(1, std::memory_order_relaxed);
+                job.background = background;
+                lock_dependents(job);
+                job.finished = false;
+                job.dependents_count = 0;
+                unlock_dependents(job);
+                return JobHandle{ &job, job.generation.load(std::memory_order_relaxed) };
+            }
+            if (external) {
+                state.external_jobs_mutex.unlock();
+            }
+            if (Job* pJob = take_job(index, index != 0)) {
+                execute_job(index, pJob);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    //  ,   dependency   
+    bool JobSystem::add_dependency(const JobHandle job, const JobHandle dependency) {
+        if (!job.is_valid() || !dependency.is_valid()) {
+            return true;
+        }
+        Job& target = *dependency.pJob;
+        lock_dependents(target);
+        if (target.generation.load(std::memory_order_relaxed) != dependency.generation || target.finished) {
+            unlock_dependents(target);
+            return true;
+        }
+        if (target.dependents_count == Job::s_max_dependents) {
+            unlock_dependents(target);
+            LOG_CATEGORY_ERROR(Jobs, "JobSystem: more than {0} dependents of one job", Job::s_max_dependents);
+            return false;
+        }
+        target.dependents[target.dependents_count++] = job.pJob;
+        job.pJob->pending_count.fetch_add(1, std::memory_order_relaxed);
+        unlock_dependents(target);
+        return true;
+    }
+
+    void JobSystem::run(const JobHandle job) {
+        if (job.is_valid() && job.pJob->pending_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            push_job(job.pJob);
+        }
+    }
+
+    //   ( )     
+    bool JobSystem::is_finished(const JobHandle job) {
+        if (!job.is_valid()) {
+            return true;
+        }
+        return job.pJob->generation.load(std::memory_order_acquire) != job.generation ||
+            job.pJob->unfinished_count.load(std::memory_order_acquire) == 0;
+    }
+
+    //   :      ,    
+    void JobSystem::wait(const JobHandle job) {
+        const size_t index = get_thread_index();
+        while (!is_finished(job)) {
+            if (Job* pJob = take_job(index, index != 0)) {
+                execute_job(index, pJob);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    JobSystem::Stats JobSystem::get_stats() {
+        JobSystemState& state = get_state();
+        Stats stats;
+        if (!state.initialized.load(std::memory_order_acquire)) {
+            return stats;
+        }
+        stats.workers_count = state.workers_count;
+        for (size_t i = 0; i <= state.workers_count; ++i) {
+            stats.jobs_executed += state.threads[i].jobs_executed.load(std::memory_order_relaxed);
+            stats.jobs_stolen += state.threads[i].jobs_stolen.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+}
\ No newline at end of file
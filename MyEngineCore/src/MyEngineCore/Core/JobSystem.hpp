@@ -0,0 +1,118 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MyEngine {
+
+    //   .        , 
+    //      (  s_data_size  -  )
+    struct alignas(64) Job {
+        static constexpr size_t s_data_size = 64;
+        static constexpr size_t s_max_dependents = 8;
+
+        //     
+        void (*function)(void* data) = nullptr;
+        Job* pParent = nullptr;
+        //       
+        std::atomic<int32_t> unfinished_count{ 0 };
+        //       run
+        std::atomic<int32_t> pending_count{ 0 };
+        //  :   ,    
+        std::atomic<uint32_t> generation{ 0 };
+        std::atomic<bool> in_use{ false };
+        //         
+        bool background = false;
+
+        // ,    ( dependents_lock)
+        std::atomic_flag dependents_lock = ATOMIC_FLAG_INIT;
+        bool finished = false;
+        uint32_t dependents_count = 0;
+        Job* dependents[s_max_dependents] = {};
+
+        alignas(16) unsigned char data[s_data_size];
+    };
+
+    //  
+    struct JobHandle {
+        Job* pJob = nullptr;
+        uint32_t generation = 0;
+
+        bool is_valid() const { return pJob != nullptr; }
+    };
+
+    //  :      (  -   ),     
+    // Chase-Lev,       .      
+    // (    )   (      
+    // ).    ,     
+    class JobSystem {
+    public:
+        // 
+        struct Stats {
+            size_t workers_count = 0;
+            size_t jobs_executed = 0;
+            size_t jobs_stolen = 0;
+        };
+
+        // : workers_count = 0 -   , pin_threads -    .
+        //    .        
+        static void initialize(const size_t workers_count = 0, const bool pin_threads = false);
+        //    (    )
+        static void shutdown();
+
+        //  ,  ,   
+        static size_t get_workers_count();
+        //   : 0 - , 1..N-1 - , N -  
+        static size_t get_thread_index();
+
+        //  .  ( )     .
+        //      run,      
+        template<typename Function>
+        static JobHandle create_job(Function&& function, const JobHandle parent = JobHandle(), const bool background = false) {
+            using Callable = std::decay_t<Function>;
+            static_assert(sizeof(Callable) <= Job::s_data_size, "Job capture is too large, capture a pointer instead");
+            static_assert(alignof(Callable) <= 16, "Job capture alignment is too large");
+            const JobHandle handle = allocate_job(parent, background);
+            new (handle.pJob->data) Callable(std::forward<Function>(function));
+            handle.pJob->function = [](void* data) {
+                Callable& callable = *static_cast<Callable*>(data);
+                callable();
+                callable.~Callable();
+            };
+            return handle;
+        }
+        //  job     dependency (  run). false -  s_max_dependents
+        static bool add_dependency(const JobHandle job, const JobHandle dependency);
+        //     (   )
+        static void run(const JobHandle job);
+
+        //     
+        template<typename Function>
+        static JobHandle schedule(Function&& function, const JobHandle parent = JobHandle()) {
+            const JobHandle handle = create_job(std::forward<Function>(function), parent);
+            run(handle);
+            return handle;
+        }
+        //   ( : , ).   ,    
+        template<typename Function>
+        static JobHandle schedule_background(Function&& function) {
+            const JobHandle handle = create_job(std::forward<Function>(function), JobHandle(), true);
+            run(handle);
+            return handle;
+        }
+
+        static bool is_finished(const JobHandle job);
+        //     
+        static void wait(const JobHandle job);
+
+        static Stats get_stats();
+
+    private:
+        static JobHandle allocate_job(const JobHandle parent, const bool background);
+    };
+
+}
\ No newline at end of file
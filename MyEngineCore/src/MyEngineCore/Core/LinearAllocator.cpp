@@ -0,0 +1,74 @@
+#include "LinearAllocator.hpp"
+
+#include <algorithm>
+
+namespace MyEngine {
+
+    //    ( )
+    constexpr size_t s_buffer_alignment = 64;
+
+    static unsigned char* allocate_buffer(const size_t capacity) {
+        return static_cast<unsigned char*>(::operator new(capacity, std::align_val_t(s_buffer_alignment)));
+    }
+
+    static void free_buffer(unsigned char* pBuffer) {
+        ::operator delete(pBuffer, std::align_val_t(s_buffer_alignment));
+    }
+
+    // 
+    LinearAllocator::LinearAllocator(const size_t capacity)
+        : m_pBuffer(allocate_buffer(std::max<size_t>(capacity, s_buffer_alignment))), m_capacity(std::max<size_t>(capacity, s_buffer_alignment)) {
+    }
+
+    // 
+    LinearAllocator::~LinearAllocator() {
+        reset();
+        free_buffer(m_pBuffer);
+    }
+
+    //    ,    -   
+    void* LinearAllocator::allocate(const size_t size, const size_t alignment) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_pBuffer);
+        size_t offset = m_offset.load(std::memory_order_relaxed);
+        while (true) {
+            const size_t aligned_offset = ((base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+            if (aligned_offset + size > m_capacity) {
+                break;
+            }
+            if (m_offset.compare_exchange_weak(offset, aligned_offset + size, std::memory_order_relaxed)) {
+                return m_pBuffer + aligned_offset;
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_overflow_mutex);
+        void* pData = ::operator new(size, std::align_val_t(alignment));
+        m_overflow_blocks.push_back({ pData, alignment });
+        m_overflow_bytes.fetch_add(size, std::memory_order_relaxed);
+        return pData;
+    }
+
+    size_t LinearAllocator::get_used() const {
+        return std::min(m_offset.load(std::memory_order_relaxed), m_capacity) + m_overflow_bytes.load(std::memory_order_relaxed);
+    }
+
+    // :    ,      
+    void LinearAllocator::reset() {
+        const size_t used = get_used();
+        m_peak = std::max(m_peak, used);
+        for (const OverflowBlock& block : m_overflow_blocks) {
+            ::operator delete(block.pData, std::align_val_t(block.alignment));
+        }
+        if (!m_overflow_blocks.empty()) {
+            size_t capacity = m_capacity;
+            while (capacity < used) {
+                capacity *= 2;
+            }
+            free_buffer(m_pBuffer);
+            m_pBuffer = allocate_buffer(capacity);
+            m_capacity = capacity;
+        }
+        m_overflow_blocks.clear();
+        m_overflow_bytes.store(0, std::memory_order_relaxed);
+        m_offset.store(0, std::memory_order_relaxed);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MyEngine {
+
+    //  :  -    (   ),  -  
+    //   reset.    ,    ,   reset     ,
+    //       .     
+    class LinearAllocator {
+    public:
+        explicit LinearAllocator(const size_t capacity = 1024 * 1024);
+        ~LinearAllocator();
+
+        //      
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator& operator=(const LinearAllocator&) = delete;
+        LinearAllocator& operator=(LinearAllocator&&) = delete;
+        LinearAllocator(LinearAllocator&&) = delete;
+
+        void* allocate(const size_t size, const size_t alignment = alignof(std::max_align_t));
+
+        template<typename T, typename... Args>
+        T* create(Args&&... args) {
+            static_assert(std::is_trivially_destructible_v<T>, "LinearAllocator does not call destructors");
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        template<typename T>
+        T* allocate_array(const size_t count) {
+            static_assert(std::is_trivially_destructible_v<T>, "LinearAllocator does not call destructors");
+            T* pArray = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+            for (size_t i = 0; i < count; ++i) {
+                new (pArray + i) T();
+            }
+            return pArray;
+        }
+
+        //    (      )
+        void reset();
+
+        size_t get_capacity() const { return m_capacity; }
+        //    reset (    )
+        size_t get_used() const;
+        size_t get_peak() const { return m_peak; }
+        //      reset
+        size_t get_overflow_count() const { return m_overflow_blocks.size(); }
+
+    private:
+        //     
+        struct OverflowBlock {
+            void* pData = nullptr;
+            size_t alignment = 0;
+        };
+
+        unsigned char* m_pBuffer = nullptr;
+        size_t m_capacity = 0;
+        std::atomic<size_t> m_offset{ 0 };
+        size_t m_peak = 0;
+
+        std::mutex m_overflow_mutex;
+        std::vector<OverflowBlock> m_overflow_blocks;
+        std::atomic<size_t> m_overflow_bytes{ 0 };
+    };
+
+    //  pmr:  std::pmr      ( )
+    class LinearMemoryResource : public std::pmr::memory_resource {
+    public:
+        explicit LinearMemoryResource(LinearAllocator& allocator) : m_allocator(allocator) {}
+
+    private:
+        void* do_allocate(const size_t bytes, const size_t alignment) override { return m_allocator.allocate(bytes, alignment); }
+        void do_deallocate(void*, const size_t, const size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        LinearAllocator& m_allocator;
+    };
+
+}
\ No newline at end of file
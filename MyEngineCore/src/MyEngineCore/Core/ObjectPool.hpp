@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace MyEngine {
+
+    //    :     block_size ,     
+    //   ,     create/destroy    .   
+    template<typename T>
+    class ObjectPool {
+    public:
+        explicit ObjectPool(const size_t block_size = 256) : m_block_size(block_size > 0 ? block_size : 1) {}
+        // ,    destroy,  
+        ~ObjectPool() = default;
+
+        //      
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+        ObjectPool& operator=(ObjectPool&&) = delete;
+        ObjectPool(ObjectPool&&) = delete;
+
+        template<typename... Args>
+        T* create(Args&&... args) {
+            if (!m_pFree) {
+                add_block();
+            }
+            Slot* pSlot = m_pFree;
+            m_pFree = pSlot->pNext;
+            ++m_alive_count;
+            return new (pSlot->storage) T(std::forward<Args>(args)...);
+        }
+
+        void destroy(T* pObject) {
+            if (!pObject) {
+                return;
+            }
+            pObject->~T();
+            Slot* pSlot = reinterpret_cast<Slot*>(pObject);
+            pSlot->pNext = m_pFree;
+            m_pFree = pSlot;
+            --m_alive_count;
+        }
+
+        //   
+        void reserve(const size_t count) {
+            while (get_capacity() < count) {
+                add_block();
+            }
+        }
+
+        size_t get_alive_count() const { return m_alive_count; }
+        size_t get_capacity() const { return m_blocks.size() * m_block_size; }
+
+    private:
+        // :       
+        union Slot {
+            Slot* pNext;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        void add_block() {
+            m_blocks.push_back(std::make_unique<Slot[]>(m_block_size));
+            Slot* pBlock = m_blocks.back().get();
+            for (size_t i = m_block_size; i > 0; --i) {
+                pBlock[i - 1].pNext = m_pFree;
+                m_pFree = &pBlock[i - 1];
+            }
+        }
+
+        std::vector<std::unique_ptr<Slot[]>> m_blocks;
+        Slot* m_pFree = nullptr;
+        size_t m_block_size;
+        size_t m_alive_count = 0;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace MyEngine {
+
+    //     
+    inline size_t get_workers_count() {
+        return JobSystem::get_workers_count();
+    }
+
+    //   :      (    ),   
+    template<typename Function>
+    void parallel_for_range(const JobHandle parent, const size_t begin, size_t end, const size_t grain, Function& function) {
+        while (end - begin >= 2 * grain) {
+            const size_t middle = begin + (end - begin) / 2;
+            JobSystem::schedule([parent, middle, end, grain, &function]() {
+                parallel_for_range(parent, middle, end, grain, function);
+            }, parent);
+            end = middle;
+        }
+        function(begin, end);
+    }
+
+    //  [0, count)     grain       .
+    // function(begin, end)    ,      
+    template<typename Function>
+    void parallel_for(const size_t count, const size_t grain, Function&& function) {
+        if (count == 0) {
+            return;
+        }
+        const size_t step = std::max<size_t>(grain, 1);
+        if (count < 2 * step) {
+            function(size_t(0), count);
+            return;
+        }
+        const JobHandle root = JobSystem::create_job([]() {});
+        parallel_for_range(root, 0, count, step, function);
+        JobSystem::run(root);
+        JobSystem::wait(root);
+    }
+
+    //   :    <, ==  >       ,
+    //   .    grain   std::sort
+    template<typename Iterator, typename Compare>
+    void parallel_sort_range(const JobHandle parent, Iterator begin, Iterator end, const size_t grain, Compare& compare) {
+        while (static_cast<size_t>(std::distance(begin, end)) > grain) {
+            //   -  ,   
+            const Iterator middle = begin + std::distance(begin, end) / 2;
+            const Iterator last = end - 1;
+            auto pivot = compare(*begin, *middle)
+                ? (compare(*middle, *last) ? *middle : (compare(*begin, *last) ? *last : *begin))
+                : (compare(*begin, *last) ? *begin : (compare(*middle, *last) ? *last : *middle));
+            const Iterator less_end = std::partition(begin, end, [&](const auto& value) { return compare(value, pivot); });
+            const Iterator equal_end = std::partition(less_end, end, [&](const auto& value) { return !compare(pivot, value); });
+            if (std::distance(begin, less_end) > 1) {
+                JobSystem::schedule([parent, begin, less_end, grain, &compare]() {
+                    parallel_sort_range(parent, begin, less_end, grain, compare);
+                }, parent);
+            }
+            begin = equal_end;
+        }
+        std::sort(begin, end, compare);
+    }
+
+    //     ( )
+    template<typename Iterator, typename Compare = std::less<>>
+    void parallel_sort(const Iterator begin, const Iterator end, Compare compare = Compare(), const size_t grain = 4096) {
+        if (static_cast<size_t>(std::distance(begin, end)) <= std::max<size_t>(grain, 1)) {
+            std::sort(begin, end, compare);
+            return;
+        }
+        const JobHandle root = JobSystem::create_job([]() {});
+        parallel_sort_range(root, begin, end, std::max<size_t>(grain, 1), compare);
+        JobSystem::run(root);
+        JobSystem::wait(root);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include "RingAllocator.hpp"
+
+namespace MyEngine {
+
+    // 
+    RingAllocator::RingAllocator(const size_t size, const size_t alignment)
+        : m_alignment(alignment > 0 ? alignment : 1), m_size(size / m_alignment * m_alignment) {
+    }
+
+    // :       ,      
+    bool RingAllocator::allocate(const size_t size, size_t& offset, size_t& allocated_size) {
+        const size_t aligned_size = (size + m_alignment - 1) / m_alignment * m_alignment;
+        if (aligned_size == 0 || aligned_size > m_size) {
+            return false;
+        }
+        const bool wrap = m_head + aligned_size > m_size;
+        const size_t wasted = wrap ? m_size - m_head : 0;
+        if (m_used + wasted + aligned_size > m_size) {
+            return false;
+        }
+        offset = wrap ? 0 : m_head;
+        allocated_size = wasted + aligned_size;
+        m_head = offset + aligned_size;
+        if (m_head == m_size) {
+            m_head = 0;
+        }
+        m_used += allocated_size;
+        return true;
+    }
+
+    // :      
+    void RingAllocator::release(const size_t allocated_size) {
+        m_used -= allocated_size <= m_used ? allocated_size : m_used;
+        if (m_used == 0) {
+            m_head = 0;
+        }
+    }
+}
\ No newline at end of file
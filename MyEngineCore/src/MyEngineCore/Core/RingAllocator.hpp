@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+namespace MyEngine {
+
+    //   :         (FIFO).
+    //      :      ,  ,  
+    //    (    allocated_size     ).
+    //    -       (,   PBO)
+    class RingAllocator {
+    public:
+        //       alignment
+        explicit RingAllocator(const size_t size = 0, const size_t alignment = 1);
+
+        //  size : offset -  , allocated_size -    release. false -  
+        bool allocate(const size_t size, size_t& offset, size_t& allocated_size);
+        //    
+        void release(const size_t allocated_size);
+
+        size_t get_size() const { return m_size; }
+        size_t get_used() const { return m_used; }
+
+    private:
+        size_t m_alignment;
+        size_t m_size;
+        //       (   )
+        size_t m_head = 0;
+        size_t m_used = 0;
+    };
+
+}
\ No newline at end of file
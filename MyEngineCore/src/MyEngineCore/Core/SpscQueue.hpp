@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace MyEngine {
+
+    //          ( ,  ).
+    //         ,      
+    template<typename T, size_t Capacity>
+    class SpscQueue {
+        static_assert((Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+    public:
+        //   . false -  
+        bool push(const T& value) {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_cached_head == Capacity) {
+                m_cached_head = m_head.load(std::memory_order_acquire);
+                if (tail - m_cached_head == Capacity) {
+                    return false;
+                }
+            }
+            m_items[tail & (Capacity - 1)] = value;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        //   . false -  
+        bool pop(T& value) {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_cached_tail) {
+                m_cached_tail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cached_tail) {
+                    return false;
+                }
+            }
+            value = m_items[head & (Capacity - 1)];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        //   (   ,       )
+        size_t size() const {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+
+    private:
+        //  :        
+        alignas(64) std::atomic<size_t> m_head{ 0 };
+        size_t m_cached_tail = 0;
+        //  
+        alignas(64) std::atomic<size_t> m_tail{ 0 };
+        size_t m_cached_head = 0;
+        alignas(64) std::array<T, Capacity> m_items{};
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include "TransformBatch.hpp"
+#include "Parallel.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+
+//  SSE  AVX2    x86.   AVX2   target (GCC  Clang),
+//     -mavx2     
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define MYENGINE_TRANSFORM_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define MYENGINE_TARGET_SSE
+        #define MYENGINE_TARGET_AVX2
+    #else
+        #define MYENGINE_TARGET_SSE __attribute__((target("sse2")))
+        #define MYENGINE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #endif
+#endif
+
+namespace MyEngine {
+
+    void TransformsSoA::resize(const size_t count) {
+        for (std::vector<float>* pComponent : { &position_x, &position_y, &position_z, &rotation_x, &rotation_y, &rotation_z, &scale_x, &scale_y, &scale_z }) {
+            pComponent->resize(count, pComponent == &scale_x || pComponent == &scale_y || pComponent == &scale_z ? 1.f : 0.f);
+        }
+        rotation_w.resize(count, 1.f);
+    }
+
+    void TransformsSoA::set(const size_t index, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+        position_x[index] = position.x;
+        position_y[index] = position.y;
+        position_z[index] = position.z;
+        rotation_x[index] = rotation.x;
+        rotation_y[index] = rotation.y;
+        rotation_z[index] = rotation.z;
+        rotation_w[index] = rotation.w;
+        scale_x[index] = scale.x;
+        scale_y[index] = scale.y;
+        scale_z[index] = scale.z;
+    }
+
+    //  :      SSE
+    static void calculate_scalar(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection, ObjectMatrices* pOut,
+        const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const float x = transforms.rotation_x[i];
+            const float y = transforms.rotation_y[i];
+            const float z = transforms.rotation_z[i];
+            const float w = transforms.rotation_w[i];
+            const float sx = transforms.scale_x[i];
+            const float sy = transforms.scale_y[i];
+            const float sz = transforms.scale_z[i];
+
+            //   :  ,   ,  
+            const glm::vec4 model[4] = {
+                glm::vec4(1.f - 2.f * (y * y + z * z), 2.f * (x * y + w * z), 2.f * (x * z - w * y), 0.f) * sx,
+                glm::vec4(2.f * (x * y - w * z), 1.f - 2.f * (x * x + z * z), 2.f * (y * z + w * x), 0.f) * sy,
+                glm::vec4(2.f * (x * z + w * y), 2.f * (y * z - w * x), 1.f - 2.f * (x * x + y * y), 0.f) * sz,
+                glm::vec4(transforms.position_x[i], transforms.position_y[i], transforms.position_z[i], 1.f)
+            };
+
+            ObjectMatrices& out = pOut[i];
+            for (int column = 0; column < 4; ++column) {
+                out.model_view[column] = view * model[column];
+                out.mvp[column] = view_projection * model[column];
+            }
+            if (sx == sy && sy == sz) {
+                const float inverse_scale = 1.f / (sx * sx);
+                for (int column = 0; column < 3; ++column) {
+                    out.normal[column] = out.model_view[column] * inverse_scale;
+                }
+            }
+            else {
+                out.normal[0] = out.model_view[0] * (1.f / (sx * sx));
+                out.normal[1] = out.model_view[1] * (1.f / (sy * sy));
+                out.normal[2] = out.model_view[2] * (1.f / (sz * sz));
+            }
+        }
+    }
+
+#if defined(MYENGINE_TRANSFORM_X86)
+
+    //   float : 4  model-view, 4  MVP, 3  
+    constexpr int s_output_groups = 11;
+
+    //   4 :    SoA,        
+    MYENGINE_TARGET_SSE static void calculate_sse(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection,
+        ObjectMatrices* pOut, const size_t begin, const size_t end) {
+        __m128 view_columns[4][3];
+        __m128 view_projection_columns[4][4];
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                if (row < 3) {
+                    view_columns[column][row] = _mm_set1_ps(view[column][row]);
+                }
+                view_projection_columns[column][row] = _mm_set1_ps(view_projection[column][row]);
+            }
+        }
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 two = _mm_set1_ps(2.f);
+        const __m128 zero = _mm_setzero_ps();
+
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            const __m128 x = _mm_loadu_ps(&transforms.rotation_x[i]);
+            const __m128 y = _mm_loadu_ps(&transforms.rotation_y[i]);
+            const __m128 z = _mm_loadu_ps(&transforms.rotation_z[i]);
+            const __m128 w = _mm_loadu_ps(&transforms.rotation_w[i]);
+            const __m128 sx = _mm_loadu_ps(&transforms.scale_x[i]);
+            const __m128 sy = _mm_loadu_ps(&transforms.scale_y[i]);
+            const __m128 sz = _mm_loadu_ps(&transforms.scale_z[i]);
+            const __m128 position[3] = { _mm_loadu_ps(&transforms.position_x[i]), _mm_loadu_ps(&transforms.position_y[i]),
+                _mm_loadu_ps(&transforms.position_z[i]) };
+
+            const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+            const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+            const __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+            const __m128 model[3][3] = {
+                { _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx), _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx),
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx) },
+                { _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy), _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy),
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy) },
+                { _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz), _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz),
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz) }
+            };
+
+            __m128 output[s_output_groups][4];
+            for (int column = 0; column < 3; ++column) {
+                for (int row = 0; row < 3; ++row) {
+                    output[column][row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(view_columns[0][row], model[column][0]),
+                        _mm_mul_ps(view_columns[1][row], model[column][1])), _mm_mul_ps(view_columns[2][row], model[column][2]));
+                }
+                output[column][3] = zero;
+                for (int row = 0; row < 4; ++row) {
+                    output[4 + column][row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(view_projection_columns[0][row], model[column][0]),
+                        _mm_mul_ps(view_projection_columns[1][row], model[column][1])), _mm_mul_ps(view_projection_columns[2][row], model[column][2]));
+                }
+            }
+            for (int row = 0; row < 4; ++row) {
+                const __m128 translation = _mm_add_ps(_mm_add_ps(_mm_mul_ps(view_projection_columns[0][row], position[0]),
+                    _mm_mul_ps(view_projection_columns[1][row], position[1])),
+                    _mm_add_ps(_mm_mul_ps(view_projection_columns[2][row], position[2]), view_projection_columns[3][row]));
+                output[7][row] = translation;
+                if (row < 3) {
+                    output[3][row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(view_columns[0][row], position[0]),
+                        _mm_mul_ps(view_columns[1][row], position[1])),
+                        _mm_add_ps(_mm_mul_ps(view_columns[2][row], position[2]), _mm_set1_ps(view[3][row])));
+                }
+            }
+            output[3][3] = one;
+
+            // :  model-view,     (   -  )
+            __m128 inverse_scale[3];
+            const __m128 uniform = _mm_and_ps(_mm_cmpeq_ps(sx, sy), _mm_cmpeq_ps(sy, sz));
+            if (_mm_movemask_ps(uniform) == 0xF) {
+                inverse_scale[0] = inverse_scale[1] = inverse_scale[2] = _mm_div_ps(one, _mm_mul_ps(sx, sx));
+            }
+            else {
+                inverse_scale[0] = _mm_div_ps(one, _mm_mul_ps(sx, sx));
+                inverse_scale[1] = _mm_div_ps(one, _mm_mul_ps(sy, sy));
+                inverse_scale[2] = _mm_div_ps(one, _mm_mul_ps(sz, sz));
+            }
+            for (int column = 0; column < 3; ++column) {
+                for (int row = 0; row < 3; ++row) {
+                    output[8 + column][row] = _mm_mul_ps(output[column][row], inverse_scale[column]);
+                }
+                output[8 + column][3] = zero;
+            }
+
+            //    (   GPU),     
+            for (int group = 0; group < s_output_groups; ++group) {
+                _MM_TRANSPOSE4_PS(output[group][0], output[group][1], output[group][2], output[group][3]);
+            }
+            float* pDestination = reinterpret_cast<float*>(pOut + i);
+            for (int object = 0; object < 4; ++object) {
+                for (int group = 0; group < s_output_groups; ++group) {
+                    _mm_stream_ps(pDestination + 44 * object + 4 * group, output[group][object]);
+                }
+            }
+        }
+        _mm_sfence();
+        calculate_scalar(transforms, view, view_projection, pOut, i, end);
+    }
+
+    //   8   FMA.    128- :   -  0..3,  - 4..7
+    MYENGINE_TARGET_AVX2 static void calculate_avx2(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection,
+        ObjectMatrices* pOut, const size_t begin, const size_t end) {
+        __m256 view_columns[4][3];
+        __m256 view_projection_columns[4][4];
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                if (row < 3) {
+                    view_columns[column][row] = _mm256_set1_ps(view[column][row]);
+                }
+                view_projection_columns[column][row] = _mm256_set1_ps(view_projection[column][row]);
+            }
+        }
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 two = _mm256_set1_ps(2.f);
+        const __m256 zero = _mm256_setzero_ps();
+
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            const __m256 x = _mm256_loadu_ps(&transforms.rotation_x[i]);
+            const __m256 y = _mm256_loadu_ps(&transforms.rotation_y[i]);
+            const __m256 z = _mm256_loadu_ps(&transforms.rotation_z[i]);
+            const __m256 w = _mm256_loadu_ps(&transforms.rotation_w[i]);
+            const __m256 sx = _mm256_loadu_ps(&transforms.scale_x[i]);
+            const __m256 sy = _mm256_loadu_ps(&transforms.scale_y[i]);
+            const __m256 sz = _mm256_loadu_ps(&transforms.scale_z[i]);
+            const __m256 position[3] = { _mm256_loadu_ps(&transforms.position_x[i]), _mm256_loadu_ps(&transforms.position_y[i]),
+                _mm256_loadu_ps(&transforms.position_z[i]) };
+
+            const __m256 xx = _mm256_mul_ps(x, x), yy = _mm256_mul_ps(y, y), zz = _mm256_mul_ps(z, z);
+            const __m256 xy = _mm256_mul_ps(x, y), xz = _mm256_mul_ps(x, z), yz = _mm256_mul_ps(y, z);
+            const __m256 wx = _mm256_mul_ps(w, x), wy = _mm256_mul_ps(w, y), wz = _mm256_mul_ps(w, z);
+            const __m256 model[3][3] = {
+                { _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one), sx), _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xy, wz)), sx),
+                    _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xz, wy)), sx) },
+                { _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(xy, wz)), sy), _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one), sy),
+                    _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(yz, wx)), sy) },
+                { _mm256_mul_ps(_mm256_mul_ps(two, _mm256_add_ps(xz, wy)), sz), _mm256_mul_ps(_mm256_mul_ps(two, _mm256_sub_ps(yz, wx)), sz),
+                    _mm256_mul_ps(_mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one), sz) }
+            };
+
+            __m256 output[s_output_groups][4];
+            for (int column = 0; column < 3; ++column) {
+                for (int row = 0; row < 3; ++row) {
+                    output[column][row] = _mm256_fmadd_ps(view_columns[2][row], model[column][2],
+                        _mm256_fmadd_ps(view_columns[1][row], model[column][1], _mm256_mul_ps(view_columns[0][row], model[column][0])));
+                }
+                output[column][3] = zero;
+                for (int row = 0; row < 4; ++row) {
+                    output[4 + column][row] = _mm256_fmadd_ps(view_projection_columns[2][row], model[column][2],
+                        _mm256_fmadd_ps(view_projection_columns[1][row], model[column][1], _mm256_mul_ps(view_projection_columns[0][row], model[column][0])));
+                }
+            }
+            for (int row = 0; row < 4; ++row) {
+                output[7][row] = _mm256_fmadd_ps(view_projection_columns[2][row], position[2], _mm256_fmadd_ps(view_projection_columns[1][row], position[1],
+                    _mm256_fmadd_ps(view_projection_columns[0][row], position[0], view_projection_columns[3][row])));
+                if (row < 3) {
+                    output[3][row] = _mm256_fmadd_ps(view_columns[2][row], position[2], _mm256_fmadd_ps(view_columns[1][row], position[1],
+                        _mm256_fmadd_ps(view_columns[0][row], position[0], _mm256_set1_ps(view[3][row]))));
+                }
+            }
+            output[3][3] = one;
+
+            __m256 inverse_scale[3];
+            const __m256 uniform = _mm256_and_ps(_mm256_cmp_ps(sx, sy, _CMP_EQ_OQ), _mm256_cmp_ps(sy, sz, _CMP_EQ_OQ));
+            if (_mm256_movemask_ps(uniform) == 0xFF) {
+                inverse_scale[0] = inverse_scale[1] = inverse_scale[2] = _mm256_div_ps(one, _mm256_mul_ps(sx, sx));
+            }
+            else {
+                inverse_scale[0] = _mm256_div_ps(one, _mm256_mul_ps(sx, sx));
+                inverse_scale[1] = _mm256_div_ps(one, _mm256_mul_ps(sy, sy));
+                inverse_scale[2] = _mm256_div_ps(one, _mm256_mul_ps(sz, sz));
+            }
+            for (int column = 0; column < 3; ++column) {
+                for (int row = 0; row < 3; ++row) {
+                    output[8 + column][row] = _mm256_mul_ps(output[column][row], inverse_scale[column]);
+                }
+                output[8 + column][3] = zero;
+            }
+
+            //     :       
+            __m256 objects[s_output_groups][4];
+            for (int group = 0; group < s_output_groups; ++group) {
+                const __m256 t0 = _mm256_unpacklo_ps(output[group][0], output[group][1]);
+                const __m256 t1 = _mm256_unpackhi_ps(output[group][0], output[group][1]);
+                const __m256 t2 = _mm256_unpacklo_ps(output[group][2], output[group][3]);
+                const __m256 t3 = _mm256_unpackhi_ps(output[group][2], output[group][3]);
+                objects[group][0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                objects[group][1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                objects[group][2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                objects[group][3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            }
+            float* pDestination = reinterpret_cast<float*>(pOut + i);
+            for (int object = 0; object < 4; ++object) {
+                for (int group = 0; group < s_output_groups; ++group) {
+                    _mm_stream_ps(pDestination + 44 * object + 4 * group, _mm256_castps256_ps128(objects[group][object]));
+                }
+            }
+            for (int object = 0; object < 4; ++object) {
+                for (int group = 0; group < s_output_groups; ++group) {
+                    _mm_stream_ps(pDestination + 44 * (object + 4) + 4 * group, _mm256_extractf128_ps(objects[group][object], 1));
+                }
+            }
+        }
+        _mm256_zeroupper();
+        calculate_sse(transforms, view, view_projection, pOut, i, end);
+    }
+
+#endif
+
+    //   (  AVX  )
+    static ETransformKernel detect_kernel() {
+#if defined(MYENGINE_TRANSFORM_X86)
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+        __cpuid(info, 1);
+        const bool sse2 = (info[3] & (1 << 26)) != 0;
+        const bool fma = (info[2] & (1 << 12)) != 0;
+        const bool avx_enabled = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+        bool avx2 = false;
+        if (max_leaf >= 7) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+    #else
+        __builtin_cpu_init();
+        const bool sse2 = __builtin_cpu_supports("sse2");
+        const bool fma = __builtin_cpu_supports("fma");
+        const bool avx_enabled = __builtin_cpu_supports("avx");
+        const bool avx2 = __builtin_cpu_supports("avx2");
+    #endif
+        if (avx2 && fma && avx_enabled) {
+            return ETransformKernel::AVX2;
+        }
+        if (sse2) {
+            return ETransformKernel::SSE;
+        }
+#endif
+        return ETransformKernel::Scalar;
+    }
+
+    ETransformKernel TransformBatch::get_kernel() {
+        static const ETransformKernel kernel = detect_kernel();
+        return kernel;
+    }
+
+    const char* TransformBatch::get_kernel_name(const ETransformKernel kernel) {
+        switch (kernel) {
+        case ETransformKernel::AVX2: return "AVX2";
+        case ETransformKernel::SSE: return "SSE";
+        default: return "Scalar";
+        }
+    }
+
+    void TransformBatch::calculate_range(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection, ObjectMatrices* pOut,
+        const size_t begin, const size_t end, const ETransformKernel kernel) {
+        switch (std::min(kernel, get_kernel())) {
+#if defined(MYENGINE_TRANSFORM_X86)
+        case ETransformKernel::AVX2:
+            calculate_avx2(transforms, view, view_projection, pOut, begin, end);
+            break;
+        case ETransformKernel::SSE:
+            calculate_sse(transforms, view, view_projection, pOut, begin, end);
+            break;
+#endif
+        default:
+            calculate_scalar(transforms, view, view_projection, pOut, begin, end);
+            break;
+        }
+    }
+
+    void TransformBatch::calculate(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection, ObjectMatrices* pOut) {
+        const ETransformKernel kernel = get_kernel();
+        parallel_for(transforms.size(), s_grain, [&](const size_t begin, const size_t end) {
+            calculate_range(transforms, view, view_projection, pOut, begin, end, kernel);
+        });
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace MyEngine {
+
+    //    (SoA): ,  ( )    .
+    //     ,    4 / 8    
+    struct TransformsSoA {
+        std::vector<float> position_x, position_y, position_z;
+        std::vector<float> rotation_x, rotation_y, rotation_z, rotation_w;
+        std::vector<float> scale_x, scale_y, scale_z;
+
+        size_t size() const { return position_x.size(); }
+        void resize(const size_t count);
+        void set(const size_t index, const glm::vec3& position, const glm::quat& rotation = glm::quat(1.f, 0.f, 0.f, 0.f),
+            const glm::vec3& scale = glm::vec3(1.f));
+    };
+
+    //     std430 (176 ): mat3     vec4
+    struct alignas(16) ObjectMatrices {
+        glm::mat4 model_view;
+        glm::mat4 mvp;
+        glm::vec4 normal[3];
+    };
+    static_assert(sizeof(ObjectMatrices) == 176, "ObjectMatrices must match std430 layout");
+
+    //   
+    enum class ETransformKernel {
+        Scalar,
+        SSE,
+        AVX2
+    };
+
+    //    model-view, MVP  .       ,
+    //       .
+    //      (  ,   Camera):   
+    // (   model-view)   model-view,      ,
+    //     .         
+    class TransformBatch {
+    public:
+        //   
+        static constexpr size_t s_grain = 16 * 1024;
+
+        //    . pOut -       GPU ( )
+        static void calculate(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection, ObjectMatrices* pOut);
+        //   [begin, end)      (    )
+        static void calculate_range(const TransformsSoA& transforms, const glm::mat4& view, const glm::mat4& view_projection, ObjectMatrices* pOut,
+            const size_t begin, const size_t end, const ETransformKernel kernel);
+
+        //  ,  
+        static ETransformKernel get_kernel();
+        static const char* get_kernel_name(const ETransformKernel kernel);
+    };
+
+}
\ No newline at end of file
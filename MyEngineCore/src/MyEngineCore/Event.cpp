@@ -0,0 +1,139 @@
+//    
+
+#include "MyEngineCore/Event.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+
+namespace MyEngine {
+
+    EventListenerId EventDispatcher::add_listener(const EventType type, const int priority, std::function<void(Event&)> callback) {
+        Listener listener{ m_next_listener_id++, priority, false, std::move(callback) };
+        const EventListenerId id = listener.id;
+        //      ,     
+        if (m_dispatch_depth > 0) {
+            m_pending_listeners.emplace_back(type, std::move(listener));
+        }
+        else {
+            insert_listener(type, std::move(listener));
+        }
+        return id;
+    }
+
+    void EventDispatcher::insert_listener(const EventType type, Listener listener) {
+        std::vector<Listener>& listeners = m_listeners[static_cast<size_t>(type)];
+        const auto position = std::upper_bound(listeners.begin(), listeners.end(), listener.priority,
+            [](const int priority, const Listener& other) { return priority > other.priority; });
+        listeners.insert(position, std::move(listener));
+    }
+
+    //   ,  ,    
+    void EventDispatcher::remove_event_listener(const EventListenerId id) {
+        if (id == 0) {
+            return;
+        }
+        for (std::vector<Listener>& listeners : m_listeners) {
+            for (Listener& listener : listeners) {
+                if (listener.id == id) {
+                    listener.removed = true;
+                    m_has_removed_listeners = true;
+                    apply_pending_changes();
+                    return;
+                }
+            }
+        }
+        const auto pending = std::find_if(m_pending_listeners.begin(), m_pending_listeners.end(),
+            [id](const std::pair<EventType, Listener>& pending) { return pending.second.id == id; });
+        if (pending != m_pending_listeners.end()) {
+            m_pending_listeners.erase(pending);
+        }
+    }
+
+    void EventDispatcher::apply_pending_changes() {
+        if (m_dispatch_depth > 0) {
+            return;
+        }
+        if (m_has_removed_listeners) {
+            for (std::vector<Listener>& listeners : m_listeners) {
+                listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                    [](const Listener& listener) { return listener.removed; }), listeners.end());
+            }
+            m_has_removed_listeners = false;
+        }
+        for (std::pair<EventType, Listener>& pending : m_pending_listeners) {
+            insert_listener(pending.first, std::move(pending.second));
+        }
+        m_pending_listeners.clear();
+    }
+
+    //   .            ,
+    //    
+    void EventDispatcher::post(const Event& event) {
+        ++m_stats.events_posted;
+        if (m_write_index > m_read_index) {
+            Event& last = m_queue[(m_write_index - 1) % s_queue_size];
+            if (last.type == event.type) {
+                switch (event.type) {
+                case EventType::MouseMoved:
+                case EventType::WindowResize:
+                case EventType::FramebufferResize:
+                    last = event;
+                    ++m_stats.events_coalesced;
+                    return;
+                case EventType::MouseScrolled: {
+                    EventMouseScrolled& scrolled = last.get<EventMouseScrolled>();
+                    scrolled.x_offset += event.get<EventMouseScrolled>().x_offset;
+                    scrolled.y_offset += event.get<EventMouseScrolled>().y_offset;
+                    last.timestamp = event.timestamp;
+                    ++m_stats.events_coalesced;
+                    return;
+                }
+                default:
+                    break;
+                }
+            }
+        }
+        if (m_write_index - m_read_index == s_queue_size) {
+            if (m_stats.events_dropped++ == 0) {
+                LOG_WARN("Event queue is full ({0} events), new events are dropped", s_queue_size);
+            }
+            return;
+        }
+        m_queue[m_write_index % s_queue_size] = event;
+        ++m_write_index;
+    }
+
+    void EventDispatcher::dispatch(Event& event) {
+        if (event.type == EventType::EventsCount) {
+            return;
+        }
+        ++m_dispatch_depth;
+        //   : ,    ,    
+        const std::vector<Listener>& listeners = m_listeners[static_cast<size_t>(event.type)];
+        for (size_t i = 0; i < listeners.size(); ++i) {
+            if (!listeners[i].removed) {
+                listeners[i].callback(event);
+            }
+        }
+        --m_dispatch_depth;
+        apply_pending_changes();
+    }
+
+    //       :  ,      
+    void EventDispatcher::dispatch_queued() {
+        //   ( )   ,    
+        if (m_draining) {
+            return;
+        }
+        m_draining = true;
+        m_stats.events_dispatched = 0;
+        while (m_read_index != m_write_index) {
+            Event event = m_queue[m_read_index % s_queue_size];
+            ++m_read_index;
+            dispatch(event);
+            ++m_stats.events_dispatched;
+        }
+        m_draining = false;
+    }
+
+}
\ No newline at end of file
@@ -1,37 +1,116 @@
 #include "MyEngineCore/Input.hpp"
 
+#include <algorithm>
+
 namespace MyEngine {
-    //    
-    bool Input::m_keys_pressed[static_cast<size_t>(KeyCode::KEY_LAST) + 1] = {};
-    bool Input::m_mouse_buttons_pressed[static_cast<size_t>(MouseButton::MOUSE_BUTTON_LAST) + 1] = {};
+    //     
+    InputSnapshot Input::m_snapshot;
+    InputSnapshot Input::m_pending;
+
+    //    (KEY_UNKNOWN) 
+    static bool is_valid_key(const KeyCode key_code) {
+        return key_code >= KeyCode::KEY_SPACE && static_cast<size_t>(key_code) < InputSnapshot::s_keys_count;
+    }
 
-    //   
+    static bool is_valid_mouse_button(const MouseButton mouse_button) {
+        return static_cast<size_t>(mouse_button) < InputSnapshot::s_mouse_buttons_count;
+    }
+
+    //   
     bool Input::IsKeyPressed(const KeyCode key_code) {
-        return m_keys_pressed[static_cast<size_t>(key_code)];
+        return is_valid_key(key_code) && m_snapshot.keys_down[static_cast<size_t>(key_code)];
     }
 
-    //    
+    //     
+    bool Input::IsKeyJustPressed(const KeyCode key_code) {
+        return is_valid_key(key_code) && m_snapshot.keys_pressed[static_cast<size_t>(key_code)];
+    }
+
+    //     
+    bool Input::IsKeyJustReleased(const KeyCode key_code) {
+        return is_valid_key(key_code) && m_snapshot.keys_released[static_cast<size_t>(key_code)];
+    }
+
+    //     (      )
     void Input::PressKey(const KeyCode key_code) {
-        m_keys_pressed[static_cast<size_t>(key_code)] = true;
+        if (!is_valid_key(key_code)) {
+            return;
+        }
+        const size_t index = static_cast<size_t>(key_code);
+        if (!m_pending.keys_down[index]) {
+            m_pending.keys_pressed[index] = true;
+        }
+        m_pending.keys_down[index] = true;
     }
 
     //    
     void Input::ReleaseKey(const KeyCode key_code) {
-        m_keys_pressed[static_cast<size_t>(key_code)] = false;
+        if (!is_valid_key(key_code)) {
+            return;
+        }
+        const size_t index = static_cast<size_t>(key_code);
+        m_pending.keys_down[index] = false;
+        m_pending.keys_released[index] = true;
     }
 
-    //   
+    //   
     bool Input::IsMouseButtonPressed(const MouseButton mouse_button){
-        return m_mouse_buttons_pressed[static_cast<size_t>(mouse_button)];
+        return is_valid_mouse_button(mouse_button) && m_snapshot.mouse_buttons_down[static_cast<size_t>(mouse_button)];
+    }
+
+    //     
+    bool Input::IsMouseButtonJustPressed(const MouseButton mouse_button) {
+        return is_valid_mouse_button(mouse_button) && m_snapshot.mouse_buttons_pressed[static_cast<size_t>(mouse_button)];
+    }
+
+    //     
+    bool Input::IsMouseButtonJustReleased(const MouseButton mouse_button) {
+        return is_valid_mouse_button(mouse_button) && m_snapshot.mouse_buttons_released[static_cast<size_t>(mouse_button)];
     }
 
     //    
     void Input::PressMouseButton(const MouseButton mouse_button){
-        m_mouse_buttons_pressed[static_cast<size_t>(mouse_button)] = true;
+        if (!is_valid_mouse_button(mouse_button)) {
+            return;
+        }
+        const size_t index = static_cast<size_t>(mouse_button);
+        m_pending.mouse_buttons_down[index] = true;
+        m_pending.mouse_buttons_pressed[index] = true;
     }
 
     //    
     void Input::ReleaseMouseButton(const MouseButton mouse_button){
-        m_mouse_buttons_pressed[static_cast<size_t>(mouse_button)] = false;
+        if (!is_valid_mouse_button(mouse_button)) {
+            return;
+        }
+        const size_t index = static_cast<size_t>(mouse_button);
+        m_pending.mouse_buttons_down[index] = false;
+        m_pending.mouse_buttons_released[index] = true;
+    }
+
+    //  
+    glm::vec2 Input::GetMousePosition() {
+        return m_snapshot.mouse_position;
+    }
+
+    //    
+    void Input::MoveMouse(const double x_pos, const double y_pos) {
+        m_pending.mouse_position = glm::vec2(static_cast<float>(x_pos), static_cast<float>(y_pos));
+    }
+
+    const InputSnapshot& Input::GetSnapshot() {
+        return m_snapshot;
+    }
+
+    //   ,          
+    void Input::NewFrame(const uint64_t timestamp, const uint64_t first_input_timestamp) {
+        ++m_pending.frame;
+        m_pending.timestamp = std::max(m_pending.timestamp, timestamp);
+        m_pending.first_input_timestamp = first_input_timestamp;
+        m_snapshot = m_pending;
+        m_pending.keys_pressed.reset();
+        m_pending.keys_released.reset();
+        m_pending.mouse_buttons_pressed.reset();
+        m_pending.mouse_buttons_released.reset();
     }
 }
\ No newline at end of file
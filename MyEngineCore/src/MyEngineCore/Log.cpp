@@ -0,0 +1,325 @@
+//    
+
+#include "MyEngineCore/Log.hpp"
+
+#include <spdlog/fmt/fmt.h>
+#if defined(SPDLOG_FMT_EXTERNAL)
+    #include <fmt/args.h>
+#else
+    #include <spdlog/fmt/bundled/args.h>
+#endif
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MyEngine {
+
+    //     ( )
+    constexpr size_t s_ring_size = 64 * 1024;
+    //         (    )
+    constexpr uint32_t s_padding_flag = 0x80000000u;
+    //   ,   
+    constexpr auto s_idle_wait = std::chrono::milliseconds(5);
+    //    ()
+    constexpr int64_t s_rate_limit_window = 1'000'000'000;
+
+    //   :   ,    
+    struct ThreadLogBuffer {
+        alignas(64) std::atomic<uint64_t> head{ 0 };
+        alignas(64) std::atomic<uint64_t> tail{ 0 };
+        //  :    head    
+        uint64_t cached_head = 0;
+        uint64_t reserved_tail = 0;
+        //  :  ,   
+        std::atomic<bool> retired{ false };
+        alignas(64) unsigned char data[s_ring_size];
+    };
+
+    //  
+    struct LogState {
+        LogState() {
+            //  spdlog    ,    :    
+            //     
+            spdlog::default_logger();
+        }
+
+        ~LogState() {
+            Log::shutdown();
+        }
+
+        std::mutex mutex;
+        std::vector<std::shared_ptr<ThreadLogBuffer>> buffers;
+        std::thread worker;
+        //    (  ,      )
+        std::atomic<bool> running{ false };
+        std::atomic<bool> stop{ false };
+        std::condition_variable wake_condition;
+
+        //    flush (),  
+        std::atomic<uint64_t> flush_requested{ 0 };
+        std::atomic<uint64_t> flush_completed{ 0 };
+        std::condition_variable flush_condition;
+
+        std::atomic<size_t> written_count{ 0 };
+        std::atomic<size_t> dropped_count{ 0 };
+        std::atomic<size_t> suppressed_count{ 0 };
+    };
+
+    static LogState& get_state() {
+        static LogState state;
+        return state;
+    }
+
+    //           
+    struct ThreadLogBufferHolder {
+        ~ThreadLogBufferHolder() {
+            if (pBuffer) {
+                pBuffer->retired.store(true, std::memory_order_release);
+            }
+        }
+
+        std::shared_ptr<ThreadLogBuffer> pBuffer;
+    };
+
+    static thread_local ThreadLogBufferHolder t_buffer;
+
+    static spdlog::level::level_enum to_spdlog_level(const ELogLevel level) {
+        switch (level) {
+        case ELogLevel::Trace: return spdlog::level::trace;
+        case ELogLevel::Info: return spdlog::level::info;
+        case ELogLevel::Warn: return spdlog::level::warn;
+        case ELogLevel::Error: return spdlog::level::err;
+        case ELogLevel::Critical: return spdlog::level::critical;
+        default: return spdlog::level::off;
+        }
+    }
+
+    //   spdlog   ,   
+    static void output(const LogSite& site, const int64_t time, const std::string_view message) {
+        const auto log_time = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(time)));
+        spdlog::default_logger_raw()->log(log_time, spdlog::source_loc{}, to_spdlog_level(site.level),
+            spdlog::string_view_t(message.data(), message.size()));
+    }
+
+    //     . fmt     ,
+    //       spdlog - ,     
+    static std::string format_record(const LogRecordHeader& header, const unsigned char* pArgs) {
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        for (uint32_t i = 0; i < header.args_count; ++i) {
+            const ELogArgType type = static_cast<ELogArgType>(*pArgs++);
+            switch (type) {
+            case ELogArgType::Bool: { bool value; std::memcpy(&value, pArgs, sizeof(value)); pArgs += sizeof(value); store.push_back(value); break; }
+            case ELogArgType::Char: { char value; std::memcpy(&value, pArgs, sizeof(value)); pArgs += sizeof(value); store.push_back(value); break; }
+            case ELogArgType::Int: { int64_t value; std::memcpy(&value, pArgs, sizeof(value)); pArgs += sizeof(value); store.push_back(value); break; }
+            case ELogArgType::UInt: { uint64_t value; std::memcpy(&value, pArgs, sizeof(value)); pArgs += sizeof(value); store.push_back(value); break; }
+            case ELogArgType::Double: { double value; std::memcpy(&value, pArgs, sizeof(value)); pArgs += sizeof(value); store.push_back(value); break; }
+            case ELogArgType::Pointer: { const void* value; std::memcpy(&value, pArgs, sizeof(value)); pArgs += sizeof(value); store.push_back(value); break; }
+            case ELogArgType::String: {
+                uint32_t length;
+                std::memcpy(&length, pArgs, sizeof(length));
+                pArgs += sizeof(length);
+                store.push_back(std::string(reinterpret_cast<const char*>(pArgs), length));
+                pArgs += length;
+                break;
+            }
+            }
+        }
+        std::string message;
+        try {
+            message = fmt::vformat(header.format, store);
+        }
+        catch (const std::exception& exception) {
+            message = std::string("[format error: ") + exception.what() + "] " + header.format;
+        }
+        if (header.suppressed_count > 0) {
+            message += fmt::format(" [{0} similar messages suppressed]", header.suppressed_count);
+        }
+        return message;
+    }
+
+    //    .   
+    static size_t drain_buffer(ThreadLogBuffer& buffer) {
+        uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        const uint64_t tail = buffer.tail.load(std::memory_order_acquire);
+        size_t count = 0;
+        while (head != tail) {
+            const size_t position = head & (s_ring_size - 1);
+            uint32_t size;
+            std::memcpy(&size, buffer.data + position, sizeof(size));
+            if (size & s_padding_flag) {
+                head += size & ~s_padding_flag;
+                continue;
+            }
+            LogRecordHeader header;
+            std::memcpy(&header, buffer.data + position, sizeof(header));
+            output(*header.pSite, header.time, format_record(header, buffer.data + position + sizeof(header)));
+            head += size;
+            ++count;
+        }
+        buffer.head.store(head, std::memory_order_release);
+        return count;
+    }
+
+    //  :    ,    
+    static void worker_loop() {
+        LogState& state = get_state();
+        std::vector<std::shared_ptr<ThreadLogBuffer>> buffers;
+        while (true) {
+            const bool stop = state.stop.load(std::memory_order_acquire);
+            const uint64_t flush_requested = state.flush_requested.load(std::memory_order_acquire);
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                buffers = state.buffers;
+            }
+            size_t count = 0;
+            bool has_retired = false;
+            for (const std::shared_ptr<ThreadLogBuffer>& pBuffer : buffers) {
+                //    :        
+                has_retired |= pBuffer->retired.load(std::memory_order_acquire);
+                count += drain_buffer(*pBuffer);
+            }
+            if (has_retired) {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.buffers.erase(std::remove_if(state.buffers.begin(), state.buffers.end(), [](const std::shared_ptr<ThreadLogBuffer>& pBuffer) {
+                    return pBuffer->retired.load(std::memory_order_acquire) &&
+                        pBuffer->head.load(std::memory_order_relaxed) == pBuffer->tail.load(std::memory_order_acquire);
+                }), state.buffers.end());
+            }
+            buffers.clear();
+            if (count > 0) {
+                state.written_count.fetch_add(count, std::memory_order_relaxed);
+                spdlog::default_logger_raw()->flush();
+            }
+            if (state.flush_completed.exchange(flush_requested, std::memory_order_acq_rel) != flush_requested) {
+                //      :  flush   
+                { std::lock_guard<std::mutex> lock(state.mutex); }
+                state.flush_condition.notify_all();
+            }
+            if (stop) {
+                break;
+            }
+            if (count == 0) {
+                std::unique_lock<std::mutex> lock(state.mutex);
+                state.wake_condition.wait_for(lock, s_idle_wait, [&]() {
+                    return state.stop.load(std::memory_order_acquire) ||
+                        state.flush_requested.load(std::memory_order_acquire) != flush_requested;
+                });
+            }
+        }
+    }
+
+    int64_t Log::get_time() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    //   s_rate_limit_per_second     ,      
+    bool Log::pass_rate_limit(LogSite& site, const int64_t time, uint32_t& suppressed_count) {
+        int64_t window_start = site.window_start.load(std::memory_order_relaxed);
+        if (time - window_start >= s_rate_limit_window &&
+            site.window_start.compare_exchange_strong(window_start, time, std::memory_order_relaxed)) {
+            site.window_count.store(0, std::memory_order_relaxed);
+        }
+        if (site.window_count.fetch_add(1, std::memory_order_relaxed) >= s_rate_limit_per_second) {
+            site.suppressed_count.fetch_add(1, std::memory_order_relaxed);
+            get_state().suppressed_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        suppressed_count = site.suppressed_count.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    //  :    ( ),      
+    void Log::write_critical(const LogSite& site, const int64_t time, const std::string& message) {
+        flush();
+        output(site, time, message);
+        spdlog::default_logger_raw()->flush();
+    }
+
+    //  :       ,   
+    unsigned char* Log::begin_record(const size_t size) {
+        LogState& state = get_state();
+        //          shutdown (   )
+        if (!t_buffer.pBuffer || !state.running.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!t_buffer.pBuffer) {
+                t_buffer.pBuffer = std::make_shared<ThreadLogBuffer>();
+                state.buffers.push_back(t_buffer.pBuffer);
+            }
+            if (!state.running) {
+                state.stop.store(false, std::memory_order_relaxed);
+                state.worker = std::thread(worker_loop);
+                state.running = true;
+            }
+        }
+        ThreadLogBuffer& buffer = *t_buffer.pBuffer;
+        const uint64_t tail = buffer.tail.load(std::memory_order_relaxed);
+        const size_t position = tail & (s_ring_size - 1);
+        const size_t contiguous = s_ring_size - position;
+        const size_t needed = size <= contiguous ? size : size + contiguous;
+        if (size > s_ring_size / 2 || (tail + needed - buffer.cached_head > s_ring_size &&
+            tail + needed - (buffer.cached_head = buffer.head.load(std::memory_order_acquire)) > s_ring_size)) {
+            state.dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        if (size > contiguous) {
+            const uint32_t padding = static_cast<uint32_t>(contiguous) | s_padding_flag;
+            std::memcpy(buffer.data + position, &padding, sizeof(padding));
+            buffer.reserved_tail = tail + needed;
+            return buffer.data;
+        }
+        buffer.reserved_tail = tail + size;
+        return buffer.data + position;
+    }
+
+    void Log::end_record() {
+        ThreadLogBuffer& buffer = *t_buffer.pBuffer;
+        buffer.tail.store(buffer.reserved_tail, std::memory_order_release);
+    }
+
+    //     .   ,  :
+    // shutdown    
+    void Log::flush() {
+        LogState& state = get_state();
+        std::unique_lock<std::mutex> lock(state.mutex);
+        if (!state.running) {
+            return;
+        }
+        const uint64_t request = state.flush_requested.fetch_add(1, std::memory_order_acq_rel) + 1;
+        state.wake_condition.notify_one();
+        state.flush_condition.wait(lock, [&]() {
+            return state.flush_completed.load(std::memory_order_acquire) >= request || state.stop.load(std::memory_order_acquire);
+        });
+    }
+
+    void Log::shutdown() {
+        LogState& state = get_state();
+        std::thread worker;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!state.running) {
+                return;
+            }
+            state.stop.store(true, std::memory_order_release);
+            state.running = false;
+            worker = std::move(state.worker);
+        }
+        state.wake_condition.notify_one();
+        state.flush_condition.notify_all();
+        worker.join();
+    }
+
+    Log::Stats Log::get_stats() {
+        const LogState& state = get_state();
+        Stats stats;
+        stats.written_count = state.written_count.load(std::memory_order_relaxed);
+        stats.dropped_count = state.dropped_count.load(std::memory_order_relaxed);
+        stats.suppressed_count = state.suppressed_count.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "ProfilerModule.hpp"
+
+#include "MyEngineCore/Rendering/OpenGL/GpuMemoryTracker.hpp"
+#include "MyEngineCore/Rendering/OpenGL/LatencyTracker.hpp"
+#include "MyEngineCore/Rendering/OpenGL/Render_OpenGL.hpp"
+#include "MyEngineCore/Core/JobSystem.hpp"
+#include "MyEngineCore/Core/FrameAllocator.hpp"
+#include "MyEngineCore/Core/AllocationCounter.hpp"
+
+#include <imgui/imgui.h>
+
+namespace MyEngine {
+
+    //      
+    void ProfilerModule::on_ui_draw()
+    {
+        ImGui::SetNextWindowBgAlpha(0.6f);
+        ImGui::Begin("Profiler", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoDocking);
+        const ImGuiIO& io = ImGui::GetIO();
+        ImGui::Text("Frame: %.2f ms (%.0f FPS)", io.DeltaTime * 1000.f, io.Framerate);
+        const JobSystem::Stats job_stats = JobSystem::get_stats();
+        ImGui::Text("Jobs: %zu workers, %zu executed, %zu stolen", job_stats.workers_count, job_stats.jobs_executed, job_stats.jobs_stolen);
+        ImGui::Text("Frame memory: %.1f / %.1f KB (peak %.1f KB)", FrameAllocator::get_used() / 1024.0,
+            FrameAllocator::get_capacity() / 1024.0, FrameAllocator::get_peak() / 1024.0);
+        if (AllocationCounter::is_enabled()) {
+            ImGui::Text("Heap allocations: %zu per frame (%.1f KB), peak %zu", AllocationCounter::get_frame_allocations(),
+                AllocationCounter::get_frame_bytes() / 1024.0, AllocationCounter::get_peak_frame_allocations());
+        }
+        const Render_OpenGL::FrameStats& render_stats = Render_OpenGL::get_frame_stats();
+        ImGui::Text("Draw calls: %zu (%zu triangles)", render_stats.draw_calls_count, render_stats.triangles_count);
+        ImGui::Text("GL state: %zu issued, %zu skipped", render_stats.state_changes_issued, render_stats.state_changes_skipped);
+        ImGui::Separator();
+        LatencyTracker::on_ui_draw();
+        ImGui::Separator();
+        GpuMemoryTracker::on_ui_draw();
+        ImGui::End();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace MyEngine {
+
+    //  :      ( , )
+    class ProfilerModule
+    {
+    public:
+        //   ( on_ui_draw_begin  on_ui_draw_end)
+        static void on_ui_draw();
+    };
+
+}
\ No newline at end of file
@@ -1,12 +1,110 @@
 #include "UIModule.hpp"
+#include "MyEngineCore/Event.hpp"
+#include "MyEngineCore/Rendering/OpenGL/Render_OpenGL.hpp"
 
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
-#include <imgui/backends/imgui_impl_glfw.h>
-#include <GLFW/glfw3.h>
+
+#include <cfloat>
+#include <chrono>
 
 namespace MyEngine {
 
+    //     
+    static std::chrono::steady_clock::time_point s_last_frame_time;
+
+    //  ImGui    (   GLFW)
+    static ImGuiKey get_imgui_key(const KeyCode key_code) {
+        const int key = static_cast<int>(key_code);
+        if (key >= static_cast<int>(KeyCode::KEY_A) && key <= static_cast<int>(KeyCode::KEY_Z)) {
+            return static_cast<ImGuiKey>(ImGuiKey_A + (key - static_cast<int>(KeyCode::KEY_A)));
+        }
+        if (key >= static_cast<int>(KeyCode::KEY_0) && key <= static_cast<int>(KeyCode::KEY_9)) {
+            return static_cast<ImGuiKey>(ImGuiKey_0 + (key - static_cast<int>(KeyCode::KEY_0)));
+        }
+        if (key >= static_cast<int>(KeyCode::KEY_F1) && key <= static_cast<int>(KeyCode::KEY_F12)) {
+            return static_cast<ImGuiKey>(ImGuiKey_F1 + (key - static_cast<int>(KeyCode::KEY_F1)));
+        }
+        if (key >= static_cast<int>(KeyCode::KEY_KP_0) && key <= static_cast<int>(KeyCode::KEY_KP_9)) {
+            return static_cast<ImGuiKey>(ImGuiKey_Keypad0 + (key - static_cast<int>(KeyCode::KEY_KP_0)));
+        }
+        switch (key_code) {
+        case KeyCode::KEY_SPACE: return ImGuiKey_Space;
+        case KeyCode::KEY_APOSTROPHE: return ImGuiKey_Apostrophe;
+        case KeyCode::KEY_COMMA: return ImGuiKey_Comma;
+        case KeyCode::KEY_MINUS: return ImGuiKey_Minus;
+        case KeyCode::KEY_PERIOD: return ImGuiKey_Period;
+        case KeyCode::KEY_SLASH: return ImGuiKey_Slash;
+        case KeyCode::KEY_SEMICOLON: return ImGuiKey_Semicolon;
+        case KeyCode::KEY_EQUAL: return ImGuiKey_Equal;
+        case KeyCode::KEY_LEFT_BRACKET: return ImGuiKey_LeftBracket;
+        case KeyCode::KEY_BACKSLASH: return ImGuiKey_Backslash;
+        case KeyCode::KEY_RIGHT_BRACKET: return ImGuiKey_RightBracket;
+        case KeyCode::KEY_GRAVE_ACCENT: return ImGuiKey_GraveAccent;
+        case KeyCode::KEY_ESCAPE: return ImGuiKey_Escape;
+        case KeyCode::KEY_ENTER: return ImGuiKey_Enter;
+        case KeyCode::KEY_TAB: return ImGuiKey_Tab;
+        case KeyCode::KEY_BACKSPACE: return ImGuiKey_Backspace;
+        case KeyCode::KEY_INSERT: return ImGuiKey_Insert;
+        case KeyCode::KEY_DELETE: return ImGuiKey_Delete;
+        case KeyCode::KEY_RIGHT: return ImGuiKey_RightArrow;
+        case KeyCode::KEY_LEFT: return ImGuiKey_LeftArrow;
+        case KeyCode::KEY_DOWN: return ImGuiKey_DownArrow;
+        case KeyCode::KEY_UP: return ImGuiKey_UpArrow;
+        case KeyCode::KEY_PAGE_UP: return ImGuiKey_PageUp;
+        case KeyCode::KEY_PAGE_DOWN: return ImGuiKey_PageDown;
+        case KeyCode::KEY_HOME: return ImGuiKey_Home;
+        case KeyCode::KEY_END: return ImGuiKey_End;
+        case KeyCode::KEY_CAPS_LOCK: return ImGuiKey_CapsLock;
+        case KeyCode::KEY_SCROLL_LOCK: return ImGuiKey_ScrollLock;
+        case KeyCode::KEY_NUM_LOCK: return ImGuiKey_NumLock;
+        case KeyCode::KEY_PRINT_SCREEN: return ImGuiKey_PrintScreen;
+        case KeyCode::KEY_PAUSE: return ImGuiKey_Pause;
+        case KeyCode::KEY_KP_DECIMAL: return ImGuiKey_KeypadDecimal;
+        case KeyCode::KEY_KP_DIVIDE: return ImGuiKey_KeypadDivide;
+        case KeyCode::KEY_KP_MULTIPLY: return ImGuiKey_KeypadMultiply;
+        case KeyCode::KEY_KP_SUBTRACT: return ImGuiKey_KeypadSubtract;
+        case KeyCode::KEY_KP_ADD: return ImGuiKey_KeypadAdd;
+        case KeyCode::KEY_KP_ENTER: return ImGuiKey_KeypadEnter;
+        case KeyCode::KEY_KP_EQUAL: return ImGuiKey_KeypadEqual;
+        case KeyCode::KEY_LEFT_SHIFT: return ImGuiKey_LeftShift;
+        case KeyCode::KEY_LEFT_CONTROL: return ImGuiKey_LeftCtrl;
+        case KeyCode::KEY_LEFT_ALT: return ImGuiKey_LeftAlt;
+        case KeyCode::KEY_LEFT_SUPER: return ImGuiKey_LeftSuper;
+        case KeyCode::KEY_RIGHT_SHIFT: return ImGuiKey_RightShift;
+        case KeyCode::KEY_RIGHT_CONTROL: return ImGuiKey_RightCtrl;
+        case KeyCode::KEY_RIGHT_ALT: return ImGuiKey_RightAlt;
+        case KeyCode::KEY_RIGHT_SUPER: return ImGuiKey_RightSuper;
+        case KeyCode::KEY_MENU: return ImGuiKey_Menu;
+        default: return ImGuiKey_None;
+        }
+    }
+
+    //    (      )
+    static void add_modifiers(ImGuiIO& io, const int mods) {
+        io.AddKeyEvent(ImGuiMod_Ctrl, (mods & s_mod_control) != 0);
+        io.AddKeyEvent(ImGuiMod_Shift, (mods & s_mod_shift) != 0);
+        io.AddKeyEvent(ImGuiMod_Alt, (mods & s_mod_alt) != 0);
+        io.AddKeyEvent(ImGuiMod_Super, (mods & s_mod_super) != 0);
+    }
+
+    //      
+    static void add_key(ImGuiIO& io, const KeyCode key_code, const bool down, const int mods) {
+        add_modifiers(io, mods);
+        const ImGuiKey key = get_imgui_key(key_code);
+        if (key != ImGuiKey_None) {
+            io.AddKeyEvent(key, down);
+        }
+    }
+
+    static void add_mouse_button(ImGuiIO& io, const MouseButton mouse_button, const bool down, const int mods) {
+        add_modifiers(io, mods);
+        const int button = static_cast<int>(mouse_button);
+        if (button >= 0 && button < ImGuiMouseButton_COUNT) {
+            io.AddMouseButtonEvent(button, down);
+        }
+    }
+
     //   
     void UIModule::on_window_create(GLFWwindow* pWindow)
     {
@@ -16,12 +114,15 @@ namespace MyEngine {
 
         //      
         ImGuiIO& io = ImGui::GetIO();
+        //    (ViewportsEnable)  :   GLFW     ,
+        //  GLFW       
         io.ConfigFlags |= ImGuiConfigFlags_::ImGuiConfigFlags_DockingEnable;
-        io.ConfigFlags |= ImGuiConfigFlags_::ImGuiConfigFlags_ViewportsEnable;
 
-        //     
+        //  GLFW  :    ,    GLFW,  
+        //  .       on_event,   -  on_ui_draw_begin
+        io.BackendPlatformName = "MyEngine event queue";
         ImGui_ImplOpenGL3_Init();
-        ImGui_ImplGlfw_InitForOpenGL(pWindow, true);
+        s_last_frame_time = std::chrono::steady_clock::now();
     }
 
     //   
@@ -29,29 +130,80 @@ namespace MyEngine {
     {
         //     
         ImGui_ImplOpenGL3_Shutdown();
-        ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
     }
 
-    //   
-    void UIModule::on_ui_draw_begin()
+    //      ImGui
+    void UIModule::on_event(const Event& event)
     {
+        ImGuiIO& io = ImGui::GetIO();
+        switch (event.type) {
+        case EventType::MouseMoved:
+            io.AddMousePosEvent(static_cast<float>(event.get<EventMouseMoved>().x), static_cast<float>(event.get<EventMouseMoved>().y));
+            break;
+        case EventType::MouseButtonPressed: {
+            const EventMouseButtonPressed& button_event = event.get<EventMouseButtonPressed>();
+            add_mouse_button(io, button_event.mouse_button, true, button_event.mods);
+            break;
+        }
+        case EventType::MouseButtonReleased: {
+            const EventMouseButtonReleased& button_event = event.get<EventMouseButtonReleased>();
+            add_mouse_button(io, button_event.mouse_button, false, button_event.mods);
+            break;
+        }
+        case EventType::MouseScrolled:
+            io.AddMouseWheelEvent(static_cast<float>(event.get<EventMouseScrolled>().x_offset), static_cast<float>(event.get<EventMouseScrolled>().y_offset));
+            break;
+        case EventType::CursorEnter:
+            //   : ImGui        
+            if (!event.get<EventCursorEnter>().entered) {
+                io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+            }
+            break;
+        case EventType::WindowFocus:
+            io.AddFocusEvent(event.get<EventWindowFocus>().focused);
+            break;
+        case EventType::KeyPressed: {
+            const EventKeyPressed& key_event = event.get<EventKeyPressed>();
+            add_key(io, key_event.key_code, true, key_event.mods);
+            break;
+        }
+        case EventType::KeyReleased: {
+            const EventKeyReleased& key_event = event.get<EventKeyReleased>();
+            add_key(io, key_event.key_code, false, key_event.mods);
+            break;
+        }
+        case EventType::CharTyped:
+            io.AddInputCharacter(event.get<EventCharTyped>().codepoint);
+            break;
+        default:
+            break;
+        }
+    }
+
+    //   :         GLFW
+    void UIModule::on_ui_draw_begin(const unsigned int width, const unsigned int height, const unsigned int framebuffer_width,
+        const unsigned int framebuffer_height)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.DisplaySize = ImVec2(static_cast<float>(width), static_cast<float>(height));
+        if (width > 0 && height > 0) {
+            io.DisplayFramebufferScale = ImVec2(static_cast<float>(framebuffer_width) / width, static_cast<float>(framebuffer_height) / height);
+        }
+        const auto now = std::chrono::steady_clock::now();
+        const float delta_time = std::chrono::duration<float>(now - s_last_frame_time).count();
+        io.DeltaTime = delta_time > 0.f ? delta_time : 1.f / 60.f;
+        s_last_frame_time = now;
+
         ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
     }
 
-    //   
+    //   .  ImGui   OpenGL   ,   
     void UIModule::on_ui_draw_end()
     {
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-        if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
-        {
-            GLFWwindow* backup_current_context = glfwGetCurrentContext();
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
-            glfwMakeContextCurrent(backup_current_context);
-        }
+        Render_OpenGL::invalidate_state_cache();
     }
 }
\ No newline at end of file
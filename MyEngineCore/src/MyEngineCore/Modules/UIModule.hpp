@@ -4,6 +4,8 @@ struct GLFWwindow;
 
 namespace MyEngine {
 
+    struct Event;
+
     //   
     class UIModule
     {
@@ -11,8 +13,12 @@ namespace MyEngine {
         //   / ,  / 
         static void on_window_create(GLFWwindow* pWindow);
         static void on_window_close();
-        static void on_ui_draw_begin();
+        //   :         (GLFW     )
+        static void on_ui_draw_begin(const unsigned int width, const unsigned int height, const unsigned int framebuffer_width,
+            const unsigned int framebuffer_height);
         static void on_ui_draw_end();
+        //      (  ,  on_ui_draw_begin)
+        static void on_event(const Event& event);
     };
 
 }
\ No newline at end of file
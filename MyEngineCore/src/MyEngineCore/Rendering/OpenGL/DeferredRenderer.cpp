@@ -0,0 +1,251 @@
+#include "DeferredRenderer.hpp"
+#include "Render_OpenGL.hpp"
+#include "ShadowMaps.hpp"
+
+#include <glm/matrix.hpp>
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace MyEngine {
+
+    //    (  = x + 2y + 4z)      
+    static const float s_volume_vertices[] = {
+        -1.f, -1.f, -1.f,    1.f, -1.f, -1.f,   -1.f,  1.f, -1.f,    1.f,  1.f, -1.f,
+        -1.f, -1.f,  1.f,    1.f, -1.f,  1.f,   -1.f,  1.f,  1.f,    1.f,  1.f,  1.f
+    };
+    static const unsigned int s_volume_indices[] = {
+        0, 4, 6, 0, 6, 2,   1, 3, 7, 1, 7, 5,
+        0, 1, 5, 0, 5, 4,   2, 6, 7, 2, 7, 3,
+        0, 2, 3, 0, 3, 1,   4, 5, 7, 4, 7, 6
+    };
+
+    //   :   (   )
+    static const char* s_lights_source =
+        R"(#version 460
+        struct PointLight {
+            vec4 position_radius;
+            vec4 color_intensity;
+        };
+        layout(std430, binding = 1) readonly buffer LightsBuffer {
+            PointLight lights[];
+        };
+        )";
+
+    //  G-      (  ,    )
+    static const char* s_lighting_source =
+        R"(
+        layout(binding = 0) uniform sampler2D gbuffer_albedo_specular;
+        layout(binding = 1) uniform sampler2D gbuffer_normal_shininess;
+        layout(binding = 2) uniform sampler2D gbuffer_depth;
+        uniform mat4 inverse_projection_matrix;
+        uniform vec2 inverse_screen_size;
+        uniform float diffuse_factor;
+        uniform float max_shininess;
+
+        out vec4 frag_color;
+
+        struct Surface {
+            vec3 position;
+            vec3 normal;
+            vec3 albedo;
+            float specular;
+            float shininess;
+        };
+
+        //   
+        vec3 decode_normal(vec2 encoded) {
+            vec2 f = encoded * 2.0 - 1.0;
+            vec3 n = vec3(f, 1.0 - abs(f.x) - abs(f.y));
+            float t = max(-n.z, 0.0);
+            n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+            return normalize(n);
+        }
+
+        //    (false - )
+        bool read_surface(out Surface surface) {
+            ivec2 pixel = ivec2(gl_FragCoord.xy);
+            float depth = texelFetch(gbuffer_depth, pixel, 0).r;
+            if (depth >= 1.0) {
+                return false;
+            }
+            vec4 position = inverse_projection_matrix * vec4(gl_FragCoord.xy * inverse_screen_size * 2.0 - 1.0, depth * 2.0 - 1.0, 1.0);
+            vec4 albedo_specular = texelFetch(gbuffer_albedo_specular, pixel, 0);
+            vec4 normal_shininess = texelFetch(gbuffer_normal_shininess, pixel, 0);
+            surface.position = position.xyz / position.w;
+            surface.normal = decode_normal(normal_shininess.xy);
+            surface.albedo = albedo_specular.rgb;
+            surface.specular = albedo_specular.a;
+            surface.shininess = max(normal_shininess.z * max_shininess, 1.0);
+            return true;
+        }
+
+        //    light_dir ( )
+        vec3 shade_direction(vec3 light_dir, vec3 radiance, Surface surface) {
+            vec3 view_dir = normalize(-surface.position);
+            vec3 diffuse = diffuse_factor * radiance * max(dot(surface.normal, light_dir), 0.0);
+            vec3 reflect_dir = reflect(-light_dir, surface.normal);
+            vec3 specular = surface.specular * radiance * pow(max(dot(view_dir, reflect_dir), 0.0), surface.shininess);
+            return surface.albedo * (diffuse + specular);
+        }
+
+        //   light_index  
+        vec3 shade(uint light_index, Surface surface) {
+            PointLight light = lights[light_index];
+            vec3 to_light = light.position_radius.xyz - surface.position;
+            float distance_squared = dot(to_light, to_light);
+            float falloff = clamp(1.0 - distance_squared / (light.position_radius.w * light.position_radius.w), 0.0, 1.0);
+            if (falloff <= 0.0) {
+                return vec3(0.0);
+            }
+            vec3 radiance = light.color_intensity.rgb * (light.color_intensity.w * falloff * falloff)
+                * get_point_shadow(light_index, surface.position, light.position_radius.xyz);
+            return shade_direction(to_light * inversesqrt(distance_squared), radiance, surface);
+        }
+        )";
+
+    //     
+    static const char* s_fullscreen_vertex_shader =
+        R"(#version 460
+        void main() {
+            vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+            gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+        })";
+
+    //  ,    0
+    static const char* s_fullscreen_fragment_shader =
+        R"(
+        uniform vec3 ambient_color;
+        uniform vec3 sun_direction_eye;
+        uniform vec3 sun_radiance;
+        uniform int lights_count;
+        void main() {
+            Surface surface;
+            if (!read_surface(surface)) {
+                discard;
+            }
+            vec3 color = surface.albedo * ambient_color;
+            color += shade_direction(-sun_direction_eye, sun_radiance, surface) * get_sun_shadow(surface.position);
+            if (lights_count > 0) {
+                color += shade(0u, surface);
+            }
+            frag_color = vec4(color, 1.0);
+        })";
+
+    //  :     first_light + gl_InstanceID
+    static const char* s_volume_vertex_shader =
+        R"(
+        layout(location = 0) in vec3 vertex_position;
+        uniform mat4 projection_matrix;
+        uniform int first_light;
+        flat out int light_index;
+        void main() {
+            light_index = first_light + gl_InstanceID;
+            vec4 position_radius = lights[light_index].position_radius;
+            gl_Position = projection_matrix * vec4(position_radius.xyz + vertex_position * position_radius.w, 1.0);
+            //        ,   
+            gl_Position.z = min(gl_Position.z, gl_Position.w);
+        })";
+
+    static const char* s_volume_fragment_shader =
+        R"(
+        flat in int light_index;
+        void main() {
+            Surface surface;
+            if (!read_surface(surface)) {
+                discard;
+            }
+            frag_color = vec4(shade(uint(light_index), surface), 1.0);
+        })";
+
+    DeferredRenderer::DeferredRenderer(const unsigned int width, const unsigned int height)
+        : m_gbuffer(width, height, { ERenderTargetFormat::RGBA8, ERenderTargetFormat::RGB10A2 }, ERenderTargetFormat::Depth24Stencil8),
+        m_fullscreen_program(s_fullscreen_vertex_shader,
+            (std::string(s_lights_source) + ShadowMaps::get_shader_source() + s_lighting_source + s_fullscreen_fragment_shader).c_str()),
+        m_volume_program((std::string(s_lights_source) + s_volume_vertex_shader).c_str(),
+            (std::string(s_lights_source) + ShadowMaps::get_shader_source() + s_lighting_source + s_volume_fragment_shader).c_str()),
+        m_volume_vertex_buffer(s_volume_vertices, sizeof(s_volume_vertices), BufferLayout{ ShaderDataType::Float3 }),
+        m_volume_index_buffer(s_volume_indices, sizeof(s_volume_indices) / sizeof(unsigned int)) {
+        m_volume_vertex_array.add_vertex_buffer(m_volume_vertex_buffer);
+        m_volume_vertex_array.set_index_buffer(m_volume_index_buffer);
+        VertexArray::unbind();
+        m_render_width = m_gbuffer.get_width();
+        m_render_height = m_gbuffer.get_height();
+    }
+
+    bool DeferredRenderer::is_ready() const {
+        return m_gbuffer.is_complete() && m_fullscreen_program.is_compiled() && m_volume_program.is_compiled();
+    }
+
+    void DeferredRenderer::resize(const unsigned int width, const unsigned int height) {
+        m_gbuffer.resize(width, height);
+    }
+
+    void DeferredRenderer::begin_geometry_pass(const unsigned int width, const unsigned int height) {
+        m_render_width = std::min(width, m_gbuffer.get_width());
+        m_render_height = std::min(height, m_gbuffer.get_height());
+        m_gbuffer.bind();
+        m_gbuffer.clear();
+        Render_OpenGL::set_viewport(m_render_width, m_render_height);
+    }
+
+    void DeferredRenderer::lighting_pass(const size_t lights_count, const glm::mat4& projection, const glm::vec3& ambient_color,
+        const float diffuse_factor, const glm::vec3& sun_direction_eye, const glm::vec3& sun_radiance, const ShadowMaps& shadow_maps,
+        const Framebuffer* pTarget) {
+        //     ,    
+        if (pTarget) {
+            pTarget->bind();
+        }
+        else {
+            Framebuffer::unbind();
+        }
+        Render_OpenGL::set_viewport(m_render_width, m_render_height);
+        m_gbuffer.blit_depth(pTarget, m_render_width, m_render_height);
+        m_gbuffer.bind_color_texture(0, 0);
+        m_gbuffer.bind_color_texture(1, 1);
+        m_gbuffer.bind_depth_texture(2);
+
+        const glm::mat4 inverse_projection = glm::inverse(projection);
+        const glm::vec2 inverse_screen_size(1.f / m_render_width, 1.f / m_render_height);
+        const auto set_common_uniforms = [&](const ShaderProgram& program) {
+            program.set_matrix4("inverse_projection_matrix", inverse_projection);
+            program.set_vec2("inverse_screen_size", inverse_screen_size);
+            program.set_float("diffuse_factor", diffuse_factor);
+            program.set_float("max_shininess", s_max_shininess);
+            shadow_maps.bind(program);
+        };
+
+        //     0   
+        Render_OpenGL::set_depth_write(false);
+        Render_OpenGL::disable_depth_test();
+        m_fullscreen_program.bind();
+        set_common_uniforms(m_fullscreen_program);
+        m_fullscreen_program.set_vec3("ambient_color", ambient_color);
+        m_fullscreen_program.set_vec3("sun_direction_eye", sun_direction_eye);
+        m_fullscreen_program.set_vec3("sun_radiance", sun_radiance);
+        m_fullscreen_program.set_int("lights_count", static_cast<int>(lights_count));
+        Render_OpenGL::draw_arrays(m_fullscreen_vertex_array, 3);
+
+        //  :   ,  
+        if (lights_count > 1) {
+            Render_OpenGL::enable_depth_test();
+            Render_OpenGL::set_depth_function(EDepthFunction::GreaterOrEqual);
+            Render_OpenGL::set_face_culling(ECullFace::Front);
+            Render_OpenGL::set_additive_blending(true);
+            m_volume_program.bind();
+            set_common_uniforms(m_volume_program);
+            m_volume_program.set_matrix4("projection_matrix", projection);
+            m_volume_program.set_int("first_light", 1);
+            Render_OpenGL::draw_instanced(m_volume_vertex_array, lights_count - 1);
+            Render_OpenGL::set_additive_blending(false);
+            Render_OpenGL::set_face_culling(ECullFace::None);
+            Render_OpenGL::set_depth_function(EDepthFunction::Less);
+        }
+
+        //     
+        Render_OpenGL::enable_depth_test();
+        Render_OpenGL::set_depth_write(true);
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+#include "ShaderProgram.hpp"
+#include "VertexArray.hpp"
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+
+namespace MyEngine {
+
+    class ShadowMaps;
+
+    //  .     G- (12   ):
+    //   0 - RGBA8:    , 1 - RGB10A2:     ( )   / 128,
+    //    D24S8:       .
+    // G-    ,      ( ).
+    //      :     0 -  , 
+    //  -  (,    )  instanced    .
+    //         GEQUAL:  ,     
+    //  ,       .     LightClusters ( )
+    class DeferredRenderer {
+    public:
+        //   G-     
+        static constexpr float s_max_shininess = 128.f;
+
+        //  (   )
+        DeferredRenderer(const unsigned int width, const unsigned int height);
+
+        //      
+        DeferredRenderer(const DeferredRenderer&) = delete;
+        DeferredRenderer& operator=(const DeferredRenderer&) = delete;
+        DeferredRenderer& operator=(DeferredRenderer&&) = delete;
+        DeferredRenderer(DeferredRenderer&&) = delete;
+
+        //    G- 
+        bool is_ready() const;
+        //     
+        void resize(const unsigned int width, const unsigned int height);
+
+        //   : G-    (    0  1),
+        //   - width x height     (   G-)
+        void begin_geometry_pass(const unsigned int width, const unsigned int height);
+        //   pTarget (nullptr -    )    ,   G- 
+        //     . lights_count -     , ambient_color -  ,
+        //  (    )     0,  -   shadow_maps
+        void lighting_pass(const size_t lights_count, const glm::mat4& projection, const glm::vec3& ambient_color, const float diffuse_factor,
+            const glm::vec3& sun_direction_eye, const glm::vec3& sun_radiance, const ShadowMaps& shadow_maps, const Framebuffer* pTarget);
+
+        const Framebuffer& get_gbuffer() const { return m_gbuffer; }
+
+    private:
+        Framebuffer m_gbuffer;
+        //    G-
+        unsigned int m_render_width = 0;
+        unsigned int m_render_height = 0;
+        //      
+        ShaderProgram m_fullscreen_program;
+        ShaderProgram m_volume_program;
+        //     ,     
+        VertexArray m_fullscreen_vertex_array;
+        //    
+        VertexBuffer m_volume_vertex_buffer;
+        IndexBuffer m_volume_index_buffer;
+        VertexArray m_volume_vertex_array;
+    };
+
+}
\ No newline at end of file
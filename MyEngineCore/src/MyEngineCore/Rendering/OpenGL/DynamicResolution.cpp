@@ -0,0 +1,160 @@
+#include "DynamicResolution.hpp"
+#include "Render_OpenGL.hpp"
+
+#include <imgui/imgui.h>
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace MyEngine {
+
+    //     ,   :     
+    constexpr float s_decrease_gain = 0.3f;
+    constexpr float s_increase_gain = 0.05f;
+    //      
+    constexpr float s_dead_zone = 0.02f;
+
+    //     
+    static const char* s_upscale_vertex_shader =
+        R"(#version 460
+        void main() {
+            vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+            gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+        })";
+
+    //        4  .   , 
+    //      .       
+    static const char* s_upscale_fragment_shader =
+        R"(#version 460
+        layout(binding = 0) uniform sampler2D scene_color;
+        uniform vec2 inverse_output_size;
+        uniform vec2 render_scale;
+        uniform vec2 texel_size;
+        uniform vec2 max_uv;
+        uniform float sharpness;
+
+        out vec4 frag_color;
+
+        vec3 fetch(vec2 uv) {
+            return texture(scene_color, clamp(uv, texel_size * 0.5, max_uv)).rgb;
+        }
+
+        void main() {
+            vec2 uv = gl_FragCoord.xy * inverse_output_size * render_scale;
+            vec3 color = fetch(uv);
+            if (sharpness > 0.0) {
+                vec3 north = fetch(uv + vec2(0.0, texel_size.y));
+                vec3 south = fetch(uv - vec2(0.0, texel_size.y));
+                vec3 east = fetch(uv + vec2(texel_size.x, 0.0));
+                vec3 west = fetch(uv - vec2(texel_size.x, 0.0));
+                vec3 min_color = min(color, min(min(north, south), min(east, west)));
+                vec3 max_color = max(color, max(max(north, south), max(east, west)));
+                vec3 sharpened = color + (4.0 * color - north - south - east - west) * (0.25 * sharpness);
+                color = clamp(sharpened, min_color, max_color);
+            }
+            frag_color = vec4(color, 1.0);
+        })";
+
+    DynamicResolution::DynamicResolution(const unsigned int width, const unsigned int height)
+        : m_target(width, height, { ERenderTargetFormat::RGBA8 }, ERenderTargetFormat::Depth24Stencil8),
+        m_upscale_program(s_upscale_vertex_shader, s_upscale_fragment_shader), m_width(width), m_height(height) {
+        m_target.set_color_filtering(true);
+    }
+
+    bool DynamicResolution::is_ready() const {
+        return m_target.is_complete() && m_upscale_program.is_compiled();
+    }
+
+    void DynamicResolution::resize(const unsigned int width, const unsigned int height) {
+        if (width == 0 || height == 0) {
+            return;
+        }
+        m_width = width;
+        m_height = height;
+        m_target.resize(width, height);
+    }
+
+    void DynamicResolution::update(const double scene_gpu_ms, const bool enabled, const float target_gpu_ms, const float min_scale) {
+        m_enabled = enabled && is_ready();
+        m_scene_gpu_ms = scene_gpu_ms;
+        m_target_gpu_ms = target_gpu_ms;
+        if (!m_enabled) {
+            m_scale = 1.f;
+            return;
+        }
+        const float lower_scale = std::clamp(min_scale, s_min_scale_limit, 1.f);
+        float scale = m_scale;
+        if (scene_gpu_ms > 0.0 && target_gpu_ms > 0.f) {
+            const float desired_scale = std::clamp(m_scale * static_cast<float>(std::sqrt(target_gpu_ms / scene_gpu_ms)), lower_scale, 1.f);
+            const float difference = desired_scale - m_scale;
+            if (std::abs(difference) > s_dead_zone) {
+                scale += difference * (difference < 0.f ? s_decrease_gain : s_increase_gain);
+            }
+            else if (desired_scale == 1.f || desired_scale == lower_scale) {
+                //     
+                scale = desired_scale;
+            }
+        }
+        scale = std::clamp(scale, lower_scale, 1.f);
+        if (scale != m_scale) {
+            m_scale = scale;
+            ++m_scale_changes_count;
+        }
+    }
+
+    unsigned int DynamicResolution::get_scaled_size(const unsigned int size) const {
+        return std::max(static_cast<unsigned int>(std::lround(size * m_scale)), 1u);
+    }
+
+    unsigned int DynamicResolution::get_render_width() const {
+        return m_active ? get_scaled_size(m_width) : m_width;
+    }
+
+    unsigned int DynamicResolution::get_render_height() const {
+        return m_active ? get_scaled_size(m_height) : m_height;
+    }
+
+    void DynamicResolution::begin_frame() {
+        m_active = m_enabled;
+        if (m_active) {
+            m_target.bind();
+        }
+        else {
+            Framebuffer::unbind();
+        }
+        Render_OpenGL::set_viewport(get_render_width(), get_render_height());
+    }
+
+    void DynamicResolution::end_frame(const float sharpness) {
+        if (!m_active) {
+            return;
+        }
+        const glm::vec2 render_size(static_cast<float>(get_render_width()), static_cast<float>(get_render_height()));
+        const glm::vec2 target_size(static_cast<float>(m_target.get_width()), static_cast<float>(m_target.get_height()));
+        m_active = false;
+
+        Framebuffer::unbind();
+        Render_OpenGL::set_viewport(m_width, m_height);
+        Render_OpenGL::disable_depth_test();
+        m_upscale_program.bind();
+        m_target.bind_color_texture(0, 0);
+        m_upscale_program.set_vec2("inverse_output_size", glm::vec2(1.f / m_width, 1.f / m_height));
+        m_upscale_program.set_vec2("render_scale", render_size / target_size);
+        m_upscale_program.set_vec2("texel_size", 1.f / target_size);
+        m_upscale_program.set_vec2("max_uv", (render_size - 0.5f) / target_size);
+        m_upscale_program.set_float("sharpness", std::max(sharpness, 0.f));
+        Render_OpenGL::draw_arrays(m_fullscreen_vertex_array, 3);
+        Render_OpenGL::enable_depth_test();
+    }
+
+    void DynamicResolution::on_ui_draw() {
+        ImGui::Begin("Dynamic resolution");
+        ImGui::Text("Mode: %s", m_enabled ? "on" : is_ready() ? "off" : "unavailable");
+        ImGui::Text("Scale: %.0f%% (%ux%u of %ux%u)", m_scale * 100.f, get_scaled_size(m_width), get_scaled_size(m_height), m_width, m_height);
+        ImGui::Text("Scene GPU: %.3f ms (target %.2f ms)", m_scene_gpu_ms, m_target_gpu_ms);
+        ImGui::Text("Scale changes: %zu", m_scale_changes_count);
+        ImGui::End();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+#include "ShaderProgram.hpp"
+#include "VertexArray.hpp"
+
+#include <cstddef>
+
+namespace MyEngine {
+
+    //  .       ,      (  ):
+    //       1 ,   GPU     .
+    //      ,    -  * sqrt( / ).
+    //     ,      :  ,  ,
+    //     .       .
+    //       (    ), ImGui 
+    //    
+    class DynamicResolution {
+    public:
+        //    
+        static constexpr float s_min_scale_limit = 0.25f;
+
+        //  (   )
+        DynamicResolution(const unsigned int width, const unsigned int height);
+
+        //      
+        DynamicResolution(const DynamicResolution&) = delete;
+        DynamicResolution& operator=(const DynamicResolution&) = delete;
+        DynamicResolution& operator=(DynamicResolution&&) = delete;
+        DynamicResolution(DynamicResolution&&) = delete;
+
+        //      
+        bool is_ready() const;
+        //     
+        void resize(const unsigned int width, const unsigned int height);
+
+        //     GPU   (0 -   ). enabled == false -     
+        void update(const double scene_gpu_ms, const bool enabled, const float target_gpu_ms, const float min_scale);
+        //  :   (   )     
+        void begin_frame();
+        //    ,         .
+        // sharpness -    (0 -   )
+        void end_frame(const float sharpness);
+
+        //    (nullptr -    )   
+        const Framebuffer* get_scene_target() const { return m_active ? &m_target : nullptr; }
+        unsigned int get_render_width() const;
+        unsigned int get_render_height() const;
+        float get_scale() const { return m_scale; }
+
+        //  
+        void on_ui_draw();
+
+    private:
+        //     
+        unsigned int get_scaled_size(const unsigned int size) const;
+
+        Framebuffer m_target;
+        ShaderProgram m_upscale_program;
+        //     
+        VertexArray m_fullscreen_vertex_array;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        //  ,          
+        float m_scale = 1.f;
+        bool m_enabled = false;
+        bool m_active = false;
+        //     ( )
+        double m_scene_gpu_ms = 0.0;
+        float m_target_gpu_ms = 0.f;
+        size_t m_scale_changes_count = 0;
+    };
+
+}
\ No newline at end of file
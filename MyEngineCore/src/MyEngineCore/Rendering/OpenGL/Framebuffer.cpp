@@ -0,0 +1,255 @@
+#include "Framebuffer.hpp"
+#include "GpuMemoryTracker.hpp"
+#include "Render_OpenGL.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <glad/glad.h>
+
+namespace MyEngine {
+
+    //   OpenGL
+    unsigned int Framebuffer::get_internal_format(const ERenderTargetFormat format) {
+        switch (format) {
+        case ERenderTargetFormat::RGBA8: return GL_RGBA8;
+        case ERenderTargetFormat::RGB10A2: return GL_RGB10_A2;
+        case ERenderTargetFormat::RG16F: return GL_RG16F;
+        case ERenderTargetFormat::RGBA16F: return GL_RGBA16F;
+        case ERenderTargetFormat::R32F: return GL_R32F;
+        case ERenderTargetFormat::Depth24Stencil8: return GL_DEPTH24_STENCIL8;
+        case ERenderTargetFormat::Depth32F: return GL_DEPTH_COMPONENT32F;
+        }
+        return GL_RGBA8;
+    }
+
+    //    
+    size_t Framebuffer::get_pixel_size(const ERenderTargetFormat format) {
+        switch (format) {
+        case ERenderTargetFormat::RGBA8: return 4;
+        case ERenderTargetFormat::RGB10A2: return 4;
+        case ERenderTargetFormat::RG16F: return 4;
+        case ERenderTargetFormat::RGBA16F: return 8;
+        case ERenderTargetFormat::R32F: return 4;
+        case ERenderTargetFormat::Depth24Stencil8: return 4;
+        case ERenderTargetFormat::Depth32F: return 4;
+        }
+        return 4;
+    }
+
+    // 
+    Framebuffer::Framebuffer(const unsigned int width, const unsigned int height, std::initializer_list<ERenderTargetFormat> color_formats,
+        const ERenderTargetFormat depth_format)
+        : m_width(width), m_height(height), m_color_formats(color_formats), m_depth_format(depth_format) {
+        create_targets();
+    }
+
+    //        
+    void Framebuffer::create_targets() {
+        glCreateFramebuffers(1, &m_id);
+        const auto create_texture = [this](const ERenderTargetFormat format) {
+            GLuint texture = 0;
+            glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+            glTextureStorage2D(texture, 1, get_internal_format(format), m_width, m_height);
+            glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            return texture;
+        };
+
+        std::vector<GLenum> draw_buffers;
+        m_color_textures.resize(m_color_formats.size());
+        for (size_t i = 0; i < m_color_formats.size(); ++i) {
+            m_color_textures[i] = create_texture(m_color_formats[i]);
+            glNamedFramebufferTexture(m_id, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i), m_color_textures[i], 0);
+            draw_buffers.push_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
+        }
+        m_depth_texture = create_texture(m_depth_format);
+        if (m_depth_compare) {
+            set_depth_compare(true);
+        }
+        if (m_linear_filtering) {
+            set_color_filtering(true);
+        }
+        glNamedFramebufferTexture(m_id, m_depth_format == ERenderTargetFormat::Depth24Stencil8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT,
+            m_depth_texture, 0);
+        if (draw_buffers.empty()) {
+            glNamedFramebufferDrawBuffer(m_id, GL_NONE);
+            glNamedFramebufferReadBuffer(m_id, GL_NONE);
+        }
+        else {
+            glNamedFramebufferDrawBuffers(m_id, static_cast<GLsizei>(draw_buffers.size()), draw_buffers.data());
+        }
+
+        const GLenum status = glCheckNamedFramebufferStatus(m_id, GL_FRAMEBUFFER);
+        m_is_complete = status == GL_FRAMEBUFFER_COMPLETE;
+        if (!m_is_complete) {
+            LOG_CATEGORY_ERROR(Render, "Framebuffer {0}x{1} is incomplete: status 0x{2:x}", m_width, m_height, status);
+        }
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::RenderTargets, get_memory_size());
+    }
+
+    //     
+    void Framebuffer::delete_targets() {
+        if (m_id) {
+            GpuMemoryTracker::on_free(EGpuMemoryCategory::RenderTargets, get_memory_size());
+        }
+        for (const unsigned int texture : m_color_textures) {
+            Render_OpenGL::on_texture_deleted(texture);
+        }
+        Render_OpenGL::on_texture_deleted(m_depth_texture);
+        Render_OpenGL::on_framebuffer_deleted(m_id);
+        glDeleteTextures(static_cast<GLsizei>(m_color_textures.size()), m_color_textures.data());
+        glDeleteTextures(1, &m_depth_texture);
+        glDeleteFramebuffers(1, &m_id);
+        m_color_textures.clear();
+        m_depth_texture = 0;
+        m_id = 0;
+    }
+
+    //     (     )
+    void Framebuffer::resize(const unsigned int width, const unsigned int height) {
+        if (width == 0 || height == 0 || (width == m_width && height == m_height)) {
+            return;
+        }
+        delete_targets();
+        m_width = width;
+        m_height = height;
+        create_targets();
+    }
+
+    //  
+    size_t Framebuffer::get_memory_size() const {
+        size_t pixel_size = get_pixel_size(m_depth_format);
+        for (const ERenderTargetFormat format : m_color_formats) {
+            pixel_size += get_pixel_size(format);
+        }
+        return pixel_size * m_width * m_height;
+    }
+
+    //   
+    void Framebuffer::bind() const {
+        Render_OpenGL::bind_framebuffer(m_id);
+        Render_OpenGL::set_viewport(m_width, m_height);
+    }
+
+    //   
+    void Framebuffer::unbind() {
+        Render_OpenGL::bind_framebuffer(0);
+    }
+
+    //  
+    void Framebuffer::clear() const {
+        const GLfloat zero[4] = { 0.f, 0.f, 0.f, 0.f };
+        for (size_t i = 0; i < m_color_textures.size(); ++i) {
+            glClearNamedFramebufferfv(m_id, GL_COLOR, static_cast<GLint>(i), zero);
+        }
+        if (m_depth_format == ERenderTargetFormat::Depth24Stencil8) {
+            glClearNamedFramebufferfi(m_id, GL_DEPTH_STENCIL, 0, 1.f, 0);
+        }
+        else {
+            const GLfloat one = 1.f;
+            glClearNamedFramebufferfv(m_id, GL_DEPTH, 0, &one);
+        }
+    }
+
+    void Framebuffer::clear_depth_region(const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height) const {
+        if (m_depth_format == ERenderTargetFormat::Depth24Stencil8) {
+            //    24 
+            const GLuint value = 0xFFFFFF00u;
+            glClearTexSubImage(m_depth_texture, 0, x, y, 0, width, height, 1, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, &value);
+        }
+        else {
+            const GLfloat one = 1.f;
+            glClearTexSubImage(m_depth_texture, 0, x, y, 0, width, height, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &one);
+        }
+    }
+
+    //    
+    void Framebuffer::bind_color_texture(const size_t index, const unsigned int unit) const {
+        Render_OpenGL::bind_texture_unit(unit, m_color_textures[index]);
+    }
+
+    void Framebuffer::bind_depth_texture(const unsigned int unit) const {
+        Render_OpenGL::bind_texture_unit(unit, m_depth_texture);
+    }
+
+    //    :  1,      
+    void Framebuffer::set_depth_compare(const bool enabled) {
+        m_depth_compare = enabled;
+        if (!m_depth_texture) {
+            return;
+        }
+        glTextureParameteri(m_depth_texture, GL_TEXTURE_COMPARE_MODE, enabled ? GL_COMPARE_REF_TO_TEXTURE : GL_NONE);
+        glTextureParameteri(m_depth_texture, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glTextureParameteri(m_depth_texture, GL_TEXTURE_MIN_FILTER, enabled ? GL_LINEAR : GL_NEAREST);
+        glTextureParameteri(m_depth_texture, GL_TEXTURE_MAG_FILTER, enabled ? GL_LINEAR : GL_NEAREST);
+    }
+
+    //   
+    void Framebuffer::set_color_filtering(const bool linear) {
+        m_linear_filtering = linear;
+        for (const unsigned int texture : m_color_textures) {
+            glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, linear ? GL_LINEAR : GL_NEAREST);
+            glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, linear ? GL_LINEAR : GL_NEAREST);
+        }
+    }
+
+    //  
+    void Framebuffer::blit_depth(const Framebuffer* pTarget, const unsigned int width, const unsigned int height) const {
+        glBlitNamedFramebuffer(m_id, pTarget ? pTarget->m_id : 0, 0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+    }
+
+    void Framebuffer::read_depth(const Framebuffer* pSource, const unsigned int width, const unsigned int height) const {
+        glBlitNamedFramebuffer(pSource ? pSource->m_id : 0, m_id, 0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+    }
+
+    //  
+    void Framebuffer::blit_color(const Framebuffer* pTarget, const unsigned int width, const unsigned int height) const {
+        glBlitNamedFramebuffer(m_id, pTarget ? pTarget->m_id : 0, 0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    }
+
+    //     (- ,  pPixels     )
+    void Framebuffer::upload_color(const size_t index, const unsigned int width, const unsigned int height, const void* pPixels) const {
+        Render_OpenGL::bind_pixel_unpack_buffer(0);
+        glTextureSubImage2D(m_color_textures[index], 0, 0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA,
+            GL_UNSIGNED_BYTE, pPixels);
+        Render_OpenGL::on_texture_uploaded(static_cast<size_t>(width) * height * 4);
+    }
+
+    // 
+    Framebuffer::~Framebuffer() {
+        delete_targets();
+    }
+
+    //  
+    Framebuffer& Framebuffer::operator=(Framebuffer&& framebuffer) noexcept {
+        delete_targets();
+        m_id = framebuffer.m_id;
+        m_color_textures = std::move(framebuffer.m_color_textures);
+        m_depth_texture = framebuffer.m_depth_texture;
+        m_width = framebuffer.m_width;
+        m_height = framebuffer.m_height;
+        m_color_formats = std::move(framebuffer.m_color_formats);
+        m_depth_format = framebuffer.m_depth_format;
+        m_depth_compare = framebuffer.m_depth_compare;
+        m_linear_filtering = framebuffer.m_linear_filtering;
+        m_is_complete = framebuffer.m_is_complete;
+        framebuffer.m_id = 0;
+        framebuffer.m_color_textures.clear();
+        framebuffer.m_depth_texture = 0;
+        return *this;
+    }
+
+    //  
+    Framebuffer::Framebuffer(Framebuffer&& framebuffer) noexcept
+        : m_id(framebuffer.m_id), m_color_textures(std::move(framebuffer.m_color_textures)), m_depth_texture(framebuffer.m_depth_texture),
+        m_width(framebuffer.m_width), m_height(framebuffer.m_height), m_color_formats(std::move(framebuffer.m_color_formats)),
+        m_depth_format(framebuffer.m_depth_format), m_depth_compare(framebuffer.m_depth_compare),
+        m_linear_filtering(framebuffer.m_linear_filtering), m_is_complete(framebuffer.m_is_complete) {
+        framebuffer.m_id = 0;
+        framebuffer.m_color_textures.clear();
+        framebuffer.m_depth_texture = 0;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+namespace MyEngine {
+
+    //   
+    enum class ERenderTargetFormat {
+        RGBA8,
+        RGB10A2,
+        RG16F,
+        RGBA16F,
+        R32F,
+        Depth24Stencil8,
+        Depth32F
+    };
+
+    //    -:    (    )  .
+    //   ,   texelFetch    GL_NEAREST
+    class Framebuffer {
+    public:
+        //  (     )  
+        Framebuffer(const unsigned int width, const unsigned int height, std::initializer_list<ERenderTargetFormat> color_formats,
+            const ERenderTargetFormat depth_format = ERenderTargetFormat::Depth24Stencil8);
+        ~Framebuffer();
+
+        //      
+        Framebuffer(const Framebuffer&) = delete;
+        Framebuffer& operator=(const Framebuffer&) = delete;
+        Framebuffer& operator=(Framebuffer&& framebuffer) noexcept;
+        Framebuffer(Framebuffer&& framebuffer) noexcept;
+
+        //    (  -  )       
+        void bind() const;
+        static void unbind();
+        //   :  - ,  - 
+        void clear() const;
+        //       ( )
+        void clear_depth_region(const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height) const;
+        //      ( )
+        void resize(const unsigned int width, const unsigned int height);
+
+        //      
+        void bind_color_texture(const size_t index, const unsigned int unit) const;
+        void bind_depth_texture(const unsigned int unit) const;
+        //     (sampler2DShadow,    ),   resize
+        void set_depth_compare(const bool enabled);
+        //     ( ),   resize
+        void set_color_filtering(const bool linear);
+        //    width x height      pTarget (nullptr -    ).
+        //    
+        void blit_depth(const Framebuffer* pTarget, const unsigned int width, const unsigned int height) const;
+        //  :    pSource (nullptr -    )   
+        void read_depth(const Framebuffer* pSource, const unsigned int width, const unsigned int height) const;
+        //      width x height  pTarget (nullptr -    )
+        void blit_color(const Framebuffer* pTarget, const unsigned int width, const unsigned int height) const;
+        //     index  width x height       (RGBA8,   )
+        void upload_color(const size_t index, const unsigned int width, const unsigned int height, const void* pPixels) const;
+
+        bool is_complete() const { return m_is_complete; }
+        unsigned int get_width() const { return m_width; }
+        unsigned int get_height() const { return m_height; }
+        size_t get_color_targets_count() const { return m_color_formats.size(); }
+        //    
+        size_t get_memory_size() const;
+
+        //   OpenGL    
+        static unsigned int get_internal_format(const ERenderTargetFormat format);
+        static size_t get_pixel_size(const ERenderTargetFormat format);
+
+    private:
+        //        
+        void create_targets();
+        void delete_targets();
+
+        // id    , 
+        unsigned int m_id = 0;
+        std::vector<unsigned int> m_color_textures;
+        unsigned int m_depth_texture = 0;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        //  
+        std::vector<ERenderTargetFormat> m_color_formats;
+        ERenderTargetFormat m_depth_format = ERenderTargetFormat::Depth24Stencil8;
+        bool m_depth_compare = false;
+        bool m_linear_filtering = false;
+        bool m_is_complete = false;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,521 @@
+#include "GpuCulling.hpp"
+#include "GpuMemoryTracker.hpp"
+#include "Mesh.hpp"
+#include "Render_OpenGL.hpp"
+
+#include "MyEngineCore/Camera.hpp"
+#include "MyEngineCore/Log.hpp"
+#include "MyEngineCore/Core/TransformBatch.hpp"
+
+#include <glad/glad.h>
+#include <imgui/imgui.h>
+#include <glm/geometric.hpp>
+#include <glm/vec2.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace MyEngine {
+
+    //  :    X   65535
+    constexpr size_t s_max_instances = static_cast<size_t>(65535) * GpuCulling::s_cull_group_size;
+
+    //  :  ,     ,    
+    static const char* s_cull_compute_shader =
+        R"(#version 460
+        layout(local_size_x = 64) in;
+
+        struct GpuInstance {
+            mat4 model;
+            vec4 sphere;
+        };
+        layout(std430, binding = 7) readonly buffer GpuInstancesBuffer {
+            GpuInstance gpu_instances[];
+        };
+        layout(std430, binding = 8) writeonly buffer VisibleInstancesBuffer {
+            uint visible_instances[];
+        };
+        layout(std430, binding = 9) buffer CullCommandBuffer {
+            uint indices_count;
+            uint instance_count;
+            uint first_index;
+            int base_vertex;
+            uint base_instance;
+            uint frustum_culled_count;
+            uint occluded_count;
+        };
+        layout(binding = 0) uniform sampler2D depth_pyramid;
+        uniform vec4 frustum_planes[6];
+        uniform int instances_count;
+        // :  ,    ,       (0 -  )
+        uniform mat4 pyramid_view_projection;
+        uniform vec2 pyramid_source_size;
+        uniform int pyramid_levels;
+
+        shared uint group_visible_count;
+        shared uint group_frustum_culled_count;
+        shared uint group_occluded_count;
+        shared uint group_first_slot;
+
+        bool is_in_frustum(vec4 sphere) {
+            for (int i = 0; i < 6; ++i) {
+                if (dot(frustum_planes[i].xyz, sphere.xyz) + frustum_planes[i].w < -sphere.w) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //       .          
+        //   ,     :        
+        bool is_occluded(vec4 sphere) {
+            vec3 ndc_min = vec3(1.0);
+            vec3 ndc_max = vec3(-1.0);
+            for (int i = 0; i < 8; ++i) {
+                vec3 corner = sphere.xyz + sphere.w * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+                vec4 clip = pyramid_view_projection * vec4(corner, 1.0);
+                if (clip.w <= 0.0) {
+                    return false;
+                }
+                vec3 ndc = clip.xyz / clip.w;
+                ndc_min = i == 0 ? ndc : min(ndc_min, ndc);
+                ndc_max = i == 0 ? ndc : max(ndc_max, ndc);
+            }
+            if (ndc_min.z < -1.0 || any(lessThan(ndc_min.xy, vec2(-1.0))) || any(greaterThan(ndc_max.xy, vec2(1.0)))) {
+                return false;
+            }
+            float nearest_depth = ndc_min.z * 0.5 + 0.5;
+
+            // ,       2     (  L - 2^(L+1) ).
+            //       ,     :  
+            //          
+            vec2 pixel_min = max((ndc_min.xy * 0.5 + 0.5) * pyramid_source_size - 1.0, vec2(0.0));
+            vec2 pixel_max = min((ndc_max.xy * 0.5 + 0.5) * pyramid_source_size + 1.0, pyramid_source_size);
+            float extent = max(max(pixel_max.x - pixel_min.x, pixel_max.y - pixel_min.y), 1.0);
+            int level = clamp(int(ceil(log2(extent))) - 1, 0, pyramid_levels - 1);
+            //    (   ,    )
+            ivec2 level_size = ivec2(pyramid_source_size);
+            for (int i = 0; i <= level; ++i) {
+                level_size = max((level_size + 1) / 2, ivec2(1));
+            }
+            float texel_size = exp2(float(level + 1));
+            ivec2 texel_min = clamp(ivec2(pixel_min / texel_size), ivec2(0), level_size - 1);
+            ivec2 texel_max = clamp(ivec2(pixel_max / texel_size), texel_min, min(texel_min + 1, level_size - 1));
+
+            float farthest_depth = 0.0;
+            for (int y = texel_min.y; y <= texel_max.y; ++y) {
+                for (int x = texel_min.x; x <= texel_max.x; ++x) {
+                    farthest_depth = max(farthest_depth, texelFetch(depth_pyramid, ivec2(x, y), level).r);
+                }
+            }
+            return nearest_depth > farthest_depth;
+        }
+
+        void main() {
+            if (gl_LocalInvocationIndex == 0) {
+                group_visible_count = 0u;
+                group_frustum_culled_count = 0u;
+                group_occluded_count = 0u;
+            }
+            barrier();
+
+            uint index = gl_GlobalInvocationID.x;
+            bool visible = false;
+            uint local_slot = 0u;
+            if (index < uint(instances_count)) {
+                vec4 sphere = gpu_instances[index].sphere;
+                if (!is_in_frustum(sphere)) {
+                    atomicAdd(group_frustum_culled_count, 1u);
+                }
+                else if (pyramid_levels > 0 && is_occluded(sphere)) {
+                    atomicAdd(group_occluded_count, 1u);
+                }
+                else {
+                    visible = true;
+                    local_slot = atomicAdd(group_visible_count, 1u);
+                }
+            }
+            barrier();
+
+            //      
+            if (gl_LocalInvocationIndex == 0) {
+                group_first_slot = atomicAdd(instance_count, group_visible_count);
+                atomicAdd(frustum_culled_count, group_frustum_culled_count);
+                atomicAdd(occluded_count, group_occluded_count);
+            }
+            barrier();
+            if (visible) {
+                visible_instances[group_first_slot + local_slot] = index;
+            }
+        })";
+
+    //   :   2 x 2 - (   )
+    static const char* s_pyramid_common_source =
+        R"(#version 460
+        layout(local_size_x = 8, local_size_y = 8) in;
+        layout(r32f, binding = 0) uniform writeonly image2D destination_level;
+        uniform vec2 source_size;
+        uniform vec2 destination_size;
+        )";
+
+    //      
+    static const char* s_pyramid_depth_source =
+        R"(
+        layout(binding = 0) uniform sampler2D source_depth;
+        float read_source(ivec2 pixel) {
+            return texelFetch(source_depth, pixel, 0).r;
+        }
+        )";
+
+    //  -   
+    static const char* s_pyramid_reduce_source =
+        R"(
+        layout(r32f, binding = 1) uniform readonly image2D source_level;
+        float read_source(ivec2 pixel) {
+            return imageLoad(source_level, pixel).r;
+        }
+        )";
+
+    static const char* s_pyramid_main_source =
+        R"(
+        void main() {
+            ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+            if (any(greaterThanEqual(texel, ivec2(destination_size)))) {
+                return;
+            }
+            ivec2 last = ivec2(source_size) - 1;
+            ivec2 source = texel * 2;
+            float depth = max(max(read_source(min(source, last)), read_source(min(source + ivec2(1, 0), last))),
+                max(read_source(min(source + ivec2(0, 1), last)), read_source(min(source + ivec2(1, 1), last))));
+            imageStore(destination_level, texel, vec4(depth));
+        })";
+
+    //     
+    static const char* s_instances_shader_source =
+        R"(
+        struct GpuInstance {
+            mat4 model;
+            vec4 sphere;
+        };
+        layout(std430, binding = 7) readonly buffer GpuInstancesBuffer {
+            GpuInstance gpu_instances[];
+        };
+        layout(std430, binding = 8) readonly buffer VisibleInstancesBuffer {
+            uint visible_instances[];
+        };
+
+        mat4 get_instance_model() {
+            return gpu_instances[visible_instances[gl_InstanceID]].model;
+        }
+        )";
+
+    //     (    )
+    static const char* s_frustum_plane_names[6] = {
+        "frustum_planes[0]", "frustum_planes[1]", "frustum_planes[2]", "frustum_planes[3]", "frustum_planes[4]", "frustum_planes[5]"
+    };
+
+    //       size
+    static unsigned int get_level_size(const unsigned int size) {
+        return std::max((size + 1) / 2, 1u);
+    }
+
+    //    :      .   OpenGL 
+    //   ,  - ;     ,  glTextureStorage2D 
+    // -   (, 5 -> 3 -> 2 -> 1  5 -> 2 -> 1)
+    static unsigned int get_pyramid_size(const unsigned int size) {
+        unsigned int pyramid_size = 1;
+        while (pyramid_size < get_level_size(size)) {
+            pyramid_size *= 2;
+        }
+        return pyramid_size;
+    }
+
+    GpuCulling::GpuCulling(const unsigned int width, const unsigned int height)
+        : m_cull_program(s_cull_compute_shader),
+        m_pyramid_depth_program((std::string(s_pyramid_common_source) + s_pyramid_depth_source + s_pyramid_main_source).c_str()),
+        m_pyramid_reduce_program((std::string(s_pyramid_common_source) + s_pyramid_reduce_source + s_pyramid_main_source).c_str()),
+        m_depth_copy(width, height, {}, ERenderTargetFormat::Depth24Stencil8), m_width(width), m_height(height) {
+        glCreateBuffers(1, &m_command_buffer);
+        glNamedBufferStorage(m_command_buffer, sizeof(CullCommand), nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+        //     ,  fence,   
+        const GLbitfield readback_flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_readback_buffer);
+        glNamedBufferStorage(m_readback_buffer, sizeof(CullCommand) * s_readback_count, nullptr, readback_flags);
+        m_pReadback = static_cast<const CullCommand*>(glMapNamedBufferRange(m_readback_buffer, 0, sizeof(CullCommand) * s_readback_count,
+            readback_flags));
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::Staging, sizeof(CullCommand) * (s_readback_count + 1));
+        create_pyramid();
+    }
+
+    GpuCulling::~GpuCulling() {
+        for (void*& fence : m_readback_fences) {
+            if (fence) {
+                glDeleteSync(static_cast<GLsync>(fence));
+                fence = nullptr;
+            }
+        }
+        if (m_pReadback) {
+            glUnmapNamedBuffer(m_readback_buffer);
+        }
+        for (const GLuint buffer : { m_command_buffer, m_readback_buffer, m_instances_buffer, m_visible_buffer }) {
+            Render_OpenGL::on_buffer_deleted(buffer);
+        }
+        glDeleteBuffers(1, &m_command_buffer);
+        glDeleteBuffers(1, &m_readback_buffer);
+        glDeleteBuffers(1, &m_instances_buffer);
+        glDeleteBuffers(1, &m_visible_buffer);
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::Staging, sizeof(CullCommand) * (s_readback_count + 1));
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::VertexBuffers, m_instances_capacity * (sizeof(GpuInstance) + sizeof(uint32_t)));
+        delete_pyramid();
+    }
+
+    bool GpuCulling::is_ready() const {
+        return m_cull_program.is_compiled() && m_pyramid_depth_program.is_compiled() && m_pyramid_reduce_program.is_compiled()
+            && m_depth_copy.is_complete() && m_pReadback;
+    }
+
+    void GpuCulling::resize(const unsigned int width, const unsigned int height) {
+        if (width == 0 || height == 0) {
+            return;
+        }
+        delete_pyramid();
+        m_width = width;
+        m_height = height;
+        m_depth_copy.resize(width, height);
+        create_pyramid();
+    }
+
+    //     (    ):   1 x 1,    texelFetch
+    void GpuCulling::create_pyramid() {
+        unsigned int width = get_pyramid_size(m_width);
+        unsigned int height = get_pyramid_size(m_height);
+        m_pyramid_allocated_levels = 1;
+        for (unsigned int size = std::max(width, height); size > 1; size = get_level_size(size)) {
+            ++m_pyramid_allocated_levels;
+        }
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_pyramid_texture);
+        glTextureStorage2D(m_pyramid_texture, static_cast<GLsizei>(m_pyramid_allocated_levels), GL_R32F, width, height);
+        glTextureParameteri(m_pyramid_texture, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTextureParameteri(m_pyramid_texture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_pyramid_texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_pyramid_texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        m_pyramid_memory_size = 0;
+        for (unsigned int level = 0; level < m_pyramid_allocated_levels; ++level) {
+            m_pyramid_memory_size += static_cast<size_t>(width) * height * sizeof(float);
+            width = get_level_size(width);
+            height = get_level_size(height);
+        }
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::RenderTargets, m_pyramid_memory_size);
+        m_pyramid_levels = 0;
+    }
+
+    //     ,       
+    void GpuCulling::delete_pyramid() {
+        if (!m_pyramid_texture) {
+            return;
+        }
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::RenderTargets, m_pyramid_memory_size);
+        m_pyramid_memory_size = 0;
+        Render_OpenGL::on_texture_deleted(m_pyramid_texture);
+        glDeleteTextures(1, &m_pyramid_texture);
+        m_pyramid_texture = 0;
+        m_pyramid_levels = 0;
+    }
+
+    //       
+    void GpuCulling::reserve(const size_t instances_count) {
+        if (instances_count <= m_instances_capacity) {
+            return;
+        }
+        if (m_instances_buffer) {
+            Render_OpenGL::on_buffer_deleted(m_instances_buffer);
+            Render_OpenGL::on_buffer_deleted(m_visible_buffer);
+            glDeleteBuffers(1, &m_instances_buffer);
+            glDeleteBuffers(1, &m_visible_buffer);
+            GpuMemoryTracker::on_free(EGpuMemoryCategory::VertexBuffers, m_instances_capacity * (sizeof(GpuInstance) + sizeof(uint32_t)));
+        }
+        m_instances_capacity = instances_count;
+        glCreateBuffers(1, &m_instances_buffer);
+        glNamedBufferStorage(m_instances_buffer, m_instances_capacity * sizeof(GpuInstance), nullptr, GL_DYNAMIC_STORAGE_BIT);
+        glCreateBuffers(1, &m_visible_buffer);
+        glNamedBufferStorage(m_visible_buffer, m_instances_capacity * sizeof(uint32_t), nullptr, 0);
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::VertexBuffers, m_instances_capacity * (sizeof(GpuInstance) + sizeof(uint32_t)));
+    }
+
+    void GpuCulling::set_instances(const TransformsSoA& transforms, const Mesh& mesh) {
+        size_t instances_count = transforms.size();
+        if (instances_count > s_max_instances) {
+            LOG_CATEGORY_WARN(Render, "GpuCulling: {0} instances requested, only {1} are culled", instances_count, s_max_instances);
+            instances_count = s_max_instances;
+        }
+        m_instances_count = instances_count;
+        m_stats.instances_count = instances_count;
+        if (instances_count == 0) {
+            return;
+        }
+        reserve(instances_count);
+
+        // :      ,    
+        const MeshBounds& bounds = mesh.get_bounds();
+        const glm::vec3 bounds_center(bounds.center[0], bounds.center[1], bounds.center[2]);
+        std::vector<GpuInstance> instances(instances_count);
+        for (size_t i = 0; i < instances_count; ++i) {
+            const glm::vec3 position(transforms.position_x[i], transforms.position_y[i], transforms.position_z[i]);
+            const glm::quat rotation(transforms.rotation_w[i], transforms.rotation_x[i], transforms.rotation_y[i], transforms.rotation_z[i]);
+            const glm::vec3 scale(transforms.scale_x[i], transforms.scale_y[i], transforms.scale_z[i]);
+            glm::mat4 model = glm::mat4_cast(rotation);
+            model[0] *= scale.x;
+            model[1] *= scale.y;
+            model[2] *= scale.z;
+            model[3] = glm::vec4(position, 1.f);
+            instances[i].model = model;
+            instances[i].sphere = glm::vec4(glm::vec3(model * glm::vec4(bounds_center, 1.f)),
+                bounds.radius * std::max(std::abs(scale.x), std::max(std::abs(scale.y), std::abs(scale.z))));
+        }
+        glNamedBufferSubData(m_instances_buffer, 0, instances_count * sizeof(GpuInstance), instances.data());
+        Render_OpenGL::on_buffer_uploaded(instances_count * sizeof(GpuInstance));
+        ++m_stats.instance_uploads_count;
+    }
+
+    //     :        , 
+    //      fence (GPU    )     
+    void GpuCulling::read_counters() {
+        for (size_t i = 0; i < s_readback_count; ++i) {
+            const size_t slot = (m_readback_next + i) % s_readback_count;
+            GLsync fence = static_cast<GLsync>(m_readback_fences[slot]);
+            if (!fence) {
+                continue;
+            }
+            if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0) == GL_TIMEOUT_EXPIRED) {
+                return;
+            }
+            glDeleteSync(fence);
+            m_readback_fences[slot] = nullptr;
+
+            const CullCommand& counters = m_pReadback[slot];
+            m_stats.visible_count = counters.instance_count;
+            m_stats.frustum_culled_count = counters.frustum_culled_count;
+            m_stats.occluded_count = counters.occluded_count;
+        }
+    }
+
+    void GpuCulling::cull(Camera& camera, const Mesh& mesh, const bool occlusion) {
+        m_stats.occlusion_active = occlusion && m_pyramid_levels > 0;
+        m_stats.pyramid_levels_count = m_pyramid_levels;
+        if (!is_ready() || m_instances_count == 0) {
+            return;
+        }
+        read_counters();
+
+        //     0,   
+        const MeshSubmesh& submesh = mesh.get_submeshes()[mesh.get_lods()[0].first_submesh];
+        const CullCommand command{ submesh.indices_count, 0, submesh.first_index, submesh.base_vertex, 0, 0, 0, 0 };
+        glNamedBufferSubData(m_command_buffer, 0, sizeof(CullCommand), &command);
+        Render_OpenGL::on_buffer_uploaded(sizeof(CullCommand));
+
+        m_cull_program.bind();
+        const std::array<glm::vec4, 6> planes = camera.get_frustum_planes();
+        for (size_t i = 0; i < planes.size(); ++i) {
+            m_cull_program.set_vec4(s_frustum_plane_names[i], planes[i]);
+        }
+        m_cull_program.set_int("instances_count", static_cast<int>(m_instances_count));
+        m_cull_program.set_int("pyramid_levels", m_stats.occlusion_active ? static_cast<int>(m_pyramid_levels) : 0);
+        if (m_stats.occlusion_active) {
+            m_cull_program.set_matrix4("pyramid_view_projection", m_pyramid_view_projection);
+            m_cull_program.set_vec2("pyramid_source_size",
+                glm::vec2(static_cast<float>(m_pyramid_source_width), static_cast<float>(m_pyramid_source_height)));
+            Render_OpenGL::bind_texture_unit(0, m_pyramid_texture);
+        }
+        Render_OpenGL::bind_storage_buffer(s_instances_binding, m_instances_buffer, 0, m_instances_count * sizeof(GpuInstance));
+        Render_OpenGL::bind_storage_buffer(s_visible_binding, m_visible_buffer, 0, m_instances_count * sizeof(uint32_t));
+        Render_OpenGL::bind_storage_buffer(s_command_binding, m_command_buffer, 0, sizeof(CullCommand));
+        Render_OpenGL::dispatch_compute(static_cast<unsigned int>((m_instances_count + s_cull_group_size - 1) / s_cull_group_size));
+        Render_OpenGL::memory_barrier(EMemoryBarrier::Command | EMemoryBarrier::StorageBuffer | EMemoryBarrier::BufferUpdate);
+
+        //            .  GPU    ,
+        //         
+        if (m_readback_fences[m_readback_next]) {
+            glDeleteSync(static_cast<GLsync>(m_readback_fences[m_readback_next]));
+            m_readback_fences[m_readback_next] = nullptr;
+        }
+        glCopyNamedBufferSubData(m_command_buffer, m_readback_buffer, 0, m_readback_next * sizeof(CullCommand), sizeof(CullCommand));
+        m_readback_fences[m_readback_next] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_readback_next = (m_readback_next + 1) % s_readback_count;
+    }
+
+    void GpuCulling::draw(const Mesh& mesh) const {
+        if (!is_ready() || m_instances_count == 0) {
+            return;
+        }
+        Render_OpenGL::bind_storage_buffer(s_instances_binding, m_instances_buffer, 0, m_instances_count * sizeof(GpuInstance));
+        Render_OpenGL::bind_storage_buffer(s_visible_binding, m_visible_buffer, 0, m_instances_count * sizeof(uint32_t));
+        Render_OpenGL::draw_indirect(mesh.get_vertex_array(), m_command_buffer);
+    }
+
+    void GpuCulling::build_depth_pyramid(const Framebuffer* pSource, const unsigned int width, const unsigned int height,
+        const glm::mat4& view_projection) {
+        if (!is_ready() || !m_pyramid_texture || width == 0 || height == 0) {
+            return;
+        }
+        unsigned int source_width = std::min(width, m_width);
+        unsigned int source_height = std::min(height, m_height);
+        m_depth_copy.read_depth(pSource, source_width, source_height);
+        m_pyramid_source_width = source_width;
+        m_pyramid_source_height = source_height;
+        m_pyramid_view_projection = view_projection;
+
+        //     1 x 1,   :   
+        m_pyramid_levels = 0;
+        m_pyramid_depth_program.bind();
+        m_depth_copy.bind_depth_texture(0);
+        for (unsigned int level = 0; level < m_pyramid_allocated_levels; ++level) {
+            const unsigned int level_width = get_level_size(source_width);
+            const unsigned int level_height = get_level_size(source_height);
+            const ShaderProgram& program = level == 0 ? m_pyramid_depth_program : m_pyramid_reduce_program;
+            if (level == 1) {
+                m_pyramid_reduce_program.bind();
+            }
+            if (level > 0) {
+                glBindImageTexture(1, m_pyramid_texture, static_cast<GLint>(level - 1), GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+            }
+            glBindImageTexture(0, m_pyramid_texture, static_cast<GLint>(level), GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+            program.set_vec2("source_size", glm::vec2(static_cast<float>(source_width), static_cast<float>(source_height)));
+            program.set_vec2("destination_size", glm::vec2(static_cast<float>(level_width), static_cast<float>(level_height)));
+            Render_OpenGL::dispatch_compute((level_width + s_pyramid_group_size - 1) / s_pyramid_group_size,
+                (level_height + s_pyramid_group_size - 1) / s_pyramid_group_size);
+            Render_OpenGL::memory_barrier(EMemoryBarrier::ImageAccess | EMemoryBarrier::TextureFetch);
+            ++m_pyramid_levels;
+            if (level_width == 1 && level_height == 1) {
+                break;
+            }
+            source_width = level_width;
+            source_height = level_height;
+        }
+    }
+
+    const char* GpuCulling::get_shader_source() {
+        return s_instances_shader_source;
+    }
+
+    void GpuCulling::on_ui_draw() {
+        ImGui::Begin("GPU culling");
+        if (!is_ready()) {
+            ImGui::Text("Unavailable");
+            ImGui::End();
+            return;
+        }
+        ImGui::Text("Instances: %zu (uploads: %zu)", m_stats.instances_count, m_stats.instance_uploads_count);
+        ImGui::Text("Visible: %zu", m_stats.visible_count);
+        ImGui::Text("Frustum culled: %zu", m_stats.frustum_culled_count);
+        ImGui::Text("Occluded: %zu", m_stats.occluded_count);
+        ImGui::Text("Occlusion: %s (%u pyramid levels, %ux%u)", m_stats.occlusion_active ? "on" : "off", m_stats.pyramid_levels_count,
+            m_pyramid_source_width, m_pyramid_source_height);
+        ImGui::End();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+#include "ShaderProgram.hpp"
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace MyEngine {
+
+    class Camera;
+    class Mesh;
+    struct TransformsSoA;
+
+    //     GPU.             .
+    //          ,    
+    //   (Hi-Z:  i     2^(i+1) ):  , 
+    //     ,    2 x 2   ,  ,  
+    //     .      (  ,     
+    // instanceCount ),   glDrawElementsIndirect: CPU      .
+    //               -
+    class GpuCulling {
+    public:
+        //    : ,  ,   
+        static constexpr unsigned int s_instances_binding = 7;
+        static constexpr unsigned int s_visible_binding = 8;
+        static constexpr unsigned int s_command_binding = 9;
+        //          
+        static constexpr unsigned int s_cull_group_size = 64;
+        static constexpr unsigned int s_pyramid_group_size = 8;
+        //   :      ,  GPU      
+        static constexpr size_t s_readback_count = 4;
+
+        //  (   GPU  ,    )
+        struct Stats {
+            size_t instances_count = 0;
+            size_t visible_count = 0;
+            size_t frustum_culled_count = 0;
+            size_t occluded_count = 0;
+            size_t instance_uploads_count = 0;
+            unsigned int pyramid_levels_count = 0;
+            bool occlusion_active = false;
+        };
+
+        //  (   )  
+        GpuCulling(const unsigned int width, const unsigned int height);
+        ~GpuCulling();
+
+        //      
+        GpuCulling(const GpuCulling&) = delete;
+        GpuCulling& operator=(const GpuCulling&) = delete;
+        GpuCulling& operator=(GpuCulling&&) = delete;
+        GpuCulling(GpuCulling&&) = delete;
+
+        //      
+        bool is_ready() const;
+        //      ( ,     )
+        void resize(const unsigned int width, const unsigned int height);
+
+        // :       (   GPU,   )
+        void set_instances(const TransformsSoA& transforms, const Mesh& mesh);
+        //    . occlusion == false    -   
+        void cull(Camera& camera, const Mesh& mesh, const bool occlusion);
+        //       (      get_shader_source)
+        void draw(const Mesh& mesh) const;
+        //    width x height  pSource (nullptr -    )   
+        //    , view_projection - ,    
+        void build_depth_pyramid(const Framebuffer* pSource, const unsigned int width, const unsigned int height,
+            const glm::mat4& view_projection);
+
+        //      ( #version): get_instance_model() -    gl_InstanceID
+        static const char* get_shader_source();
+
+        const Stats& get_stats() const { return m_stats; }
+
+        //  
+        void on_ui_draw();
+
+    private:
+        //    GPU (std430):      (  )
+        struct GpuInstance {
+            glm::mat4 model;
+            glm::vec4 sphere;
+        };
+
+        //  glDrawElementsIndirect    (std430)
+        struct CullCommand {
+            uint32_t indices_count;
+            uint32_t instance_count;
+            uint32_t first_index;
+            int32_t base_vertex;
+            uint32_t base_instance;
+            uint32_t frustum_culled_count;
+            uint32_t occluded_count;
+            uint32_t reserved;
+        };
+
+        //        
+        void create_pyramid();
+        void delete_pyramid();
+        //        instances_count
+        void reserve(const size_t instances_count);
+        //      (  GPU)
+        void read_counters();
+
+        ShaderProgram m_cull_program;
+        ShaderProgram m_pyramid_depth_program;
+        ShaderProgram m_pyramid_reduce_program;
+        //    (   )
+        Framebuffer m_depth_copy;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+
+        //  ,  ,      ( )
+        unsigned int m_instances_buffer = 0;
+        unsigned int m_visible_buffer = 0;
+        unsigned int m_command_buffer = 0;
+        unsigned int m_readback_buffer = 0;
+        const CullCommand* m_pReadback = nullptr;
+        std::array<void*, s_readback_count> m_readback_fences{};
+        size_t m_readback_next = 0;
+        size_t m_instances_capacity = 0;
+        size_t m_instances_count = 0;
+
+        //  (R32F  ):      GpuMemoryTracker ,   
+        //   
+        unsigned int m_pyramid_texture = 0;
+        unsigned int m_pyramid_allocated_levels = 0;
+        size_t m_pyramid_memory_size = 0;
+        unsigned int m_pyramid_levels = 0;
+        unsigned int m_pyramid_source_width = 0;
+        unsigned int m_pyramid_source_height = 0;
+        glm::mat4 m_pyramid_view_projection{ 1.f };
+
+        Stats m_stats;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include "GpuMemoryTracker.hpp"
+#include "Render_OpenGL.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <imgui/imgui.h>
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+namespace MyEngine {
+
+    //   GL_NVX_gpu_memory_info  GL_ATI_meminfo (glad   )
+#ifndef GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX
+    #define GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX 0x9048
+#endif
+#ifndef GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX
+    #define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX 0x9049
+#endif
+#ifndef GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX
+    #define GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX 0x904A
+#endif
+#ifndef GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX
+    #define GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX 0x904B
+#endif
+#ifndef GL_TEXTURE_FREE_MEMORY_ATI
+    #define GL_TEXTURE_FREE_MEMORY_ATI 0x87FC
+#endif
+
+    constexpr size_t s_categories_count = static_cast<size_t>(EGpuMemoryCategory::Count);
+
+    //  
+    struct GpuMemoryState {
+        size_t allocated[s_categories_count] = {};
+        size_t peak[s_categories_count] = {};
+        size_t total_peak = 0;
+        size_t budget = 0;
+        size_t over_budget_frames = 0;
+        std::vector<std::pair<size_t, GpuMemoryTracker::PressureHandler>> handlers;
+        size_t next_handler_id = 1;
+        GpuMemoryTracker::DriverInfo driver_info;
+    };
+
+    static GpuMemoryState& get_state() {
+        static GpuMemoryState state;
+        return state;
+    }
+
+    // 
+    void GpuMemoryTracker::on_allocate(const EGpuMemoryCategory category, const size_t bytes) {
+        GpuMemoryState& state = get_state();
+        const size_t index = static_cast<size_t>(category);
+        state.allocated[index] += bytes;
+        state.peak[index] = std::max(state.peak[index], state.allocated[index]);
+        state.total_peak = std::max(state.total_peak, get_total_allocated());
+    }
+
+    // : ,  , -   (    )
+    void GpuMemoryTracker::on_free(const EGpuMemoryCategory category, const size_t bytes) {
+        size_t& allocated = get_state().allocated[static_cast<size_t>(category)];
+        if (bytes > allocated) {
+            LOG_ERROR("GpuMemoryTracker: freeing {0} bytes of {1}, only {2} bytes allocated", bytes,
+                get_category_name(category), allocated);
+        }
+        allocated -= std::min(allocated, bytes);
+    }
+
+    size_t GpuMemoryTracker::get_allocated(const EGpuMemoryCategory category) {
+        return get_state().allocated[static_cast<size_t>(category)];
+    }
+
+    size_t GpuMemoryTracker::get_peak(const EGpuMemoryCategory category) {
+        return get_state().peak[static_cast<size_t>(category)];
+    }
+
+    size_t GpuMemoryTracker::get_total_allocated() {
+        size_t total = 0;
+        for (const size_t allocated : get_state().allocated) {
+            total += allocated;
+        }
+        return total;
+    }
+
+    size_t GpuMemoryTracker::get_total_peak() {
+        return get_state().total_peak;
+    }
+
+    //  
+    const char* GpuMemoryTracker::get_category_name(const EGpuMemoryCategory category) {
+        switch (category) {
+        case EGpuMemoryCategory::VertexBuffers: return "vertex_buffers";
+        case EGpuMemoryCategory::IndexBuffers: return "index_buffers";
+        case EGpuMemoryCategory::Textures: return "textures";
+        case EGpuMemoryCategory::Staging: return "staging";
+        case EGpuMemoryCategory::RenderTargets: return "render_targets";
+        case EGpuMemoryCategory::Count: break;
+        }
+        return "unknown";
+    }
+
+    void GpuMemoryTracker::set_budget(const size_t budget) {
+        get_state().budget = budget;
+    }
+
+    size_t GpuMemoryTracker::get_budget() {
+        return get_state().budget;
+    }
+
+    //    
+    size_t GpuMemoryTracker::add_pressure_handler(PressureHandler handler) {
+        GpuMemoryState& state = get_state();
+        state.handlers.emplace_back(state.next_handler_id, std::move(handler));
+        return state.next_handler_id++;
+    }
+
+    //  
+    void GpuMemoryTracker::remove_pressure_handler(const size_t id) {
+        auto& handlers = get_state().handlers;
+        handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+            [id](const auto& handler) { return handler.first == id; }), handlers.end());
+    }
+
+    //   (   )   
+    void GpuMemoryTracker::update() {
+        GpuMemoryState& state = get_state();
+        static const bool s_nvx_supported = Render_OpenGL::is_extension_supported("GL_NVX_gpu_memory_info");
+        static const bool s_ati_supported = Render_OpenGL::is_extension_supported("GL_ATI_meminfo");
+
+        DriverInfo& info = state.driver_info;
+        if (s_nvx_supported) {
+            GLint total_kb = 0;
+            GLint available_kb = 0;
+            GLint evictions_count = 0;
+            GLint evicted_kb = 0;
+            glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &total_kb);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &available_kb);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX, &evictions_count);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX, &evicted_kb);
+            info.source = "GL_NVX_gpu_memory_info";
+            info.total_bytes = static_cast<size_t>(total_kb) * 1024;
+            info.available_bytes = static_cast<size_t>(available_kb) * 1024;
+            info.evictions_count = static_cast<size_t>(evictions_count);
+            info.evicted_bytes = static_cast<size_t>(evicted_kb) * 1024;
+        }
+        else if (s_ati_supported) {
+            //    : ,   ,  
+            GLint free_memory[4] = {};
+            glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, free_memory);
+            info.source = "GL_ATI_meminfo";
+            info.available_bytes = static_cast<size_t>(free_memory[0]) * 1024;
+        }
+
+        const size_t total = get_total_allocated();
+        if (state.budget == 0 || total <= state.budget) {
+            state.over_budget_frames = 0;
+            return;
+        }
+        size_t bytes_to_free = total - state.budget;
+        for (auto& handler : state.handlers) {
+            const size_t freed = handler.second(bytes_to_free);
+            bytes_to_free -= std::min(bytes_to_free, freed);
+            if (bytes_to_free == 0) {
+                break;
+            }
+        }
+        //   ,     
+        if (bytes_to_free > 0 && state.over_budget_frames++ == 0) {
+            LOG_WARN("GpuMemoryTracker: {0} KB over the {1} KB budget", bytes_to_free / 1024, state.budget / 1024);
+        }
+    }
+
+    const GpuMemoryTracker::DriverInfo& GpuMemoryTracker::get_driver_info() {
+        return get_state().driver_info;
+    }
+
+    //   JSON
+    bool GpuMemoryTracker::write_json(const std::string& path) {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("GpuMemoryTracker: can't create '{0}'", path);
+            return false;
+        }
+        const GpuMemoryState& state = get_state();
+        file << "{\n  \"categories\": {\n";
+        for (size_t i = 0; i < s_categories_count; ++i) {
+            file << "    \"" << get_category_name(static_cast<EGpuMemoryCategory>(i)) << "\": { \"bytes\": " << state.allocated[i]
+                << ", \"peak_bytes\": " << state.peak[i] << " }" << (i + 1 < s_categories_count ? ",\n" : "\n");
+        }
+        file << "  },\n";
+        file << "  \"total_bytes\": " << get_total_allocated() << ",\n";
+        file << "  \"total_peak_bytes\": " << state.total_peak << ",\n";
+        file << "  \"budget_bytes\": " << state.budget << ",\n";
+        file << "  \"driver\": { \"source\": \"" << state.driver_info.source << "\", \"total_bytes\": " << state.driver_info.total_bytes
+            << ", \"available_bytes\": " << state.driver_info.available_bytes << ", \"evictions\": " << state.driver_info.evictions_count
+            << ", \"evicted_bytes\": " << state.driver_info.evicted_bytes << " }\n";
+        file << "}\n";
+        if (!file) {
+            LOG_ERROR("GpuMemoryTracker: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+
+    //  :   , ,    
+    void GpuMemoryTracker::on_ui_draw() {
+        GpuMemoryState& state = get_state();
+        constexpr double s_mb = 1024.0 * 1024.0;
+        ImGui::Text("GPU memory: %.1f MB (peak %.1f MB)", get_total_allocated() / s_mb, state.total_peak / s_mb);
+        for (size_t i = 0; i < s_categories_count; ++i) {
+            ImGui::BulletText("%s: %.1f MB (peak %.1f MB)", get_category_name(static_cast<EGpuMemoryCategory>(i)),
+                state.allocated[i] / s_mb, state.peak[i] / s_mb);
+        }
+        int budget_mb = static_cast<int>(state.budget / (1024 * 1024));
+        if (ImGui::InputInt("Budget, MB (0 - off)", &budget_mb)) {
+            state.budget = static_cast<size_t>(std::max(budget_mb, 0)) * 1024 * 1024;
+        }
+        if (state.driver_info.available_bytes > 0) {
+            ImGui::Text("Driver (%s): %.1f MB free of %.1f MB, %zu evictions", state.driver_info.source,
+                state.driver_info.available_bytes / s_mb, state.driver_info.total_bytes / s_mb, state.driver_info.evictions_count);
+        }
+        if (ImGui::Button("Dump GPU memory JSON")) {
+            write_json("gpu_memory.json");
+        }
+    }
+}
\ No newline at end of file
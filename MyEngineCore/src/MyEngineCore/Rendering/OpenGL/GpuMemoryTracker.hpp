@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace MyEngine {
+
+    //  
+    enum class EGpuMemoryCategory {
+        VertexBuffers,
+        IndexBuffers,
+        Textures,
+        Staging,
+        RenderTargets,
+        Count
+    };
+
+    //  :   OpenGL     ,       .
+    //    GL_NVX_gpu_memory_info  GL_ATI_meminfo,     GPU.
+    //        (  ,  )
+    class GpuMemoryTracker {
+    public:
+        //   :  bytes_to_free ,   
+        using PressureHandler = std::function<size_t(const size_t bytes_to_free)>;
+
+        //   ( )
+        struct DriverInfo {
+            const char* source = "none";
+            size_t total_bytes = 0;
+            size_t available_bytes = 0;
+            size_t evictions_count = 0;
+            size_t evicted_bytes = 0;
+        };
+
+        //     (  OpenGL)
+        static void on_allocate(const EGpuMemoryCategory category, const size_t bytes);
+        static void on_free(const EGpuMemoryCategory category, const size_t bytes);
+
+        static size_t get_allocated(const EGpuMemoryCategory category);
+        static size_t get_peak(const EGpuMemoryCategory category);
+        static size_t get_total_allocated();
+        static size_t get_total_peak();
+        static const char* get_category_name(const EGpuMemoryCategory category);
+
+        //    (0 -  )
+        static void set_budget(const size_t budget);
+        static size_t get_budget();
+
+        //       .  id  
+        static size_t add_pressure_handler(PressureHandler handler);
+        static void remove_pressure_handler(const size_t id);
+
+        //   :     
+        static void update();
+        static const DriverInfo& get_driver_info();
+
+        //    JSON
+        static bool write_json(const std::string& path);
+        //   
+        static void on_ui_draw();
+    };
+
+}
\ No newline at end of file
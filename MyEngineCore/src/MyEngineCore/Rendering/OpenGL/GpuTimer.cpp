@@ -0,0 +1,65 @@
+#include "GpuTimer.hpp"
+
+#include <glad/glad.h>
+
+namespace MyEngine {
+
+    GpuTimer::GpuTimer() {
+        glGenQueries(static_cast<GLsizei>(s_queries_count), m_queries.data());
+    }
+
+    GpuTimer::~GpuTimer() {
+        glDeleteQueries(static_cast<GLsizei>(s_queries_count), m_queries.data());
+    }
+
+    void GpuTimer::begin() {
+        collect(false);
+        m_active_query = s_queries_count;
+        if (m_in_flight[m_next_query]) {
+            return;
+        }
+        m_active_query = m_next_query;
+        m_next_query = (m_next_query + 1) % s_queries_count;
+        glBeginQuery(GL_TIME_ELAPSED, m_queries[m_active_query]);
+    }
+
+    void GpuTimer::end() {
+        if (m_active_query == s_queries_count) {
+            return;
+        }
+        glEndQuery(GL_TIME_ELAPSED);
+        m_in_flight[m_active_query] = true;
+    }
+
+    //     ,    :     
+    void GpuTimer::collect(const bool wait) {
+        for (size_t i = 0; i < s_queries_count; ++i) {
+            const size_t query = (m_next_query + i) % s_queries_count;
+            if (!m_in_flight[query]) {
+                continue;
+            }
+            if (!wait) {
+                GLint available = 0;
+                glGetQueryObjectiv(m_queries[query], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available) {
+                    continue;
+                }
+            }
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(m_queries[query], GL_QUERY_RESULT, &elapsed);
+            m_in_flight[query] = false;
+            m_elapsed_ms = static_cast<double>(elapsed) / 1'000'000.0;
+        }
+    }
+
+    double GpuTimer::get_elapsed_ms() {
+        collect(false);
+        return m_elapsed_ms;
+    }
+
+    double GpuTimer::wait_elapsed_ms() {
+        collect(true);
+        return m_elapsed_ms;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace MyEngine {
+
+    //  GPU  begin  end ( GL_TIME_ELAPSED,      ).
+    //    :        GPU
+    class GpuTimer {
+    public:
+        //    
+        static constexpr size_t s_queries_count = 4;
+
+        //   
+        GpuTimer();
+        ~GpuTimer();
+
+        //      
+        GpuTimer(const GpuTimer&) = delete;
+        GpuTimer& operator=(const GpuTimer&) = delete;
+        GpuTimer& operator=(GpuTimer&&) = delete;
+        GpuTimer(GpuTimer&&) = delete;
+
+        //     (    ,  )
+        void begin();
+        void end();
+        //      (    )
+        double get_elapsed_ms();
+        //     (    )
+        double wait_elapsed_ms();
+
+    private:
+        //   
+        void collect(const bool wait);
+
+        std::array<unsigned int, s_queries_count> m_queries{};
+        std::array<bool, s_queries_count> m_in_flight{};
+        size_t m_next_query = 0;
+        //    (s_queries_count -  )
+        size_t m_active_query = s_queries_count;
+        double m_elapsed_ms = 0.0;
+    };
+
+}
\ No newline at end of file
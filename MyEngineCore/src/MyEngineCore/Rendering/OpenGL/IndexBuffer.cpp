@@ -1,4 +1,6 @@
 #include "IndexBuffer.hpp"
+#include "GpuMemoryTracker.hpp"
+#include "Render_OpenGL.hpp"
 
 #include "MyEngineCore/Log.hpp"
 
@@ -12,6 +14,7 @@ namespace MyEngine {
         case VertexBuffer::EUsage::Static:  return GL_STATIC_DRAW;
         case VertexBuffer::EUsage::Dynamic: return GL_DYNAMIC_DRAW;
         case VertexBuffer::EUsage::Stream:  return GL_STREAM_DRAW;
+        case VertexBuffer::EUsage::Immutable: return GL_STATIC_DRAW;
         }
 
         LOG_ERROR("Unknown VertexBuffer usage");
@@ -20,6 +23,16 @@ namespace MyEngine {
 
     //  
     IndexBuffer::IndexBuffer(const void* data, const size_t count, const VertexBuffer::EUsage usage) : m_count(count){
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::IndexBuffers, count * sizeof(GLuint));
+        if (data) {
+            Render_OpenGL::on_buffer_uploaded(count * sizeof(GLuint));
+        }
+        //   (. VertexBuffer)
+        if (usage == VertexBuffer::EUsage::Immutable) {
+            glCreateBuffers(1, &m_id);
+            glNamedBufferStorage(m_id, count * sizeof(GLuint), data, 0);
+            return;
+        }
         glGenBuffers(1, &m_id);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(GLuint), data, usage_to_GLenum(usage));
@@ -28,11 +41,14 @@ namespace MyEngine {
     // 
     IndexBuffer::~IndexBuffer()
     {
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::IndexBuffers, m_count * sizeof(GLuint));
         glDeleteBuffers(1, &m_id);
     }
 
     //  
     IndexBuffer& IndexBuffer::operator=(IndexBuffer&& index_buffer) noexcept {
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::IndexBuffers, m_count * sizeof(GLuint));
+        glDeleteBuffers(1, &m_id);
         m_id = index_buffer.m_id;
         m_count = index_buffer.m_count;
         index_buffer.m_id = 0;
@@ -20,6 +20,7 @@ namespace MyEngine {
         void bind() const;
         static void unbind();
         size_t get_count() const { return m_count; }
+        unsigned int get_handle() const { return m_id; }
 
     private:
         // id   
@@ -0,0 +1,227 @@
+#include "LatencyTracker.hpp"
+
+#include "MyEngineCore/Event.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <imgui/imgui.h>
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+
+namespace MyEngine {
+
+    //     GPU  
+    constexpr size_t s_queries_count = 8;
+
+    // ,     GPU
+    struct LatencyQuery {
+        GLuint query = 0;
+        bool in_flight = false;
+        uint64_t input_timestamp = 0;
+        //   GPU  get_event_timestamp    ()
+        int64_t clock_offset = 0;
+    };
+
+    //    ()
+    struct LatencySamples {
+        std::array<double, LatencyTracker::s_samples_count> values = {};
+        size_t count = 0;
+        size_t next = 0;
+        double last = 0.0;
+
+        void add(const double value) {
+            values[next] = value;
+            next = (next + 1) % values.size();
+            count = std::min(count + 1, values.size());
+            last = value;
+        }
+    };
+
+    //  
+    struct LatencyState {
+        bool queries_created = false;
+        std::array<LatencyQuery, s_queries_count> queries;
+        size_t next_query = 0;
+        //      
+        uint64_t pending_input_timestamp = 0;
+        LatencySamples input_to_swap;
+        LatencySamples input_to_gpu;
+    };
+
+    static LatencyState& get_state() {
+        static LatencyState state;
+        return state;
+    }
+
+    static double to_ms(const int64_t nanoseconds) {
+        return static_cast<double>(nanoseconds) / 1'000'000.0;
+    }
+
+    //  GL_TIMESTAMP   OpenGL 3.3
+    static bool is_timer_query_supported() {
+        return GLAD_GL_VERSION_3_3 != 0;
+    }
+
+    //      GPU
+    static void collect_queries(LatencyState& state) {
+        for (LatencyQuery& query : state.queries) {
+            if (!query.in_flight) {
+                continue;
+            }
+            GLint available = 0;
+            glGetQueryObjectiv(query.query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                continue;
+            }
+            GLuint64 gpu_time = 0;
+            glGetQueryObjectui64v(query.query, GL_QUERY_RESULT, &gpu_time);
+            query.in_flight = false;
+            const int64_t latency = static_cast<int64_t>(gpu_time) + query.clock_offset - static_cast<int64_t>(query.input_timestamp);
+            if (gpu_time != 0 && latency >= 0) {
+                state.input_to_gpu.add(to_ms(latency));
+            }
+        }
+    }
+
+    void LatencyTracker::on_input_consumed(const uint64_t input_timestamp) {
+        LatencyState& state = get_state();
+        //        ,    
+        if (input_timestamp != 0 && (state.pending_input_timestamp == 0 || input_timestamp < state.pending_input_timestamp)) {
+            state.pending_input_timestamp = input_timestamp;
+        }
+    }
+
+    void LatencyTracker::on_frame_presented() {
+        const uint64_t swap_time = get_event_timestamp();
+        LatencyState& state = get_state();
+        const bool timer_query_supported = is_timer_query_supported();
+        if (timer_query_supported) {
+            collect_queries(state);
+        }
+        if (state.pending_input_timestamp == 0) {
+            return;
+        }
+        const uint64_t input_timestamp = state.pending_input_timestamp;
+        state.pending_input_timestamp = 0;
+        state.input_to_swap.add(to_ms(static_cast<int64_t>(swap_time - input_timestamp)));
+        if (!timer_query_supported) {
+            return;
+        }
+        if (!state.queries_created) {
+            for (LatencyQuery& query : state.queries) {
+                glGenQueries(1, &query.query);
+            }
+            state.queries_created = true;
+        }
+        //     (GPU     s_queries_count ) -    GPU
+        LatencyQuery& query = state.queries[state.next_query];
+        if (query.in_flight) {
+            return;
+        }
+        state.next_query = (state.next_query + 1) % s_queries_count;
+        //  :   GPU  CPU  
+        GLint64 gpu_now = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpu_now);
+        query.clock_offset = static_cast<int64_t>(get_event_timestamp()) - static_cast<int64_t>(gpu_now);
+        query.input_timestamp = input_timestamp;
+        query.in_flight = true;
+        glQueryCounter(query.query, GL_TIMESTAMP);
+    }
+
+    //    
+    static LatencyTracker::Percentiles get_percentiles(const LatencySamples& samples) {
+        LatencyTracker::Percentiles percentiles;
+        if (samples.count == 0) {
+            return percentiles;
+        }
+        std::array<double, LatencyTracker::s_samples_count> sorted = samples.values;
+        std::sort(sorted.begin(), sorted.begin() + samples.count);
+        const auto rank = [&](const double fraction) {
+            const size_t index = static_cast<size_t>(std::ceil(fraction * samples.count));
+            return sorted[std::min(std::max<size_t>(index, 1), samples.count) - 1];
+        };
+        percentiles.p50 = rank(0.5);
+        percentiles.p90 = rank(0.9);
+        percentiles.p99 = rank(0.99);
+        percentiles.max = sorted[samples.count - 1];
+        return percentiles;
+    }
+
+    LatencyTracker::Stats LatencyTracker::get_stats() {
+        const LatencyState& state = get_state();
+        Stats stats;
+        stats.samples_count = state.input_to_swap.count;
+        stats.gpu_samples_count = state.input_to_gpu.count;
+        stats.last_input_to_swap_ms = state.input_to_swap.last;
+        stats.last_input_to_gpu_ms = state.input_to_gpu.last;
+        stats.input_to_swap_ms = get_percentiles(state.input_to_swap);
+        stats.input_to_gpu_ms = get_percentiles(state.input_to_gpu);
+        return stats;
+    }
+
+    void LatencyTracker::reset() {
+        LatencyState& state = get_state();
+        state.input_to_swap = LatencySamples();
+        state.input_to_gpu = LatencySamples();
+    }
+
+    void LatencyTracker::shutdown() {
+        LatencyState& state = get_state();
+        if (state.queries_created) {
+            for (LatencyQuery& query : state.queries) {
+                glDeleteQueries(1, &query.query);
+                query = LatencyQuery();
+            }
+            state.queries_created = false;
+        }
+        state.pending_input_timestamp = 0;
+    }
+
+    //   JSON
+    bool LatencyTracker::write_json(const std::string& path) {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("LatencyTracker: can't create '{0}'", path);
+            return false;
+        }
+        const Stats stats = get_stats();
+        const auto write_percentiles = [&file](const char* name, const Percentiles& percentiles, const char* separator) {
+            file << "  \"" << name << "\": { \"p50\": " << percentiles.p50 << ", \"p90\": " << percentiles.p90
+                << ", \"p99\": " << percentiles.p99 << ", \"max\": " << percentiles.max << " }" << separator;
+        };
+        file << "{\n";
+        file << "  \"samples\": " << stats.samples_count << ",\n";
+        file << "  \"gpu_samples\": " << stats.gpu_samples_count << ",\n";
+        write_percentiles("input_to_swap_ms", stats.input_to_swap_ms, ",\n");
+        write_percentiles("input_to_gpu_ms", stats.input_to_gpu_ms, "\n");
+        file << "}\n";
+        if (!file) {
+            LOG_ERROR("LatencyTracker: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+
+    //  :       
+    void LatencyTracker::on_ui_draw() {
+        const Stats stats = get_stats();
+        ImGui::Text("Input latency (%zu frames with input)", stats.samples_count);
+        ImGui::BulletText("To swap: %.2f ms, p50 %.2f, p90 %.2f, p99 %.2f, max %.2f", stats.last_input_to_swap_ms,
+            stats.input_to_swap_ms.p50, stats.input_to_swap_ms.p90, stats.input_to_swap_ms.p99, stats.input_to_swap_ms.max);
+        if (stats.gpu_samples_count > 0) {
+            ImGui::BulletText("To GPU done: %.2f ms, p50 %.2f, p90 %.2f, p99 %.2f, max %.2f", stats.last_input_to_gpu_ms,
+                stats.input_to_gpu_ms.p50, stats.input_to_gpu_ms.p90, stats.input_to_gpu_ms.p99, stats.input_to_gpu_ms.max);
+        }
+        if (ImGui::Button("Reset latency")) {
+            reset();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Dump latency JSON")) {
+            write_json("latency.json");
+        }
+    }
+
+}
\ No newline at end of file
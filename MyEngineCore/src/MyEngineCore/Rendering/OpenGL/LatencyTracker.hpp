@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace MyEngine {
+
+    //     .       GLFW,    Input
+    //  on_update  ,   ,     glfwSwapBuffers  .
+    //  GL_TIMESTAMP    ,  GPU   (    
+    //    ).      OpenGL
+    class LatencyTracker {
+    public:
+        //   ()
+        struct Percentiles {
+            double p50 = 0.0;
+            double p90 = 0.0;
+            double p99 = 0.0;
+            double max = 0.0;
+        };
+
+        //    s_samples_count   
+        struct Stats {
+            size_t samples_count = 0;
+            size_t gpu_samples_count = 0;
+            //     
+            double last_input_to_swap_ms = 0.0;
+            double last_input_to_gpu_ms = 0.0;
+            Percentiles input_to_swap_ms;
+            Percentiles input_to_gpu_ms;
+        };
+
+        static constexpr size_t s_samples_count = 512;
+
+        //    :     (0 -   ). ,  
+        //  ,   
+        static void on_input_consumed(const uint64_t input_timestamp);
+        //   glfwSwapBuffers:         GPU
+        static void on_frame_presented();
+
+        static Stats get_stats();
+        //   (,      vsync)
+        static void reset();
+        //   OpenGL (  )
+        static void shutdown();
+
+        //    JSON   
+        static bool write_json(const std::string& path);
+        //   
+        static void on_ui_draw();
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,355 @@
+#include "LightClusters.hpp"
+#include "Render_OpenGL.hpp"
+#include "ShaderProgram.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <imgui/imgui.h>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+// SSE2    x86-64,  32- x86 -    /arch:SSE2  -msse2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define MYENGINE_LIGHT_CLUSTERS_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace MyEngine {
+
+    //     (  GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT)
+    constexpr size_t s_storage_alignment = 256;
+    //   :         
+    constexpr size_t s_block_size = LightClusters::s_max_lights * 2 * sizeof(glm::vec4) + LightClusters::s_clusters_count * 2 * sizeof(uint32_t) +
+        LightClusters::s_max_light_indices * sizeof(uint32_t) + 3 * s_storage_alignment;
+
+    LightClusters::LightClusters()
+        : m_staging_buffer(s_block_size * StagingBuffer::s_blocks_count),
+        m_cluster_counts(s_clusters_count),
+        m_cluster_offsets(s_clusters_count),
+        m_cluster_cursors(s_clusters_count) {
+        m_gpu_lights.reserve(s_max_lights);
+        m_ranges.reserve(s_max_lights);
+    }
+
+    uint32_t LightClusters::get_slice(const float depth) const {
+        const float slice = std::log(std::max(depth, m_near)) * m_slice_scale + m_slice_bias;
+        return static_cast<uint32_t>(std::clamp(slice, 0.f, static_cast<float>(s_clusters_z - 1)));
+    }
+
+    LightClusters::ClusterRange LightClusters::get_range(const float min_x, const float max_x, const float min_y, const float max_y,
+        const float depth, const float radius, const float far) const {
+        ClusterRange range{};
+        if (max_x < -1.f || min_x > 1.f || max_y < -1.f || min_y > 1.f) {
+            return range;
+        }
+        const auto to_tile = [](const float ndc, const uint32_t tiles_count) {
+            return static_cast<uint8_t>(std::clamp((ndc * 0.5f + 0.5f) * tiles_count, 0.f, static_cast<float>(tiles_count - 1)));
+        };
+        range.min_x = to_tile(min_x, s_clusters_x);
+        range.max_x = to_tile(max_x, s_clusters_x);
+        range.min_y = to_tile(min_y, s_clusters_y);
+        range.max_y = to_tile(max_y, s_clusters_y);
+        range.min_z = static_cast<uint8_t>(get_slice(depth - radius));
+        range.max_z = static_cast<uint8_t>(get_slice(std::min(depth + radius, far)));
+        range.visible = true;
+        return range;
+    }
+
+    //  8    ,     
+    LightClusters::ClusterRange LightClusters::get_range(const glm::vec3& view_position, const float radius, const glm::mat4& projection,
+        const float far) const {
+        const float depth = -view_position.z;
+        if (depth + radius <= m_near || depth - radius >= far) {
+            return ClusterRange{};
+        }
+        const float near_z = -std::max(depth - radius, m_near);
+        const float far_z = -std::min(depth + radius, far);
+        float min_x = 1e30f, max_x = -1e30f, min_y = 1e30f, max_y = -1e30f;
+        for (int corner = 0; corner < 8; ++corner) {
+            const glm::vec4 clip = projection * glm::vec4(view_position.x + (corner & 1 ? radius : -radius),
+                view_position.y + (corner & 2 ? radius : -radius), corner & 4 ? far_z : near_z, 1.f);
+            const float x = clip.x / clip.w;
+            const float y = clip.y / clip.w;
+            min_x = std::min(min_x, x);
+            max_x = std::max(max_x, x);
+            min_y = std::min(min_y, y);
+            max_y = std::max(max_y, y);
+        }
+        return get_range(min_x, max_x, min_y, max_y, depth, radius, far);
+    }
+
+    void LightClusters::assign(const PointLight* pLights, const size_t lights_count, const glm::mat4& view, const glm::mat4& projection,
+        const float near, const float far, Stats& stats) {
+        const size_t count = std::min(lights_count, s_max_lights);
+        m_near = near;
+        m_slice_scale = s_clusters_z / std::log(far / near);
+        m_slice_bias = -std::log(near) * m_slice_scale;
+
+        //    
+        m_gpu_lights.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const PointLight& light = pLights[i];
+            m_gpu_lights[i].position_radius = glm::vec4(glm::vec3(view * glm::vec4(light.position, 1.f)), light.radius);
+            m_gpu_lights[i].color_intensity = glm::vec4(light.color, light.intensity);
+        }
+
+        //  
+        m_ranges.resize(count);
+        size_t i = 0;
+#if defined(MYENGINE_LIGHT_CLUSTERS_SSE)
+        //  4 :    x, y  w  
+        __m128 projection_rows[3][4];
+        for (int row = 0; row < 3; ++row) {
+            const int projection_row = row < 2 ? row : 3;
+            for (int column = 0; column < 4; ++column) {
+                projection_rows[row][column] = _mm_set1_ps(projection[column][projection_row]);
+            }
+        }
+        const __m128 near_depth = _mm_set1_ps(near);
+        const __m128 far_depth = _mm_set1_ps(far);
+        for (; i + 4 <= count; i += 4) {
+            const GpuLight* pGpuLights = &m_gpu_lights[i];
+            const __m128 x = _mm_setr_ps(pGpuLights[0].position_radius.x, pGpuLights[1].position_radius.x, pGpuLights[2].position_radius.x,
+                pGpuLights[3].position_radius.x);
+            const __m128 y = _mm_setr_ps(pGpuLights[0].position_radius.y, pGpuLights[1].position_radius.y, pGpuLights[2].position_radius.y,
+                pGpuLights[3].position_radius.y);
+            const __m128 depth = _mm_setr_ps(-pGpuLights[0].position_radius.z, -pGpuLights[1].position_radius.z, -pGpuLights[2].position_radius.z,
+                -pGpuLights[3].position_radius.z);
+            const __m128 radius = _mm_setr_ps(pGpuLights[0].position_radius.w, pGpuLights[1].position_radius.w, pGpuLights[2].position_radius.w,
+                pGpuLights[3].position_radius.w);
+
+            //    [near, far]
+            const __m128 in_depth = _mm_and_ps(_mm_cmpgt_ps(_mm_add_ps(depth, radius), near_depth), _mm_cmplt_ps(_mm_sub_ps(depth, radius), far_depth));
+            const __m128 corner_x[2] = { _mm_sub_ps(x, radius), _mm_add_ps(x, radius) };
+            const __m128 corner_y[2] = { _mm_sub_ps(y, radius), _mm_add_ps(y, radius) };
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 corner_z[2] = { _mm_sub_ps(zero, _mm_max_ps(_mm_sub_ps(depth, radius), near_depth)),
+                _mm_sub_ps(zero, _mm_min_ps(_mm_add_ps(depth, radius), far_depth)) };
+
+            //      x, y, w:  =    x, y  z
+            __m128 from_x[3][2], from_y[3][2], from_z[3][2];
+            for (int row = 0; row < 3; ++row) {
+                for (int side = 0; side < 2; ++side) {
+                    from_x[row][side] = _mm_mul_ps(projection_rows[row][0], corner_x[side]);
+                    from_y[row][side] = _mm_mul_ps(projection_rows[row][1], corner_y[side]);
+                    from_z[row][side] = _mm_add_ps(_mm_mul_ps(projection_rows[row][2], corner_z[side]), projection_rows[row][3]);
+                }
+            }
+            __m128 min_x = _mm_set1_ps(1e30f), max_x = _mm_set1_ps(-1e30f);
+            __m128 min_y = min_x, max_y = max_x;
+            for (int corner = 0; corner < 8; ++corner) {
+                const int side_x = corner & 1, side_y = (corner >> 1) & 1, side_z = corner >> 2;
+                const __m128 clip_w = _mm_add_ps(_mm_add_ps(from_x[2][side_x], from_y[2][side_y]), from_z[2][side_z]);
+                const __m128 ndc_x = _mm_div_ps(_mm_add_ps(_mm_add_ps(from_x[0][side_x], from_y[0][side_y]), from_z[0][side_z]), clip_w);
+                const __m128 ndc_y = _mm_div_ps(_mm_add_ps(_mm_add_ps(from_x[1][side_x], from_y[1][side_y]), from_z[1][side_z]), clip_w);
+                min_x = _mm_min_ps(min_x, ndc_x);
+                max_x = _mm_max_ps(max_x, ndc_x);
+                min_y = _mm_min_ps(min_y, ndc_y);
+                max_y = _mm_max_ps(max_y, ndc_y);
+            }
+
+            alignas(16) float bounds[4][4];
+            alignas(16) float depths[4];
+            alignas(16) float radii[4];
+            _mm_store_ps(bounds[0], min_x);
+            _mm_store_ps(bounds[1], max_x);
+            _mm_store_ps(bounds[2], min_y);
+            _mm_store_ps(bounds[3], max_y);
+            _mm_store_ps(depths, depth);
+            _mm_store_ps(radii, radius);
+            const int in_depth_mask = _mm_movemask_ps(in_depth);
+            for (int lane = 0; lane < 4; ++lane) {
+                m_ranges[i + lane] = (in_depth_mask & (1 << lane))
+                    ? get_range(bounds[0][lane], bounds[1][lane], bounds[2][lane], bounds[3][lane], depths[lane], radii[lane], far)
+                    : ClusterRange{};
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            m_ranges[i] = get_range(glm::vec3(m_gpu_lights[i].position_radius), m_gpu_lights[i].position_radius.w, projection, far);
+        }
+
+        //    
+        std::fill(m_cluster_counts.begin(), m_cluster_counts.end(), 0u);
+        size_t visible_count = 0;
+        for (const ClusterRange& range : m_ranges) {
+            if (!range.visible) {
+                continue;
+            }
+            ++visible_count;
+            for (uint32_t z = range.min_z; z <= range.max_z; ++z) {
+                for (uint32_t y = range.min_y; y <= range.max_y; ++y) {
+                    uint32_t* pCounts = &m_cluster_counts[(z * s_clusters_y + y) * s_clusters_x];
+                    for (uint32_t x = range.min_x; x <= range.max_x; ++x) {
+                        ++pCounts[x];
+                    }
+                }
+            }
+        }
+
+        //   ( ),   s_max_light_indices 
+        size_t total = 0;
+        size_t dropped = 0;
+        size_t max_per_cluster = 0;
+        for (size_t cluster = 0; cluster < s_clusters_count; ++cluster) {
+            const size_t cluster_count = std::min<size_t>(m_cluster_counts[cluster], s_max_light_indices - total);
+            dropped += m_cluster_counts[cluster] - cluster_count;
+            max_per_cluster = std::max(max_per_cluster, cluster_count);
+            m_cluster_offsets[cluster] = static_cast<uint32_t>(total);
+            m_cluster_cursors[cluster] = static_cast<uint32_t>(total);
+            m_cluster_counts[cluster] = static_cast<uint32_t>(cluster_count);
+            total += cluster_count;
+        }
+
+        //  :    ,    
+        m_light_indices.resize(total);
+        for (size_t light = 0; light < count; ++light) {
+            const ClusterRange& range = m_ranges[light];
+            if (!range.visible) {
+                continue;
+            }
+            for (uint32_t z = range.min_z; z <= range.max_z; ++z) {
+                for (uint32_t y = range.min_y; y <= range.max_y; ++y) {
+                    const size_t row = (z * s_clusters_y + y) * s_clusters_x;
+                    for (uint32_t x = range.min_x; x <= range.max_x; ++x) {
+                        uint32_t& cursor = m_cluster_cursors[row + x];
+                        if (cursor < m_cluster_offsets[row + x] + m_cluster_counts[row + x]) {
+                            m_light_indices[cursor++] = static_cast<uint32_t>(light);
+                        }
+                    }
+                }
+            }
+        }
+
+        stats.lights_count = count;
+        stats.visible_lights_count = visible_count;
+        stats.light_indices_count = total;
+        stats.dropped_indices_count = dropped;
+        stats.max_lights_per_cluster = max_per_cluster;
+    }
+
+    void LightClusters::update(const PointLight* pLights, const size_t lights_count, const glm::mat4& view, const glm::mat4& projection,
+        const float near, const float far) {
+        if (m_benchmark_requested) {
+            m_benchmark_requested = false;
+            run_benchmark(view, projection, near, far);
+        }
+
+        const auto start_time = std::chrono::steady_clock::now();
+        assign(pLights, lights_count, view, projection, near, far, m_stats);
+        m_stats.assign_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+
+        //    ,        
+        m_lights_size = std::max<size_t>(m_gpu_lights.size(), 1) * sizeof(GpuLight);
+        m_clusters_size = s_clusters_count * 2 * sizeof(uint32_t);
+        m_light_indices_size = std::max<size_t>(m_light_indices.size(), 1) * sizeof(uint32_t);
+        void* pLightsData = m_staging_buffer.allocate(m_lights_size, s_storage_alignment, m_lights_offset);
+        void* pClustersData = m_staging_buffer.allocate(m_clusters_size, s_storage_alignment, m_clusters_offset);
+        void* pIndicesData = m_staging_buffer.allocate(m_light_indices_size, s_storage_alignment, m_light_indices_offset);
+        if (!pLightsData || !pClustersData || !pIndicesData) {
+            m_lights_size = m_clusters_size = m_light_indices_size = 0;
+            return;
+        }
+
+        //      
+        std::memcpy(pLightsData, m_gpu_lights.data(), m_gpu_lights.size() * sizeof(GpuLight));
+        uint32_t* pClusters = static_cast<uint32_t*>(pClustersData);
+        for (size_t cluster = 0; cluster < s_clusters_count; ++cluster) {
+            pClusters[2 * cluster] = m_cluster_offsets[cluster];
+            pClusters[2 * cluster + 1] = m_cluster_counts[cluster];
+        }
+        std::memcpy(pIndicesData, m_light_indices.data(), m_light_indices.size() * sizeof(uint32_t));
+    }
+
+    void LightClusters::bind(const ShaderProgram& shader_program) const {
+        shader_program.set_vec3("cluster_grid", glm::vec3(static_cast<float>(s_clusters_x), static_cast<float>(s_clusters_y),
+            static_cast<float>(s_clusters_z)));
+        shader_program.set_vec4("cluster_depth_params", glm::vec4(m_slice_scale, m_slice_bias, 0.f, 0.f));
+        if (m_lights_size == 0) {
+            return;
+        }
+        bind_lights();
+        Render_OpenGL::bind_storage_buffer(s_clusters_binding, m_staging_buffer.get_handle(), m_clusters_offset, m_clusters_size);
+        Render_OpenGL::bind_storage_buffer(s_light_indices_binding, m_staging_buffer.get_handle(), m_light_indices_offset, m_light_indices_size);
+    }
+
+    void LightClusters::bind_lights() const {
+        if (m_lights_size != 0) {
+            Render_OpenGL::bind_storage_buffer(s_lights_binding, m_staging_buffer.get_handle(), m_lights_offset, m_lights_size);
+        }
+    }
+
+    void LightClusters::end_frame() {
+        m_staging_buffer.flush();
+    }
+
+    void LightClusters::run_benchmark(const glm::mat4& view, const glm::mat4& projection, const float near, const float far) {
+        constexpr int s_repeats_count = 20;
+        //      :     
+        const glm::mat4 inverse_view = glm::inverse(view);
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> offset(-1.f, 1.f);
+        std::uniform_real_distribution<float> radius(0.5f, 2.5f);
+        std::vector<PointLight> lights(s_max_lights);
+        for (PointLight& light : lights) {
+            const glm::vec4 view_position(offset(random) * far * 0.3f, offset(random) * far * 0.3f, -(offset(random) * 0.5f + 0.5f) * far * 0.5f, 1.f);
+            light.position = glm::vec3(inverse_view * view_position);
+            light.radius = radius(random);
+            light.color = glm::vec3(1.f);
+            light.intensity = 1.f;
+        }
+
+        m_benchmark_results.clear();
+        Stats stats;
+        for (size_t lights_count = 64; lights_count <= s_max_lights; lights_count *= 2) {
+            const auto start_time = std::chrono::steady_clock::now();
+            for (int repeat = 0; repeat < s_repeats_count; ++repeat) {
+                assign(lights.data(), lights_count, view, projection, near, far, stats);
+            }
+            BenchmarkResult result;
+            result.lights_count = lights_count;
+            result.assign_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count() / s_repeats_count;
+            result.lights_per_cluster = static_cast<double>(stats.light_indices_count) / s_clusters_count;
+            m_benchmark_results.push_back(result);
+            LOG_CATEGORY_INFO(Render, "Light clusters: {0} lights ({1} visible) assigned in {2:.3f} ms, {3:.2f} lights per cluster, max {4}",
+                lights_count, stats.visible_lights_count, result.assign_ms, result.lights_per_cluster, stats.max_lights_per_cluster);
+        }
+    }
+
+    void LightClusters::on_ui_draw() {
+        ImGui::Begin("Lighting");
+        ImGui::Text("Clusters: %ux%ux%u", s_clusters_x, s_clusters_y, s_clusters_z);
+        ImGui::Text("Lights: %zu (%zu visible)", m_stats.lights_count, m_stats.visible_lights_count);
+        ImGui::Text("Light indices: %zu, max %zu per cluster", m_stats.light_indices_count, m_stats.max_lights_per_cluster);
+        if (m_stats.dropped_indices_count > 0) {
+            ImGui::Text("Dropped indices: %zu", m_stats.dropped_indices_count);
+        }
+        ImGui::Text("Assign: %.3f ms", m_stats.assign_ms);
+        if (ImGui::Button("Benchmark light counts")) {
+            m_benchmark_requested = true;
+        }
+        if (!m_benchmark_results.empty() && ImGui::BeginTable("light_benchmark", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Lights");
+            ImGui::TableSetupColumn("Assign, ms");
+            ImGui::TableSetupColumn("Per cluster");
+            ImGui::TableHeadersRow();
+            for (const BenchmarkResult& result : m_benchmark_results) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", result.lights_count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", result.assign_ms);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", result.lights_per_cluster);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "StagingBuffer.hpp"
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MyEngine {
+
+    class ShaderProgram;
+
+    //    ( ).       radius
+    struct PointLight {
+        glm::vec3 position;
+        float radius;
+        glm::vec3 color;
+        float intensity;
+    };
+
+    //   (): direction -     
+    struct DirectionalLight {
+        glm::vec3 direction;
+        float intensity;
+        glm::vec3 color;
+    };
+
+    //   .     s_clusters_x * s_clusters_y   
+    // s_clusters_z   (:   ).  CPU    
+    //       (SSE,  4 ),   
+    //      .  (  ),  
+    //            :
+    //      
+    class LightClusters {
+    public:
+        static constexpr uint32_t s_clusters_x = 16;
+        static constexpr uint32_t s_clusters_y = 9;
+        static constexpr uint32_t s_clusters_z = 24;
+        static constexpr size_t s_clusters_count = s_clusters_x * s_clusters_y * s_clusters_z;
+        //          ( )
+        static constexpr size_t s_max_lights = 4096;
+        static constexpr size_t s_max_light_indices = 256 * 1024;
+        //      
+        static constexpr unsigned int s_lights_binding = 1;
+        static constexpr unsigned int s_clusters_binding = 2;
+        static constexpr unsigned int s_light_indices_binding = 3;
+
+        //   
+        struct Stats {
+            size_t lights_count = 0;
+            size_t visible_lights_count = 0;
+            size_t light_indices_count = 0;
+            size_t dropped_indices_count = 0;
+            size_t max_lights_per_cluster = 0;
+            double assign_ms = 0.0;
+        };
+
+        //      
+        struct BenchmarkResult {
+            size_t lights_count = 0;
+            double assign_ms = 0.0;
+            double lights_per_cluster = 0.0;
+        };
+
+        LightClusters();
+
+        //            (near  far -  )
+        void update(const PointLight* pLights, const size_t lights_count, const glm::mat4& view, const glm::mat4& projection,
+            const float near, const float far);
+        //         (   )
+        void bind(const ShaderProgram& shader_program) const;
+        //     (     )
+        void bind_lights() const;
+        //  :    fence
+        void end_frame();
+
+        const Stats& get_stats() const { return m_stats; }
+
+        //    :     
+        // ( 64  s_max_lights,    GPU),       
+        void run_benchmark(const glm::mat4& view, const glm::mat4& projection, const float near, const float far);
+        //  .       update
+        void on_ui_draw();
+
+    private:
+        //    GPU (std430):      ,   
+        struct GpuLight {
+            glm::vec4 position_radius;
+            glm::vec4 color_intensity;
+        };
+
+        //      (,    )
+        struct ClusterRange {
+            uint8_t min_x, max_x, min_y, max_y, min_z, max_z;
+            bool visible;
+        };
+
+        //      CPU (   GPU)
+        void assign(const PointLight* pLights, const size_t lights_count, const glm::mat4& view, const glm::mat4& projection,
+            const float near, const float far, Stats& stats);
+        //         (      SSE)
+        ClusterRange get_range(const glm::vec3& view_position, const float radius, const glm::mat4& projection, const float far) const;
+        //       NDC  
+        ClusterRange get_range(const float min_x, const float max_x, const float min_y, const float max_y, const float depth, const float radius,
+            const float far) const;
+        //    ( -    )
+        uint32_t get_slice(const float depth) const;
+
+        StagingBuffer m_staging_buffer;
+        //      (0  -  )
+        size_t m_lights_offset = 0;
+        size_t m_lights_size = 0;
+        size_t m_clusters_offset = 0;
+        size_t m_clusters_size = 0;
+        size_t m_light_indices_offset = 0;
+        size_t m_light_indices_size = 0;
+
+        //  :  = log(depth) * scale + bias
+        float m_near = 0.1f;
+        float m_slice_scale = 0.f;
+        float m_slice_bias = 0.f;
+
+        //   (    ):   GPU   , , 
+        //      ,  
+        std::vector<GpuLight> m_gpu_lights;
+        std::vector<ClusterRange> m_ranges;
+        std::vector<uint32_t> m_cluster_counts;
+        std::vector<uint32_t> m_cluster_offsets;
+        std::vector<uint32_t> m_cluster_cursors;
+        std::vector<uint32_t> m_light_indices;
+
+        Stats m_stats;
+        std::vector<BenchmarkResult> m_benchmark_results;
+        bool m_benchmark_requested = false;
+    };
+
+}
\ No newline at end of file
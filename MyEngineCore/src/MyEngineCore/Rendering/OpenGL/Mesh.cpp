@@ -0,0 +1,113 @@
+#include "Mesh.hpp"
+
+#include "Render_OpenGL.hpp"
+#include "StagingBuffer.hpp"
+#include "MyEngineCore/Log.hpp"
+
+namespace MyEngine {
+
+    // :        
+    Mesh::Mesh(const MeshFile& mesh_file, const EUploadMode upload_mode, StagingBuffer* staging_buffer) {
+        const MeshFileHeader& header = mesh_file.get_header();
+        StagingBuffer* staging = select_staging_buffer(upload_mode, staging_buffer);
+
+        //    
+        for (uint32_t i = 0; i < header.streams_count; ++i) {
+            add_stream(mesh_file.get_stream_data(i), static_cast<size_t>(mesh_file.get_stream(i).data_size),
+                mesh_file.get_stream_layout(i), staging);
+        }
+        set_indices(mesh_file.get_indices(), static_cast<size_t>(header.indices_count), staging);
+
+        //     
+        m_submeshes.assign(mesh_file.get_submeshes(), mesh_file.get_submeshes() + header.submeshes_count);
+        m_lods.assign(mesh_file.get_lods(), mesh_file.get_lods() + header.lods_count);
+        m_bounds = header.bounds;
+        add_default_tables(static_cast<size_t>(header.indices_count));
+    }
+
+    //    
+    Mesh::Mesh(const MeshData& mesh_data, const EUploadMode upload_mode, StagingBuffer* staging_buffer) {
+        StagingBuffer* staging = select_staging_buffer(upload_mode, staging_buffer);
+
+        for (const MeshData::Stream& stream : mesh_data.streams) {
+            std::vector<BufferElement> elements(stream.elements.begin(), stream.elements.end());
+            add_stream(stream.data.data(), stream.data.size(), BufferLayout(std::move(elements)), staging);
+        }
+        set_indices(mesh_data.indices.data(), mesh_data.indices.size(), staging);
+
+        m_submeshes = mesh_data.submeshes;
+        m_lods = mesh_data.lods;
+        m_bounds = mesh_data.bounds;
+        add_default_tables(mesh_data.indices.size());
+    }
+
+    // Staging-    nullptr   
+    StagingBuffer* Mesh::select_staging_buffer(const EUploadMode upload_mode, StagingBuffer* staging_buffer) {
+        if (upload_mode != EUploadMode::Staging) {
+            return nullptr;
+        }
+        if (!staging_buffer) {
+            LOG_WARN("Mesh: staging upload requested without a staging buffer, uploading directly");
+        }
+        return staging_buffer;
+    }
+
+    //  
+    void Mesh::add_stream(const void* data, const size_t size, BufferLayout layout, StagingBuffer* staging_buffer) {
+        auto vertex_buffer = std::make_unique<VertexBuffer>(staging_buffer ? nullptr : data, size,
+            std::move(layout), VertexBuffer::EUsage::Immutable);
+        if (staging_buffer) {
+            staging_buffer->upload(vertex_buffer->get_handle(), 0, data, size);
+        }
+        m_vertex_array.add_vertex_buffer(*vertex_buffer);
+        m_vertex_buffers.push_back(std::move(vertex_buffer));
+        m_memory_size += size;
+    }
+
+    // 
+    void Mesh::set_indices(const uint32_t* indices, const size_t indices_count, StagingBuffer* staging_buffer) {
+        m_index_buffer = std::make_unique<IndexBuffer>(staging_buffer ? nullptr : indices, indices_count, VertexBuffer::EUsage::Immutable);
+        if (staging_buffer) {
+            staging_buffer->upload(m_index_buffer->get_handle(), 0, indices, indices_count * sizeof(uint32_t));
+        }
+        m_vertex_array.set_index_buffer(*m_index_buffer);
+        m_memory_size += indices_count * sizeof(uint32_t);
+    }
+
+    //     
+    void Mesh::add_default_tables(const size_t indices_count) {
+        if (m_submeshes.empty()) {
+            MeshSubmesh submesh{};
+            submesh.indices_count = static_cast<uint32_t>(indices_count);
+            submesh.bounds = m_bounds;
+            m_submeshes.push_back(submesh);
+        }
+        if (m_lods.empty()) {
+            m_lods.push_back({ 0, static_cast<uint32_t>(m_submeshes.size()), 0.f, 0 });
+        }
+    }
+
+    //  
+    void Mesh::draw_submesh(const size_t submesh_index) const {
+        const MeshSubmesh& submesh = m_submeshes[submesh_index];
+        Render_OpenGL::draw(m_vertex_array, submesh.first_index, submesh.indices_count, submesh.base_vertex);
+    }
+
+    //   
+    void Mesh::draw_lod(const size_t lod_index) const {
+        const MeshLOD& lod = m_lods[lod_index];
+        for (uint32_t i = lod.first_submesh; i < lod.first_submesh + lod.submeshes_count; ++i) {
+            draw_submesh(i);
+        }
+    }
+
+    //   : LOD-     , screen_size 
+    size_t Mesh::select_lod(const float screen_size) const {
+        for (size_t i = 0; i < m_lods.size(); ++i) {
+            if (screen_size >= m_lods[i].screen_size) {
+                return i;
+            }
+        }
+        return m_lods.size() - 1;
+    }
+}
\ No newline at end of file
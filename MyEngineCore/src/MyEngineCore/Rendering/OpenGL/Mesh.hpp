@@ -0,0 +1,64 @@
+#pragma once
+
+#include "VertexArray.hpp"
+#include "MyEngineCore/Resources/MeshFile.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace MyEngine {
+
+    class StagingBuffer;
+
+    //    GPU:  , ,    
+    class Mesh {
+    public:
+        //  :      glNamedBufferStorage     staging-
+        enum class EUploadMode {
+            Direct,
+            Staging
+        };
+
+        //     (staging_buffer    EUploadMode::Staging)
+        Mesh(const MeshFile& mesh_file, const EUploadMode upload_mode = EUploadMode::Direct, StagingBuffer* staging_buffer = nullptr);
+        //      ( MeshImporter)
+        Mesh(const MeshData& mesh_data, const EUploadMode upload_mode = EUploadMode::Direct, StagingBuffer* staging_buffer = nullptr);
+
+        //      
+        Mesh(const Mesh&) = delete;
+        Mesh& operator=(const Mesh&) = delete;
+
+        //       
+        void draw_submesh(const size_t submesh_index) const;
+        void draw_lod(const size_t lod_index) const;
+        //      
+        size_t select_lod(const float screen_size) const;
+
+        const VertexArray& get_vertex_array() const { return m_vertex_array; }
+        const std::vector<MeshSubmesh>& get_submeshes() const { return m_submeshes; }
+        const std::vector<MeshLOD>& get_lods() const { return m_lods; }
+        const MeshBounds& get_bounds() const { return m_bounds; }
+        //      
+        size_t get_memory_size() const { return m_memory_size; }
+
+    private:
+        //       (staging_buffer == nullptr -  )
+        void add_stream(const void* data, const size_t size, BufferLayout layout, StagingBuffer* staging_buffer);
+        void set_indices(const uint32_t* indices, const size_t indices_count, StagingBuffer* staging_buffer);
+        //   LOD  ,   
+        void add_default_tables(const size_t indices_count);
+        static StagingBuffer* select_staging_buffer(const EUploadMode upload_mode, StagingBuffer* staging_buffer);
+
+        //    
+        VertexArray m_vertex_array;
+        std::vector<std::unique_ptr<VertexBuffer>> m_vertex_buffers;
+        std::unique_ptr<IndexBuffer> m_index_buffer;
+
+        //     ,     
+        std::vector<MeshSubmesh> m_submeshes;
+        std::vector<MeshLOD> m_lods;
+        MeshBounds m_bounds;
+        size_t m_memory_size = 0;
+    };
+
+}
\ No newline at end of file
@@ -6,9 +6,145 @@
 #include "VertexArray.hpp"
 #include "MyEngineCore/Log.hpp"
 
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cstring>
+#include <fstream>
+
 
 namespace MyEngine {
 
+    //        (       )
+    constexpr size_t s_cached_texture_units = 32;
+    constexpr size_t s_cached_storage_bindings = 16;
+    //  :      ,     
+    constexpr GLuint s_unknown_object = ~0u;
+    constexpr int s_unknown_flag = -1;
+
+    //    
+    struct StorageBinding {
+        GLuint buffer = s_unknown_object;
+        size_t offset = 0;
+        size_t size = 0;
+
+        bool operator==(const StorageBinding& other) const {
+            return buffer == other.buffer && offset == other.offset && size == other.size;
+        }
+    };
+
+    //  
+    struct Viewport {
+        GLint x = 0, y = 0;
+        GLsizei width = -1, height = -1;
+
+        bool operator==(const Viewport& other) const {
+            return x == other.x && y == other.y && width == other.width && height == other.height;
+        }
+    };
+
+    //     
+    struct GLStateCache {
+        GLuint program = s_unknown_object;
+        GLuint vertex_array = s_unknown_object;
+        GLuint framebuffer = s_unknown_object;
+        GLuint pixel_unpack_buffer = s_unknown_object;
+        GLuint draw_indirect_buffer = s_unknown_object;
+        std::array<GLuint, s_cached_texture_units> textures;
+        std::array<StorageBinding, s_cached_storage_bindings> storage_bindings;
+        // : 0 / 1, s_unknown_flag - 
+        int depth_test = s_unknown_flag;
+        int depth_write = s_unknown_flag;
+        int color_write = s_unknown_flag;
+        int blend = s_unknown_flag;
+        int additive_blend_function = s_unknown_flag;
+        int cull = s_unknown_flag;
+        int polygon_offset = s_unknown_flag;
+        //  (0 - )
+        GLenum depth_function = 0;
+        GLenum cull_face = 0;
+        GLint unpack_alignment = 0;
+        std::array<float, 2> polygon_offset_values{ -1.f, -1.f };
+        std::array<float, 4> clear_color{ -1.f, -1.f, -1.f, -1.f };
+        Viewport viewport;
+
+        GLStateCache() {
+            textures.fill(s_unknown_object);
+        }
+    };
+
+    //      ( )
+    struct GLStateTracker {
+        GLStateCache cache;
+        Render_OpenGL::FrameStats frame_stats;
+        std::array<Render_OpenGL::FrameStats, Render_OpenGL::s_stats_history_size> history;
+        size_t history_count = 0;
+        size_t history_next = 0;
+        uint64_t frame_index = 0;
+    };
+
+    static GLStateTracker& get_tracker() {
+        static GLStateTracker tracker;
+        return tracker;
+    }
+
+    //   . true -        
+    template <typename T>
+    static bool change_state(T& cached, const T& value) {
+        Render_OpenGL::FrameStats& stats = get_tracker().frame_stats;
+        if (cached == value) {
+            ++stats.state_changes_skipped;
+            return false;
+        }
+        cached = value;
+        ++stats.state_changes_issued;
+        return true;
+    }
+
+    //     ( CSV,  JSON,  )
+    struct FrameStatsField {
+        const char* name;
+        size_t Render_OpenGL::FrameStats::* pMember;
+    };
+
+    static const FrameStatsField s_frame_stats_fields[] = {
+        { "draw_calls", &Render_OpenGL::FrameStats::draw_calls_count },
+        { "instances", &Render_OpenGL::FrameStats::instances_count },
+        { "triangles", &Render_OpenGL::FrameStats::triangles_count },
+        { "compute_dispatches", &Render_OpenGL::FrameStats::compute_dispatches_count },
+        { "program_binds", &Render_OpenGL::FrameStats::program_binds_count },
+        { "vertex_array_binds", &Render_OpenGL::FrameStats::vertex_array_binds_count },
+        { "texture_binds", &Render_OpenGL::FrameStats::texture_binds_count },
+        { "uniform_uploads", &Render_OpenGL::FrameStats::uniform_uploads_count },
+        { "buffer_upload_bytes", &Render_OpenGL::FrameStats::buffer_upload_bytes },
+        { "texture_uploads", &Render_OpenGL::FrameStats::texture_uploads_count },
+        { "texture_upload_bytes", &Render_OpenGL::FrameStats::texture_upload_bytes },
+        { "state_changes_issued", &Render_OpenGL::FrameStats::state_changes_issued },
+        { "state_changes_skipped", &Render_OpenGL::FrameStats::state_changes_skipped }
+    };
+
+    //   
+    static void count_draw(const size_t draws_count, const size_t instances_count, const size_t triangles_count) {
+        Render_OpenGL::FrameStats& stats = get_tracker().frame_stats;
+        stats.draw_calls_count += draws_count;
+        stats.instances_count += instances_count;
+        stats.triangles_count += triangles_count;
+    }
+
+    //   OpenGL  
+    static void set_capability(int& cached, const GLenum capability, const bool enabled) {
+        if (change_state(cached, enabled ? 1 : 0)) {
+            if (enabled) {
+                glEnable(capability);
+            }
+            else {
+                glDisable(capability);
+            }
+        }
+    }
+
     const char* gl_source_to_string(const GLenum source){
         switch (source){
         case GL_DEBUG_SOURCE_API: return "DEBUG_SOURCE_API";
@@ -57,19 +193,19 @@ namespace MyEngine {
             const void* userParam){
             switch (severity){
             case GL_DEBUG_SEVERITY_HIGH:
-                LOG_ERROR("OpenGL Error: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
+                LOG_CATEGORY_ERROR(Render, "OpenGL Error: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
                 break;
             case GL_DEBUG_SEVERITY_MEDIUM:
-                LOG_WARN("OpenGL Warning: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
+                LOG_CATEGORY_WARN(Render, "OpenGL Warning: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
                 break;
             case GL_DEBUG_SEVERITY_LOW:
-                LOG_INFO("OpenGL Info: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
+                LOG_CATEGORY_INFO(Render, "OpenGL Info: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
                 break;
             case GL_DEBUG_SEVERITY_NOTIFICATION:
-                LOG_INFO("OpenGL Notificaton: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
+                LOG_CATEGORY_INFO(Render, "OpenGL Notificaton: [{0}:{1}]({2}): {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
                 break;
             default:
-                LOG_ERROR("OpenGL Error: [{0}:{1}] ({2}) : {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
+                LOG_CATEGORY_ERROR(Render, "OpenGL Error: [{0}:{1}] ({2}) : {3}", gl_source_to_string(source), gl_type_to_string(type), id, message);
             }
         }, nullptr);
         return true;
@@ -77,13 +213,87 @@ namespace MyEngine {
 
     //  
     void Render_OpenGL::draw(const VertexArray& vertex_array) {
+        count_draw(1, 1, vertex_array.get_indices_count() / 3);
         vertex_array.bind();
         glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(vertex_array.get_indices_count()), GL_UNSIGNED_INT, nullptr);
     }
 
+    //    ()
+    void Render_OpenGL::draw(const VertexArray& vertex_array, const size_t first_index, const size_t indices_count, const int base_vertex) {
+        count_draw(1, 1, indices_count / 3);
+        vertex_array.bind();
+        glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(indices_count), GL_UNSIGNED_INT,
+            reinterpret_cast<const void*>(first_index * sizeof(GLuint)), base_vertex);
+    }
+
+    //   
+    void Render_OpenGL::draw_instanced(const VertexArray& vertex_array, const size_t instances_count) {
+        count_draw(1, instances_count, vertex_array.get_indices_count() / 3 * instances_count);
+        vertex_array.bind();
+        glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(vertex_array.get_indices_count()), GL_UNSIGNED_INT, nullptr,
+            static_cast<GLsizei>(instances_count));
+    }
+
+    //   
+    void Render_OpenGL::draw_arrays(const VertexArray& vertex_array, const size_t vertices_count) {
+        count_draw(1, 1, vertices_count / 3);
+        vertex_array.bind();
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices_count));
+    }
+
+    //     
+    void Render_OpenGL::draw_indirect(const VertexArray& vertex_array, const unsigned int indirect_buffer, const size_t offset) {
+        count_draw(1, 0, 0);
+        vertex_array.bind();
+        bind_draw_indirect_buffer(indirect_buffer);
+        glDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(offset));
+    }
+
+    //   
+    void Render_OpenGL::dispatch_compute(const unsigned int groups_x, const unsigned int groups_y, const unsigned int groups_z) {
+        ++get_tracker().frame_stats.compute_dispatches_count;
+        glDispatchCompute(groups_x, groups_y, groups_z);
+    }
+
+    //  
+    void Render_OpenGL::memory_barrier(const EMemoryBarrier barriers) {
+        const unsigned int flags = static_cast<unsigned int>(barriers);
+        GLbitfield bits = 0;
+        if (flags & static_cast<unsigned int>(EMemoryBarrier::StorageBuffer)) {
+            bits |= GL_SHADER_STORAGE_BARRIER_BIT;
+        }
+        if (flags & static_cast<unsigned int>(EMemoryBarrier::Command)) {
+            bits |= GL_COMMAND_BARRIER_BIT;
+        }
+        if (flags & static_cast<unsigned int>(EMemoryBarrier::ImageAccess)) {
+            bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+        }
+        if (flags & static_cast<unsigned int>(EMemoryBarrier::TextureFetch)) {
+            bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+        }
+        if (flags & static_cast<unsigned int>(EMemoryBarrier::BufferUpdate)) {
+            bits |= GL_BUFFER_UPDATE_BARRIER_BIT;
+        }
+        glMemoryBarrier(bits);
+    }
+
+    //    
+    void Render_OpenGL::bind_storage_buffer(const unsigned int binding, const unsigned int buffer, const size_t offset, const size_t size) {
+        GLStateTracker& tracker = get_tracker();
+        if (binding < s_cached_storage_bindings && !change_state(tracker.cache.storage_bindings[binding], StorageBinding{ buffer, offset, size })) {
+            return;
+        }
+        if (binding >= s_cached_storage_bindings) {
+            ++tracker.frame_stats.state_changes_issued;
+        }
+        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+    }
+
     //   
     void Render_OpenGL::set_clear_color(const float r, const float g, const float b, const float a) {
-        glClearColor(r, g, b, a);
+        if (change_state(get_tracker().cache.clear_color, std::array<float, 4>{ r, g, b, a })) {
+            glClearColor(r, g, b, a);
+        }
     }
 
     //  
@@ -94,17 +304,382 @@ namespace MyEngine {
     //  
     void Render_OpenGL::set_viewport(const unsigned int width, const unsigned int height, 
         const unsigned int left_offset, const unsigned int bottom_offset) {
-        glViewport(left_offset, bottom_offset, width, height);
+        const Viewport viewport{ static_cast<GLint>(left_offset), static_cast<GLint>(bottom_offset), static_cast<GLsizei>(width),
+            static_cast<GLsizei>(height) };
+        if (change_state(get_tracker().cache.viewport, viewport)) {
+            glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
+        }
     }
 
     //   
     void Render_OpenGL::enable_depth_test(){
-        glEnable(GL_DEPTH_TEST);
+        set_capability(get_tracker().cache.depth_test, GL_DEPTH_TEST, true);
     }
 
     //   
     void Render_OpenGL::disable_depth_test(){
-        glDisable(GL_DEPTH_TEST);
+        set_capability(get_tracker().cache.depth_test, GL_DEPTH_TEST, false);
+    }
+
+    //   
+    void Render_OpenGL::set_depth_function(const EDepthFunction depth_function) {
+        GLenum function = GL_LESS;
+        switch (depth_function) {
+        case EDepthFunction::Less: function = GL_LESS; break;
+        case EDepthFunction::LessOrEqual: function = GL_LEQUAL; break;
+        case EDepthFunction::Equal: function = GL_EQUAL; break;
+        case EDepthFunction::GreaterOrEqual: function = GL_GEQUAL; break;
+        case EDepthFunction::Always: function = GL_ALWAYS; break;
+        }
+        if (change_state(get_tracker().cache.depth_function, function)) {
+            glDepthFunc(function);
+        }
+    }
+
+    //  
+    void Render_OpenGL::set_depth_write(const bool enabled) {
+        if (change_state(get_tracker().cache.depth_write, enabled ? 1 : 0)) {
+            glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+        }
+    }
+
+    //  
+    void Render_OpenGL::set_color_write(const bool enabled) {
+        if (change_state(get_tracker().cache.color_write, enabled ? 1 : 0)) {
+            const GLboolean mask = enabled ? GL_TRUE : GL_FALSE;
+            glColorMask(mask, mask, mask, mask);
+        }
+    }
+
+    //  .     :     
+    void Render_OpenGL::set_additive_blending(const bool enabled) {
+        GLStateCache& cache = get_tracker().cache;
+        set_capability(cache.blend, GL_BLEND, enabled);
+        if (enabled && change_state(cache.additive_blend_function, 1)) {
+            glBlendEquation(GL_FUNC_ADD);
+            glBlendFunc(GL_ONE, GL_ONE);
+        }
+    }
+
+    //  
+    void Render_OpenGL::set_face_culling(const ECullFace cull_face) {
+        GLStateCache& cache = get_tracker().cache;
+        set_capability(cache.cull, GL_CULL_FACE, cull_face != ECullFace::None);
+        if (cull_face != ECullFace::None) {
+            const GLenum face = cull_face == ECullFace::Back ? GL_BACK : GL_FRONT;
+            if (change_state(cache.cull_face, face)) {
+                glCullFace(face);
+            }
+        }
+    }
+
+    //    (   )
+    void Render_OpenGL::set_depth_bias(const float slope_factor, const float constant_units) {
+        GLStateCache& cache = get_tracker().cache;
+        const bool enabled = slope_factor != 0.f || constant_units != 0.f;
+        set_capability(cache.polygon_offset, GL_POLYGON_OFFSET_FILL, enabled);
+        if (enabled && change_state(cache.polygon_offset_values, std::array<float, 2>{ slope_factor, constant_units })) {
+            glPolygonOffset(slope_factor, constant_units);
+        }
+    }
+
+    //     
+    void Render_OpenGL::set_unpack_alignment(const int alignment) {
+        if (change_state(get_tracker().cache.unpack_alignment, static_cast<GLint>(alignment))) {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+        }
+    }
+
+    //  
+    void Render_OpenGL::bind_program(const unsigned int program) {
+        GLStateTracker& tracker = get_tracker();
+        if (change_state(tracker.cache.program, program)) {
+            ++tracker.frame_stats.program_binds_count;
+            glUseProgram(program);
+        }
+    }
+
+    //   
+    void Render_OpenGL::bind_vertex_array(const unsigned int vertex_array) {
+        GLStateTracker& tracker = get_tracker();
+        if (change_state(tracker.cache.vertex_array, vertex_array)) {
+            ++tracker.frame_stats.vertex_array_binds_count;
+            glBindVertexArray(vertex_array);
+        }
+    }
+
+    //    
+    void Render_OpenGL::bind_texture_unit(const unsigned int unit, const unsigned int texture) {
+        GLStateTracker& tracker = get_tracker();
+        if (unit < s_cached_texture_units && !change_state(tracker.cache.textures[unit], texture)) {
+            return;
+        }
+        if (unit >= s_cached_texture_units) {
+            ++tracker.frame_stats.state_changes_issued;
+        }
+        ++tracker.frame_stats.texture_binds_count;
+        glBindTextureUnit(unit, texture);
+    }
+
+    //       
+    void Render_OpenGL::bind_framebuffer(const unsigned int framebuffer) {
+        if (change_state(get_tracker().cache.framebuffer, framebuffer)) {
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        }
+    }
+
+    //  -  
+    void Render_OpenGL::bind_pixel_unpack_buffer(const unsigned int buffer) {
+        if (change_state(get_tracker().cache.pixel_unpack_buffer, buffer)) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+        }
+    }
+
+    //    indirect 
+    void Render_OpenGL::bind_draw_indirect_buffer(const unsigned int buffer) {
+        if (change_state(get_tracker().cache.draw_indirect_buffer, buffer)) {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer);
+        }
+    }
+
+    //   
+    void Render_OpenGL::get_viewport(unsigned int& width, unsigned int& height, unsigned int& left_offset, unsigned int& bottom_offset) {
+        Viewport& viewport = get_tracker().cache.viewport;
+        if (viewport.width < 0) {
+            GLint values[4] = {};
+            glGetIntegerv(GL_VIEWPORT, values);
+            viewport = Viewport{ values[0], values[1], values[2], values[3] };
+        }
+        left_offset = static_cast<unsigned int>(viewport.x);
+        bottom_offset = static_cast<unsigned int>(viewport.y);
+        width = static_cast<unsigned int>(viewport.width);
+        height = static_cast<unsigned int>(viewport.height);
+    }
+
+    //      
+    void Render_OpenGL::read_pixels(const unsigned int width, const unsigned int height, void* pPixels) {
+        glReadPixels(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, pPixels);
+    }
+
+    //  
+    void Render_OpenGL::on_program_deleted(const unsigned int program) {
+        GLStateCache& cache = get_tracker().cache;
+        if (cache.program == program) {
+            cache.program = s_unknown_object;
+        }
+    }
+
+    void Render_OpenGL::on_vertex_array_deleted(const unsigned int vertex_array) {
+        GLStateCache& cache = get_tracker().cache;
+        if (cache.vertex_array == vertex_array) {
+            cache.vertex_array = s_unknown_object;
+        }
+    }
+
+    void Render_OpenGL::on_texture_deleted(const unsigned int texture) {
+        for (GLuint& bound_texture : get_tracker().cache.textures) {
+            if (bound_texture == texture) {
+                bound_texture = s_unknown_object;
+            }
+        }
+    }
+
+    void Render_OpenGL::on_framebuffer_deleted(const unsigned int framebuffer) {
+        GLStateCache& cache = get_tracker().cache;
+        if (cache.framebuffer == framebuffer) {
+            cache.framebuffer = s_unknown_object;
+        }
+    }
+
+    void Render_OpenGL::on_buffer_deleted(const unsigned int buffer) {
+        GLStateCache& cache = get_tracker().cache;
+        if (cache.pixel_unpack_buffer == buffer) {
+            cache.pixel_unpack_buffer = s_unknown_object;
+        }
+        if (cache.draw_indirect_buffer == buffer) {
+            cache.draw_indirect_buffer = s_unknown_object;
+        }
+        for (StorageBinding& binding : cache.storage_bindings) {
+            if (binding.buffer == buffer) {
+                binding = StorageBinding{};
+            }
+        }
+    }
+
+    //  
+    void Render_OpenGL::invalidate_state_cache() {
+        get_tracker().cache = GLStateCache();
+    }
+
+    //  
+    void Render_OpenGL::on_uniform_uploaded() {
+        ++get_tracker().frame_stats.uniform_uploads_count;
+    }
+
+    void Render_OpenGL::on_buffer_uploaded(const size_t bytes) {
+        get_tracker().frame_stats.buffer_upload_bytes += bytes;
+    }
+
+    void Render_OpenGL::on_texture_uploaded(const size_t bytes) {
+        FrameStats& stats = get_tracker().frame_stats;
+        ++stats.texture_uploads_count;
+        stats.texture_upload_bytes += bytes;
+    }
+
+    //     
+    void Render_OpenGL::end_frame() {
+        GLStateTracker& tracker = get_tracker();
+        tracker.frame_stats.frame_index = tracker.frame_index++;
+        tracker.history[tracker.history_next] = tracker.frame_stats;
+        tracker.history_next = (tracker.history_next + 1) % s_stats_history_size;
+        tracker.history_count = std::min(tracker.history_count + 1, s_stats_history_size);
+        tracker.frame_stats = FrameStats();
+    }
+
+    const Render_OpenGL::FrameStats& Render_OpenGL::get_frame_stats(const size_t age) {
+        static const FrameStats s_empty_stats;
+        const GLStateTracker& tracker = get_tracker();
+        if (age >= tracker.history_count) {
+            return s_empty_stats;
+        }
+        return tracker.history[(tracker.history_next + s_stats_history_size - 1 - age) % s_stats_history_size];
+    }
+
+    size_t Render_OpenGL::get_stats_history_count() {
+        return get_tracker().history_count;
+    }
+
+    //    CSV:   
+    bool Render_OpenGL::write_stats_csv(const std::string& path) {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("Render_OpenGL: can't create '{0}'", path);
+            return false;
+        }
+        file << "frame";
+        for (const FrameStatsField& field : s_frame_stats_fields) {
+            file << ',' << field.name;
+        }
+        file << '\n';
+        const size_t frames_count = get_stats_history_count();
+        for (size_t age = frames_count; age-- > 0;) {
+            const FrameStats& stats = get_frame_stats(age);
+            file << stats.frame_index;
+            for (const FrameStatsField& field : s_frame_stats_fields) {
+                file << ',' << stats.*field.pMember;
+            }
+            file << '\n';
+        }
+        if (!file) {
+            LOG_ERROR("Render_OpenGL: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+
+    //   JSON:         
+    bool Render_OpenGL::write_stats_json(const std::string& path) {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("Render_OpenGL: can't create '{0}'", path);
+            return false;
+        }
+        constexpr size_t s_fields_count = sizeof(s_frame_stats_fields) / sizeof(s_frame_stats_fields[0]);
+        const size_t frames_count = get_stats_history_count();
+        std::array<double, s_fields_count> averages{};
+        std::array<size_t, s_fields_count> maximums{};
+        for (size_t age = 0; age < frames_count; ++age) {
+            const FrameStats& stats = get_frame_stats(age);
+            for (size_t i = 0; i < s_fields_count; ++i) {
+                const size_t value = stats.*s_frame_stats_fields[i].pMember;
+                averages[i] += static_cast<double>(value) / frames_count;
+                maximums[i] = std::max(maximums[i], value);
+            }
+        }
+        const auto write_object = [&file](const auto& values) {
+            file << "{ ";
+            for (size_t i = 0; i < s_fields_count; ++i) {
+                file << '"' << s_frame_stats_fields[i].name << "\": " << values[i] << (i + 1 < s_fields_count ? ", " : " }");
+            }
+        };
+        file << "{\n";
+        file << "  \"frames\": " << frames_count << ",\n";
+        file << "  \"average\": ";
+        write_object(averages);
+        file << ",\n  \"max\": ";
+        write_object(maximums);
+        file << ",\n  \"history\": [\n";
+        for (size_t age = frames_count; age-- > 0;) {
+            const FrameStats& stats = get_frame_stats(age);
+            file << "    { \"frame\": " << stats.frame_index;
+            for (const FrameStatsField& field : s_frame_stats_fields) {
+                file << ", \"" << field.name << "\": " << stats.*field.pMember;
+            }
+            file << (age > 0 ? " },\n" : " }\n");
+        }
+        file << "  ]\n}\n";
+        if (!file) {
+            LOG_ERROR("Render_OpenGL: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+
+    //  :  ,     ,     
+    void Render_OpenGL::on_ui_draw() {
+        ImGui::Begin("Render stats");
+        const size_t frames_count = get_stats_history_count();
+        ImGui::Text("Last %zu frames", frames_count);
+        if (frames_count > 0 && ImGui::BeginTable("render_stats", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Counter");
+            ImGui::TableSetupColumn("Last");
+            ImGui::TableSetupColumn("Average");
+            ImGui::TableSetupColumn("Max");
+            ImGui::TableHeadersRow();
+            const FrameStats& last_stats = get_frame_stats();
+            for (const FrameStatsField& field : s_frame_stats_fields) {
+                double average = 0.0;
+                size_t maximum = 0;
+                for (size_t age = 0; age < frames_count; ++age) {
+                    const size_t value = get_frame_stats(age).*field.pMember;
+                    average += static_cast<double>(value) / frames_count;
+                    maximum = std::max(maximum, value);
+                }
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(field.name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", last_stats.*field.pMember);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", average);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", maximum);
+            }
+            ImGui::EndTable();
+        }
+
+        // :     
+        const auto plot = [frames_count](const char* label, size_t FrameStats::* pMember) {
+            struct PlotData {
+                size_t frames_count;
+                size_t FrameStats::* pMember;
+            } data{ frames_count, pMember };
+            ImGui::PlotLines(label, [](void* pData, int index) {
+                const PlotData& plot_data = *static_cast<const PlotData*>(pData);
+                return static_cast<float>(get_frame_stats(plot_data.frames_count - 1 - static_cast<size_t>(index)).*plot_data.pMember);
+            }, &data, static_cast<int>(frames_count), 0, nullptr, 0.f, FLT_MAX, ImVec2(0.f, 60.f));
+        };
+        plot("Draw calls", &FrameStats::draw_calls_count);
+        plot("Triangles", &FrameStats::triangles_count);
+
+        if (ImGui::Button("Dump render stats CSV")) {
+            write_stats_csv("render_stats.csv");
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Dump render stats JSON")) {
+            write_stats_json("render_stats.json");
+        }
+        ImGui::End();
     }
 
     //    
@@ -121,4 +696,16 @@ namespace MyEngine {
         return reinterpret_cast<const char*>(glGetString(GL_VERSION));
     }
 
+    bool Render_OpenGL::is_extension_supported(const char* name) {
+        GLint extensions_count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensions_count);
+        for (GLint i = 0; i < extensions_count; ++i) {
+            const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+            if (extension && std::strcmp(extension, name) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
 }
\ No newline at end of file
@@ -1,28 +1,155 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 struct GLFWwindow;
 
 namespace MyEngine {
     class VertexArray;
 
-    //  
+    //   
+    enum class EDepthFunction {
+        Less,
+        LessOrEqual,
+        Equal,
+        GreaterOrEqual,
+        Always
+    };
+
+    //  
+    enum class ECullFace {
+        None,
+        Back,
+        Front
+    };
+
+    //       (   |)
+    enum class EMemoryBarrier : unsigned int {
+        StorageBuffer = 1,
+        Command = 2,
+        ImageAccess = 4,
+        TextureFetch = 8,
+        BufferUpdate = 16
+    };
+
+    inline EMemoryBarrier operator|(const EMemoryBarrier a, const EMemoryBarrier b) {
+        return static_cast<EMemoryBarrier>(static_cast<unsigned int>(a) | static_cast<unsigned int>(b));
+    }
+
+    //  .    OpenGL (,  , , ,  ,
+    // , ,  ,  )   :    , 
+    //     . ,      ( ImGui),
+    //    invalidate_state_cache.
+    //     ( , , , )   
+    //  s_stats_history_size 
     class Render_OpenGL {
     public:
+        static constexpr size_t s_stats_history_size = 600;
+
+        //  
+        struct FrameStats {
+            uint64_t frame_index = 0;
+            //  ,  (  -  )  
+            size_t draw_calls_count = 0;
+            size_t instances_count = 0;
+            size_t triangles_count = 0;
+            size_t compute_dispatches_count = 0;
+            // ,   
+            size_t program_binds_count = 0;
+            size_t vertex_array_binds_count = 0;
+            size_t texture_binds_count = 0;
+            size_t uniform_uploads_count = 0;
+            // ,    GPU,    
+            size_t buffer_upload_bytes = 0;
+            size_t texture_uploads_count = 0;
+            size_t texture_upload_bytes = 0;
+            //   :      (  )
+            size_t state_changes_issued = 0;
+            size_t state_changes_skipped = 0;
+        };
+
         //  
         static bool init(GLFWwindow* pWindow);
 
         // ,  ,  ,  ,   (  )
         static void draw(const VertexArray& vertex_array);
+        //    ():    ,  
+        static void draw(const VertexArray& vertex_array, const size_t first_index, const size_t indices_count, const int base_vertex = 0);
+        //  instances_count  (    - gl_InstanceID)
+        static void draw_instanced(const VertexArray& vertex_array, const size_t instances_count);
+        //    (     gl_VertexID,   )
+        static void draw_arrays(const VertexArray& vertex_array, const size_t vertices_count);
+        //      (glDrawElementsIndirect, offset -    ).  
+        //   ,        
+        static void draw_indirect(const VertexArray& vertex_array, const unsigned int indirect_buffer, const size_t offset = 0);
+        //    (   )      
+        static void dispatch_compute(const unsigned int groups_x, const unsigned int groups_y = 1, const unsigned int groups_z = 1);
+        static void memory_barrier(const EMemoryBarrier barriers);
+        //      binding   (layout(std430, binding = N) buffer)
+        static void bind_storage_buffer(const unsigned int binding, const unsigned int buffer, const size_t offset, const size_t size);
         static void set_clear_color(const float r, const float g, const float b, const float a);
         static void clear();
         static void set_viewport(const unsigned int width, const unsigned int height, const unsigned int left_offset = 0, const unsigned int bottom_offset = 0);
         static void enable_depth_test();
         static void disable_depth_test();
+        //     
+        static void set_depth_function(const EDepthFunction depth_function);
+        static void set_depth_write(const bool enabled);
+        //      (    )
+        static void set_color_write(const bool enabled);
+        //   ( )   
+        static void set_additive_blending(const bool enabled);
+        static void set_face_culling(const ECullFace cull_face);
+        //       (   ), 0  0 - 
+        static void set_depth_bias(const float slope_factor, const float constant_units);
+        //       (GL_UNPACK_ALIGNMENT: 1, 2, 4  8)
+        static void set_unpack_alignment(const int alignment);
+
+        //   (0 -  )
+        static void bind_program(const unsigned int program);
+        static void bind_vertex_array(const unsigned int vertex_array);
+        static void bind_texture_unit(const unsigned int unit, const unsigned int texture);
+        static void bind_framebuffer(const unsigned int framebuffer);
+        static void bind_pixel_unpack_buffer(const unsigned int buffer);
+        static void bind_draw_indirect_buffer(const unsigned int buffer);
+        //    ( ,   -   )
+        static void get_viewport(unsigned int& width, unsigned int& height, unsigned int& left_offset, unsigned int& bottom_offset);
+        //    width x height        (RGBA8,   ).
+        //    -      
+        static void read_pixels(const unsigned int width, const unsigned int height, void* pPixels);
+
+        //  :       (id    )
+        static void on_program_deleted(const unsigned int program);
+        static void on_vertex_array_deleted(const unsigned int vertex_array);
+        static void on_texture_deleted(const unsigned int texture);
+        static void on_framebuffer_deleted(const unsigned int framebuffer);
+        static void on_buffer_deleted(const unsigned int buffer);
+        //   :     
+        static void invalidate_state_cache();
+
+        //     (uniform,  ,  )
+        static void on_uniform_uploaded();
+        static void on_buffer_uploaded(const size_t bytes);
+        static void on_texture_uploaded(const size_t bytes);
+        //  :    
+        static void end_frame();
+        //   age   (0 -  ),    
+        static const FrameStats& get_frame_stats(const size_t age = 0);
+        static size_t get_stats_history_count();
+        //   (    )  CSV   JSON     
+        static bool write_stats_csv(const std::string& path);
+        static bool write_stats_json(const std::string& path);
+        //   
+        static void on_ui_draw();
 
         //    
         static const char* get_vendor_str();
         static const char* get_renderer_str();
         static const char* get_version_str();
+        //     (   glGetStringi)
+        static bool is_extension_supported(const char* name);
     };
 
 }
\ No newline at end of file
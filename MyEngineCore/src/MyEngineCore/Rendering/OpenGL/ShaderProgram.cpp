@@ -1,10 +1,13 @@
 #include "ShaderProgram.hpp"
+#include "Render_OpenGL.hpp"
 
 #include "MyEngineCore/Log.hpp"
 
 #include <glad/glad.h>
 #include <glm/glm/gtc/type_ptr.hpp>
 
+#include <initializer_list>
+
 namespace MyEngine
 {
     // ,     
@@ -26,6 +29,36 @@ namespace MyEngine
         return true;
     }
 
+    //       (    )
+    bool link_program(std::initializer_list<GLuint> shader_ids, GLuint& program_id){
+        program_id = glCreateProgram();
+        for (const GLuint shader_id : shader_ids){
+            glAttachShader(program_id, shader_id);
+        }
+        glLinkProgram(program_id);
+
+        //   
+        GLint success;
+        glGetProgramiv(program_id, GL_LINK_STATUS, &success);
+        //   ,   
+        if (success == GL_FALSE){
+            GLchar info_log[1024];
+            glGetProgramInfoLog(program_id, 1024, nullptr, info_log);
+            LOG_CRITICAL("SHADER PROGRAM: Link-time error:\n{0}", info_log);
+            glDeleteProgram(program_id);
+            program_id = 0;
+        }
+
+        //   
+        for (const GLuint shader_id : shader_ids){
+            if (program_id != 0){
+                glDetachShader(program_id, shader_id);
+            }
+            glDeleteShader(shader_id);
+        }
+        return program_id != 0;
+    }
+
     //   
     ShaderProgram::ShaderProgram(const char* vertex_shader_src, const char* fragment_shader_src){
         GLuint vertex_shader_id = 0;
@@ -44,54 +77,40 @@ namespace MyEngine
             return;
         }
 
-        //   
-        m_id = glCreateProgram();
-        glAttachShader(m_id, vertex_shader_id);
-        glAttachShader(m_id, fragment_shader_id);
-        glLinkProgram(m_id);
+        m_is_compiled = link_program({ vertex_shader_id, fragment_shader_id }, m_id);
+    }
 
-        //   
-        GLint success;
-        glGetProgramiv(m_id, GL_LINK_STATUS, &success);
-        //   ,       
-        if (success == GL_FALSE){
-            GLchar info_log[1024];
-            glGetProgramInfoLog(m_id, 1024, nullptr, info_log);
-            LOG_CRITICAL("SHADER PROGRAM: Link-time error:\n{0}", info_log);
-            glDeleteProgram(m_id);
-            m_id = 0;
-            glDeleteShader(vertex_shader_id);
-            glDeleteShader(fragment_shader_id);
+    //   
+    ShaderProgram::ShaderProgram(const char* compute_shader_src){
+        GLuint compute_shader_id = 0;
+        if (!create_shader(compute_shader_src, GL_COMPUTE_SHADER, compute_shader_id)){
+            LOG_CRITICAL("COMPUTE SHADER: compile-time error!");
+            glDeleteShader(compute_shader_id);
             return;
         }
-        else{
-            m_is_compiled = true;
-        }
 
-        //   
-        glDetachShader(m_id, vertex_shader_id);
-        glDetachShader(m_id, fragment_shader_id);
-        glDeleteShader(vertex_shader_id);
-        glDeleteShader(fragment_shader_id);
+        m_is_compiled = link_program({ compute_shader_id }, m_id);
     }
 
     //   
     ShaderProgram::~ShaderProgram(){
+        Render_OpenGL::on_program_deleted(m_id);
         glDeleteProgram(m_id);
     }
 
     //    
     void ShaderProgram::bind() const{
-        glUseProgram(m_id);
+        Render_OpenGL::bind_program(m_id);
     }
 
     //    
     void ShaderProgram::unbind(){
-        glUseProgram(0);
+        Render_OpenGL::bind_program(0);
     }
 
     //  
     ShaderProgram& ShaderProgram::operator=(ShaderProgram&& shaderProgram){
+        Render_OpenGL::on_program_deleted(m_id);
         glDeleteProgram(m_id);
         m_id = shaderProgram.m_id;
         m_is_compiled = shaderProgram.m_is_compiled;
@@ -112,26 +131,43 @@ namespace MyEngine
 
     //  
     void ShaderProgram::set_matrix4(const char* name, const glm::mat4& matrix) const {
+        Render_OpenGL::on_uniform_uploaded();
         glUniformMatrix4fv(glGetUniformLocation(m_id, name), 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
     //  
     void ShaderProgram::set_matrix3(const char* name, const glm::mat3& matrix) const{
+        Render_OpenGL::on_uniform_uploaded();
         glUniformMatrix3fv(glGetUniformLocation(m_id, name), 1, GL_FALSE, glm::value_ptr(matrix));
     }
 
     //  
     void ShaderProgram::set_int(const char* name, const int value) const {
+        Render_OpenGL::on_uniform_uploaded();
         glUniform1i(glGetUniformLocation(m_id, name), value);
     }
 
     //   
     void ShaderProgram::set_float(const char* name, const float value) const {
+        Render_OpenGL::on_uniform_uploaded();
         glUniform1f(glGetUniformLocation(m_id, name), value);
     }
 
+    //  vector_2
+    void ShaderProgram::set_vec2(const char* name, const glm::vec2& value) const {
+        Render_OpenGL::on_uniform_uploaded();
+        glUniform2f(glGetUniformLocation(m_id, name), value.x, value.y);
+    }
+
     //  
     void ShaderProgram::set_vec3(const char* name, const glm::vec3& value) const {
+        Render_OpenGL::on_uniform_uploaded();
         glUniform3f(glGetUniformLocation(m_id, name), value.x, value.y, value.z);
     }
+
+    //  vector_4
+    void ShaderProgram::set_vec4(const char* name, const glm::vec4& value) const {
+        Render_OpenGL::on_uniform_uploaded();
+        glUniform4f(glGetUniformLocation(m_id, name), value.x, value.y, value.z, value.w);
+    }
 }
\ No newline at end of file
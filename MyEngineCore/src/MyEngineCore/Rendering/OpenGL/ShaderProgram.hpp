@@ -8,6 +8,8 @@ namespace MyEngine {
     public:
         //  ,  ,    
         ShaderProgram(const char* vertex_shader_src, const char* fragment_shader_src);
+        //   ( - Render_OpenGL::dispatch_compute)
+        explicit ShaderProgram(const char* compute_shader_src);
         ShaderProgram(ShaderProgram&&);
         ShaderProgram& operator=(ShaderProgram&&);
         ~ShaderProgram();
@@ -25,9 +27,11 @@ namespace MyEngine {
         void set_matrix3(const char* name, const glm::mat3& matrix) const;
         void set_int(const char* name, const int value) const;
 
-        //  float  vector_3 
+        //  float, vector_2, vector_3  vector_4
         void set_float(const char* name, const float value) const;
+        void set_vec2(const char* name, const glm::vec2& value) const;
         void set_vec3(const char* name, const glm::vec3& value) const;
+        void set_vec4(const char* name, const glm::vec4& value) const;
 
     private:
         //  (   id )
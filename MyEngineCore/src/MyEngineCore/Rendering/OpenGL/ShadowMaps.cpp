@@ -0,0 +1,542 @@
+#include "ShadowMaps.hpp"
+#include "Mesh.hpp"
+#include "Render_OpenGL.hpp"
+
+#include "MyEngineCore/Camera.hpp"
+#include "MyEngineCore/Core/FrameAllocator.hpp"
+#include "MyEngineCore/Core/TransformBatch.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <imgui/imgui.h>
+#include <glad/glad.h>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+#include <glm/trigonometric.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace MyEngine {
+
+    //     (  GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT)
+    constexpr size_t s_storage_alignment = 256;
+    //   :  ,  ,      
+    constexpr size_t s_block_size = 512 * 1024;
+    //       ,  -  :   
+    //  ,    .       
+    constexpr size_t s_max_casters = s_block_size / 2 / sizeof(ObjectMatrices);
+    //     ( - )
+    constexpr float s_split_lambda = 0.75f;
+    //     
+    constexpr float s_point_near = 0.05f;
+    //     
+    constexpr float s_depth_bias_slope = 2.f;
+    constexpr float s_depth_bias_units = 4.f;
+    constexpr size_t s_free_slot = std::numeric_limits<size_t>::max();
+
+    //  :      (model_view   )    
+    static const char* s_depth_vertex_shader =
+        R"(#version 460
+        layout(location = 0) in vec3 vertex_position;
+
+        struct ObjectMatrices {
+            mat4 model_view_matrix;
+            mat4 mvp_matrix;
+            mat3 normal_matrix;
+        };
+        layout(std430, binding = 0) readonly buffer ObjectMatricesBuffer {
+            ObjectMatrices objects[];
+        };
+        layout(std430, binding = 6) readonly buffer ShadowCastersBuffer {
+            uint casters[];
+        };
+        uniform mat4 view_projection_matrix;
+
+        void main() {
+            gl_Position = view_projection_matrix * objects[casters[gl_InstanceID]].model_view_matrix * vec4(vertex_position, 1.0);
+        })";
+
+    static const char* s_depth_fragment_shader =
+        R"(#version 460
+        void main() {
+        })";
+
+    //  : 1 - , 0 -   (    2x2)
+    static const char* s_shadow_source =
+        R"(
+        struct ShadowView {
+            mat4 view_to_shadow;
+            vec4 atlas_rect;
+        };
+        layout(std430, binding = 4) readonly buffer ShadowViewsBuffer {
+            ShadowView shadow_views[];
+        };
+        layout(std430, binding = 5) readonly buffer LightShadowsBuffer {
+            int light_shadows[];
+        };
+        layout(binding = 8) uniform sampler2DShadow shadow_atlas;
+        uniform mat3 shadow_inverse_view_rotation;
+        uniform vec4 cascade_splits;
+        uniform int cascades_count;
+        uniform int shadows_enabled;
+
+        float sample_shadow_view(int view, vec3 position_eye) {
+            ShadowView shadow_view = shadow_views[view];
+            if (shadow_view.atlas_rect.z <= 0.0) {
+                return 1.0;
+            }
+            vec4 shadow_position = shadow_view.view_to_shadow * vec4(position_eye, 1.0);
+            vec3 coord = shadow_position.xyz / shadow_position.w * 0.5 + 0.5;
+            if (any(lessThan(coord.xy, vec2(0.0))) || any(greaterThan(coord.xy, vec2(1.0))) || coord.z > 1.0) {
+                return 1.0;
+            }
+            //       
+            vec2 half_texel = 0.5 / vec2(textureSize(shadow_atlas, 0));
+            vec2 uv = clamp(shadow_view.atlas_rect.xy + coord.xy * shadow_view.atlas_rect.zw, shadow_view.atlas_rect.xy + half_texel,
+                shadow_view.atlas_rect.xy + shadow_view.atlas_rect.zw - half_texel);
+            return texture(shadow_atlas, vec3(uv, coord.z));
+        }
+
+        //    
+        float get_sun_shadow(vec3 position_eye) {
+            if (shadows_enabled == 0) {
+                return 1.0;
+            }
+            float depth = -position_eye.z;
+            for (int i = 0; i < cascades_count; ++i) {
+                if (depth < cascade_splits[i]) {
+                    return sample_shadow_view(i, position_eye);
+                }
+            }
+            return 1.0;
+        }
+
+        //          
+        float get_point_shadow(uint light, vec3 position_eye, vec3 light_position_eye) {
+            if (shadows_enabled == 0) {
+                return 1.0;
+            }
+            int first_view = light_shadows[light];
+            if (first_view < 0) {
+                return 1.0;
+            }
+            vec3 direction = shadow_inverse_view_rotation * (position_eye - light_position_eye);
+            vec3 axis = abs(direction);
+            int face = axis.x >= axis.y && axis.x >= axis.z ? (direction.x >= 0.0 ? 0 : 1)
+                : axis.y >= axis.z ? (direction.y >= 0.0 ? 2 : 3) : (direction.z >= 0.0 ? 4 : 5);
+            return sample_shadow_view(first_view + face, position_eye);
+        }
+        )";
+
+    //     : +X, -X, +Y, -Y, +Z, -Z
+    static const glm::vec3 s_face_directions[6] = {
+        glm::vec3(1.f, 0.f, 0.f), glm::vec3(-1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f),
+        glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 0.f, 1.f), glm::vec3(0.f, 0.f, -1.f)
+    };
+    static const glm::vec3 s_face_ups[6] = {
+        glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 0.f, 1.f),
+        glm::vec3(0.f, 0.f, -1.f), glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, -1.f, 0.f)
+    };
+
+    // FNV-1a
+    static uint64_t hash_bytes(uint64_t hash, const void* data, const size_t size) {
+        const unsigned char* pBytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ pBytes[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    const char* ShadowMaps::get_shader_source() {
+        return s_shadow_source;
+    }
+
+    ShadowMaps::ShadowMaps()
+        : m_atlas(s_atlas_size, s_atlas_size, {}, ERenderTargetFormat::Depth32F),
+        m_depth_program(s_depth_vertex_shader, s_depth_fragment_shader),
+        m_staging_buffer(s_block_size * StagingBuffer::s_blocks_count) {
+        m_atlas.set_depth_compare(true);
+        m_slot_lights.fill(s_free_slot);
+
+        //  -  2x2   ,  -   
+        constexpr unsigned int cascades_per_row = 2;
+        for (size_t c = 0; c < s_cascades_count; ++c) {
+            m_views[c].x = static_cast<unsigned int>(c % cascades_per_row) * s_cascade_size;
+            m_views[c].y = static_cast<unsigned int>(c / cascades_per_row) * s_cascade_size;
+            m_views[c].size = s_cascade_size;
+        }
+        constexpr unsigned int tiles_per_row = s_atlas_size / s_tile_size;
+        constexpr unsigned int cascade_tiles = cascades_per_row * s_cascade_size / s_tile_size;
+        size_t view = s_cascades_count;
+        for (unsigned int tile_y = 0; tile_y < tiles_per_row && view < s_views_count; ++tile_y) {
+            for (unsigned int tile_x = 0; tile_x < tiles_per_row && view < s_views_count; ++tile_x) {
+                if (tile_x < cascade_tiles && tile_y < cascade_tiles) {
+                    continue;
+                }
+                m_views[view].x = tile_x * s_tile_size;
+                m_views[view].y = tile_y * s_tile_size;
+                m_views[view].size = s_tile_size;
+                ++view;
+            }
+        }
+        static_assert(s_point_slots_count * 6 <= (s_atlas_size / s_tile_size) * (s_atlas_size / s_tile_size) -
+            (2 * s_cascade_size / s_tile_size) * (2 * s_cascade_size / s_tile_size), "Shadow views do not fit the atlas");
+    }
+
+    bool ShadowMaps::is_ready() const {
+        return m_atlas.is_complete() && m_depth_program.is_compiled();
+    }
+
+    // :    split_near  split_far    (   ):    
+    //     .         (  ), 
+    //    ,           
+    void ShadowMaps::update_cascades(const glm::mat4& projection, const float near, const float far, const DirectionalLight& sun) {
+        const glm::vec3 direction = glm::normalize(sun.direction);
+        const glm::vec3 up = std::abs(direction.z) > 0.99f ? glm::vec3(0.f, 1.f, 0.f) : glm::vec3(0.f, 0.f, 1.f);
+        const glm::mat3 light_rotation(glm::lookAt(glm::vec3(0.f), direction, up));
+        const glm::mat3 inverse_light_rotation = glm::transpose(light_rotation);
+
+        const float shadow_far = std::min(far, s_max_shadow_distance);
+        //     
+        const float diagonal_squared = 1.f / (projection[0][0] * projection[0][0]) + 1.f / (projection[1][1] * projection[1][1]);
+        float split_near = near;
+        for (size_t c = 0; c < s_cascades_count; ++c) {
+            const float t = static_cast<float>(c + 1) / s_cascades_count;
+            const float split_far = s_split_lambda * near * std::pow(shadow_far / near, t) + (1.f - s_split_lambda) * (near + (shadow_far - near) * t);
+            m_cascade_splits[static_cast<int>(c)] = split_far;
+
+            // ,        (   )
+            const float center_depth = std::min((split_near + split_far) * (1.f + diagonal_squared) * 0.5f, split_far);
+            const float radius = std::ceil(std::sqrt((split_far - center_depth) * (split_far - center_depth) +
+                diagonal_squared * split_far * split_far) * 16.f) / 16.f;
+            split_near = split_far;
+
+            const float texel_size = 2.f * radius / s_cascade_size;
+            glm::vec3 light_center = light_rotation * glm::vec3(m_inverse_view * glm::vec4(0.f, 0.f, -center_depth, 1.f));
+            light_center.x = std::floor(light_center.x / texel_size) * texel_size;
+            light_center.y = std::floor(light_center.y / texel_size) * texel_size;
+            light_center.z = std::floor(light_center.z / texel_size) * texel_size;
+            const glm::vec3 center = inverse_light_rotation * light_center;
+
+            const glm::mat4 light_view = glm::lookAt(center - direction * (radius + s_caster_margin), center, up);
+            const glm::mat4 light_projection = glm::ortho(-radius, radius, -radius, radius, 0.f, 2.f * radius + s_caster_margin);
+            ShadowView& shadow_view = m_views[c];
+            shadow_view.view_projection = light_projection * light_view;
+            shadow_view.active = sun.intensity > 0.f;
+            //   ,  - 
+            shadow_view.priority = 1.f + static_cast<float>(s_cascades_count - c);
+        }
+    }
+
+    //  :       (   -  )
+    void ShadowMaps::update_point_slots(const glm::mat4& view, const glm::mat4& projection, const float near, const PointLight* pLights,
+        const size_t lights_count) {
+        m_light_coverages.resize(lights_count);
+        m_light_order.clear();
+        for (size_t i = 0; i < lights_count; ++i) {
+            const glm::vec3 position = glm::vec3(view * glm::vec4(pLights[i].position, 1.f));
+            const float radius = pLights[i].radius;
+            const float depth = -position.z;
+            float coverage = 0.f;
+            if (glm::dot(position, position) <= radius * radius) {
+                coverage = 1.f;
+            }
+            else if (depth + radius > near) {
+                const float clamped_depth = std::max(depth, near);
+                const float radius_x = radius * projection[0][0] / clamped_depth;
+                const float radius_y = radius * projection[1][1] / clamped_depth;
+                const float center_x = position.x * projection[0][0] / clamped_depth;
+                const float center_y = position.y * projection[1][1] / clamped_depth;
+                if (std::abs(center_x) - radius_x < 1.f && std::abs(center_y) - radius_y < 1.f) {
+                    coverage = std::min(3.14159265f * radius_x * radius_y * 0.25f, 1.f);
+                }
+            }
+            m_light_coverages[i] = coverage;
+            if (coverage > 0.f) {
+                m_light_order.push_back(i);
+            }
+        }
+        const size_t candidates_count = std::min(m_light_order.size(), s_point_slots_count);
+        std::partial_sort(m_light_order.begin(), m_light_order.begin() + candidates_count, m_light_order.end(), [this](const size_t a, const size_t b) {
+            return m_light_coverages[a] > m_light_coverages[b] || (m_light_coverages[a] == m_light_coverages[b] && a < b);
+        });
+        const auto is_candidate = [&](const size_t light) {
+            return std::find(m_light_order.begin(), m_light_order.begin() + candidates_count, light) != m_light_order.begin() + candidates_count;
+        };
+        const auto reset_slot = [this](const size_t slot, const size_t light) {
+            m_slot_lights[slot] = light;
+            for (size_t face = 0; face < 6; ++face) {
+                ShadowView& shadow_view = m_views[s_cascades_count + slot * 6 + face];
+                shadow_view.rendered = false;
+                shadow_view.rendered_signature = 0;
+            }
+        };
+
+        //   ,    ;    
+        for (size_t slot = 0; slot < s_point_slots_count; ++slot) {
+            if (m_slot_lights[slot] != s_free_slot && (m_slot_lights[slot] >= lights_count || !is_candidate(m_slot_lights[slot]))) {
+                reset_slot(slot, s_free_slot);
+            }
+        }
+        for (size_t i = 0; i < candidates_count; ++i) {
+            const size_t light = m_light_order[i];
+            if (std::find(m_slot_lights.begin(), m_slot_lights.end(), light) != m_slot_lights.end()) {
+                continue;
+            }
+            const auto free_slot = std::find(m_slot_lights.begin(), m_slot_lights.end(), s_free_slot);
+            reset_slot(static_cast<size_t>(free_slot - m_slot_lights.begin()), light);
+        }
+
+        for (size_t slot = 0; slot < s_point_slots_count; ++slot) {
+            const size_t light = m_slot_lights[slot];
+            m_slot_coverages[slot] = light == s_free_slot ? 0.f : m_light_coverages[light];
+            for (size_t face = 0; face < 6; ++face) {
+                ShadowView& shadow_view = m_views[s_cascades_count + slot * 6 + face];
+                shadow_view.active = light != s_free_slot;
+                if (!shadow_view.active) {
+                    continue;
+                }
+                const PointLight& point_light = pLights[light];
+                const glm::mat4 face_projection = glm::perspective(glm::radians(90.f), 1.f, s_point_near, std::max(point_light.radius, 2.f * s_point_near));
+                shadow_view.view_projection = face_projection *
+                    glm::lookAt(point_light.position, point_light.position + s_face_directions[face], s_face_ups[face]);
+                shadow_view.priority = m_slot_coverages[slot];
+            }
+        }
+    }
+
+    //       (  -)
+    void ShadowMaps::cull_casters(const glm::mat4& view_projection) {
+        const std::array<glm::vec4, 6> planes = Camera::get_frustum_planes(view_projection);
+
+        m_visible_casters.clear();
+        for (size_t i = 0; i < m_caster_spheres.size(); ++i) {
+            const glm::vec4& sphere = m_caster_spheres[i];
+            bool visible = true;
+            for (const glm::vec4& plane : planes) {
+                if (plane.x * sphere.x + plane.y * sphere.y + plane.z * sphere.z + plane.w < -sphere.w) {
+                    visible = false;
+                    break;
+                }
+            }
+            if (visible) {
+                m_visible_casters.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+
+    // :         -      ,   
+    // (    cull_casters   )
+    uint64_t ShadowMaps::get_signature(const glm::mat4& view_projection, const TransformsSoA& casters) const {
+        uint64_t hash = hash_bytes(14695981039346656037ull, &view_projection, sizeof(view_projection));
+        for (const uint32_t caster : m_visible_casters) {
+            const float transform[] = {
+                casters.position_x[caster], casters.position_y[caster], casters.position_z[caster],
+                casters.rotation_x[caster], casters.rotation_y[caster], casters.rotation_z[caster], casters.rotation_w[caster],
+                casters.scale_x[caster], casters.scale_y[caster], casters.scale_z[caster]
+            };
+            hash = hash_bytes(hash, &caster, sizeof(caster));
+            hash = hash_bytes(hash, transform, sizeof(transform));
+        }
+        // 0     
+        return hash ? hash : 1;
+    }
+
+    void ShadowMaps::update(const glm::mat4& view, const glm::mat4& projection, const float near, const float far, const DirectionalLight& sun,
+        const PointLight* pLights, const size_t lights_count, const TransformsSoA& casters, const Mesh* pCasterMesh, const size_t max_updates,
+        const bool enabled) {
+        const auto start_time = std::chrono::steady_clock::now();
+        m_stats.active_views_count = 0;
+        m_stats.dirty_views_count = 0;
+        m_stats.updated_views_count = 0;
+        m_stats.drawn_casters_count = 0;
+        m_enabled = enabled && pCasterMesh && is_ready();
+        if (!m_enabled) {
+            m_views_size = m_light_shadows_size = 0;
+            return;
+        }
+        m_inverse_view = glm::inverse(view);
+        m_inverse_view_rotation = glm::mat3(m_inverse_view);
+
+        const size_t casters_count = std::min(casters.size(), s_max_casters);
+        if (casters_count < casters.size() && !m_casters_limit_reported) {
+            LOG_CATEGORY_ERROR(Render, "ShadowMaps: {0} casters do not fit the staging block, only the first {1} cast shadows",
+                casters.size(), casters_count);
+            m_casters_limit_reported = true;
+        }
+
+        //  :      ,    
+        const MeshBounds& bounds = pCasterMesh->get_bounds();
+        m_caster_spheres.resize(casters_count);
+        for (size_t i = 0; i < casters_count; ++i) {
+            const glm::vec3 scale(casters.scale_x[i], casters.scale_y[i], casters.scale_z[i]);
+            const glm::vec3 offset = glm::vec3(bounds.center[0], bounds.center[1], bounds.center[2]) * scale;
+            //  : v + 2 * q x (q x v + w * v)
+            const glm::vec3 q(casters.rotation_x[i], casters.rotation_y[i], casters.rotation_z[i]);
+            const glm::vec3 rotated = offset + 2.f * glm::cross(q, glm::cross(q, offset) + casters.rotation_w[i] * offset);
+            const glm::vec3 center = glm::vec3(casters.position_x[i], casters.position_y[i], casters.position_z[i]) + rotated;
+            m_caster_spheres[i] = glm::vec4(center, bounds.radius * std::max(std::abs(scale.x), std::max(std::abs(scale.y), std::abs(scale.z))));
+        }
+
+        update_cascades(projection, near, far, sun);
+        update_point_slots(view, projection, near, pLights, lights_count);
+
+        //     
+        FrameVector<size_t> dirty_views(FrameAllocator::get_resource());
+        for (size_t i = 0; i < s_views_count; ++i) {
+            ShadowView& shadow_view = m_views[i];
+            if (!shadow_view.active) {
+                continue;
+            }
+            ++m_stats.active_views_count;
+            cull_casters(shadow_view.view_projection);
+            shadow_view.signature = get_signature(shadow_view.view_projection, casters);
+            if (!shadow_view.rendered || shadow_view.signature != shadow_view.rendered_signature) {
+                dirty_views.push_back(i);
+            }
+        }
+        std::stable_sort(dirty_views.begin(), dirty_views.end(), [this](const size_t a, const size_t b) {
+            return m_views[a].priority > m_views[b].priority;
+        });
+        m_stats.dirty_views_count = dirty_views.size();
+
+        const size_t updates_count = std::min(dirty_views.size(), max_updates);
+        if (updates_count > 0) {
+            //      ( : model_view -  )
+            m_matrices_size = std::max<size_t>(casters_count, 1) * sizeof(ObjectMatrices);
+            ObjectMatrices* pMatrices = static_cast<ObjectMatrices*>(m_staging_buffer.allocate(m_matrices_size, s_storage_alignment, m_matrices_offset));
+            if (pMatrices) {
+                if (casters_count == casters.size()) {
+                    TransformBatch::calculate(casters, glm::mat4(1.f), glm::mat4(1.f), pMatrices);
+                }
+                else {
+                    TransformBatch::calculate_range(casters, glm::mat4(1.f), glm::mat4(1.f), pMatrices, 0, casters_count, TransformBatch::get_kernel());
+                }
+                Render_OpenGL::bind_storage_buffer(0, m_staging_buffer.get_handle(), m_matrices_offset, m_matrices_size);
+
+                unsigned int viewport_width = 0, viewport_height = 0, viewport_left = 0, viewport_bottom = 0;
+                Render_OpenGL::get_viewport(viewport_width, viewport_height, viewport_left, viewport_bottom);
+                m_atlas.bind();
+                m_depth_program.bind();
+                Render_OpenGL::set_face_culling(ECullFace::None);
+                Render_OpenGL::set_depth_bias(s_depth_bias_slope, s_depth_bias_units);
+                for (size_t i = 0; i < updates_count; ++i) {
+                    render_view(m_views[dirty_views[i]], *pCasterMesh);
+                }
+                Render_OpenGL::set_depth_bias(0.f, 0.f);
+                Framebuffer::unbind();
+                Render_OpenGL::set_viewport(viewport_width, viewport_height, viewport_left, viewport_bottom);
+            }
+        }
+
+        write_shading_data(lights_count);
+        m_stats.update_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    }
+
+    //        instanced 
+    void ShadowMaps::render_view(ShadowView& shadow_view, const Mesh& caster_mesh) {
+        cull_casters(shadow_view.view_projection);
+        Render_OpenGL::set_viewport(shadow_view.size, shadow_view.size, shadow_view.x, shadow_view.y);
+        m_atlas.clear_depth_region(shadow_view.x, shadow_view.y, shadow_view.size, shadow_view.size);
+        if (!m_visible_casters.empty()) {
+            const size_t casters_size = m_visible_casters.size() * sizeof(uint32_t);
+            size_t casters_offset = 0;
+            void* pCasters = m_staging_buffer.allocate(casters_size, s_storage_alignment, casters_offset);
+            if (!pCasters) {
+                return;
+            }
+            std::memcpy(pCasters, m_visible_casters.data(), casters_size);
+            Render_OpenGL::bind_storage_buffer(s_casters_binding, m_staging_buffer.get_handle(), casters_offset, casters_size);
+            m_depth_program.set_matrix4("view_projection_matrix", shadow_view.view_projection);
+            Render_OpenGL::draw_instanced(caster_mesh.get_vertex_array(), m_visible_casters.size());
+            m_stats.drawn_casters_count += m_visible_casters.size();
+        }
+        shadow_view.rendered_view_projection = shadow_view.view_projection;
+        shadow_view.rendered_signature = shadow_view.signature;
+        shadow_view.rendered = true;
+        ++m_stats.updated_views_count;
+        ++m_stats.total_updates_count;
+    }
+
+    //    ,    :    ,    
+    void ShadowMaps::write_shading_data(const size_t lights_count) {
+        m_views_size = s_views_count * sizeof(GpuShadowView);
+        m_light_shadows_size = std::max<size_t>(lights_count, 1) * sizeof(int32_t);
+        GpuShadowView* pViews = static_cast<GpuShadowView*>(m_staging_buffer.allocate(m_views_size, s_storage_alignment, m_views_offset));
+        int32_t* pLightShadows = static_cast<int32_t*>(m_staging_buffer.allocate(m_light_shadows_size, s_storage_alignment, m_light_shadows_offset));
+        if (!pViews || !pLightShadows) {
+            m_views_size = m_light_shadows_size = 0;
+            return;
+        }
+
+        const float inverse_atlas_size = 1.f / s_atlas_size;
+        for (size_t i = 0; i < s_views_count; ++i) {
+            const ShadowView& shadow_view = m_views[i];
+            GpuShadowView gpu_view{ glm::mat4(1.f), glm::vec4(0.f) };
+            if (shadow_view.active && shadow_view.rendered) {
+                gpu_view.view_to_shadow = shadow_view.rendered_view_projection * m_inverse_view;
+                gpu_view.atlas_rect = glm::vec4(static_cast<float>(shadow_view.x), static_cast<float>(shadow_view.y),
+                    static_cast<float>(shadow_view.size), static_cast<float>(shadow_view.size)) * inverse_atlas_size;
+            }
+            std::memcpy(&pViews[i], &gpu_view, sizeof(GpuShadowView));
+        }
+
+        std::fill(pLightShadows, pLightShadows + std::max<size_t>(lights_count, 1), -1);
+        for (size_t slot = 0; slot < s_point_slots_count; ++slot) {
+            if (m_slot_lights[slot] < lights_count) {
+                pLightShadows[m_slot_lights[slot]] = static_cast<int32_t>(s_cascades_count + slot * 6);
+            }
+        }
+    }
+
+    void ShadowMaps::bind(const ShaderProgram& shader_program) const {
+        const bool enabled = m_enabled && m_views_size != 0 && m_light_shadows_size != 0;
+        shader_program.set_int("shadows_enabled", enabled ? 1 : 0);
+        if (!enabled) {
+            return;
+        }
+        shader_program.set_matrix3("shadow_inverse_view_rotation", m_inverse_view_rotation);
+        shader_program.set_vec4("cascade_splits", m_cascade_splits);
+        shader_program.set_int("cascades_count", static_cast<int>(s_cascades_count));
+        m_atlas.bind_depth_texture(s_atlas_unit);
+        Render_OpenGL::bind_storage_buffer(s_views_binding, m_staging_buffer.get_handle(), m_views_offset, m_views_size);
+        Render_OpenGL::bind_storage_buffer(s_light_shadows_binding, m_staging_buffer.get_handle(), m_light_shadows_offset, m_light_shadows_size);
+    }
+
+    void ShadowMaps::end_frame() {
+        m_staging_buffer.flush();
+    }
+
+    void ShadowMaps::on_ui_draw() {
+        ImGui::Begin("Shadows");
+        ImGui::Text("Atlas: %ux%u, %zu KB", m_atlas.get_width(), m_atlas.get_height(), m_atlas.get_memory_size() / 1024);
+        ImGui::Text("Cascades: %.1f / %.1f / %.1f / %.1f", m_cascade_splits.x, m_cascade_splits.y, m_cascade_splits.z, m_cascade_splits.w);
+        ImGui::Text("Views: %zu active, %zu dirty, %zu updated", m_stats.active_views_count, m_stats.dirty_views_count, m_stats.updated_views_count);
+        ImGui::Text("Casters drawn: %zu", m_stats.drawn_casters_count);
+        ImGui::Text("Total updates: %zu", m_stats.total_updates_count);
+        ImGui::Text("Update: %.3f ms", m_stats.update_ms);
+        if (ImGui::BeginTable("shadow_slots", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Light");
+            ImGui::TableSetupColumn("Coverage");
+            ImGui::TableHeadersRow();
+            for (size_t slot = 0; slot < s_point_slots_count; ++slot) {
+                if (m_slot_lights[slot] == s_free_slot) {
+                    continue;
+                }
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", m_slot_lights[slot]);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", m_slot_coverages[slot]);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+#include "ShaderProgram.hpp"
+#include "StagingBuffer.hpp"
+#include "LightClusters.hpp"
+
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MyEngine {
+
+    class Mesh;
+    struct TransformsSoA;
+
+    //        (Depth32F,    ).
+    //   -      (  ,  
+    //     :       ).
+    //   - 6   90 ,   s_point_slots_count   
+    //      (   ,    ).
+    //    :  -      .  ,
+    //    ,         ( : , 
+    //    ).    ,        .
+    //     instanced      ,  
+    class ShadowMaps {
+    public:
+        // :  s_cascade_size    ,  -   s_tile_size
+        static constexpr unsigned int s_atlas_size = 2048;
+        static constexpr unsigned int s_cascade_size = 512;
+        static constexpr unsigned int s_tile_size = 256;
+        static constexpr size_t s_cascades_count = 4;
+        static constexpr size_t s_point_slots_count = 8;
+        static constexpr size_t s_views_count = s_cascades_count + s_point_slots_count * 6;
+        //             
+        static constexpr float s_max_shadow_distance = 40.f;
+        static constexpr float s_caster_margin = 20.f;
+        //  :      ,     , 
+        static constexpr unsigned int s_views_binding = 4;
+        static constexpr unsigned int s_light_shadows_binding = 5;
+        static constexpr unsigned int s_casters_binding = 6;
+        static constexpr unsigned int s_atlas_unit = 8;
+
+        //   
+        struct Stats {
+            size_t active_views_count = 0;
+            size_t dirty_views_count = 0;
+            size_t updated_views_count = 0;
+            size_t drawn_casters_count = 0;
+            size_t total_updates_count = 0;
+            double update_ms = 0.0;
+        };
+
+        ShadowMaps();
+
+        //      
+        ShadowMaps(const ShadowMaps&) = delete;
+        ShadowMaps& operator=(const ShadowMaps&) = delete;
+        ShadowMaps& operator=(ShadowMaps&&) = delete;
+        ShadowMaps(ShadowMaps&&) = delete;
+
+        //    
+        bool is_ready() const;
+
+        //  ,       max_updates  .
+        //  -  casters   pCasterMesh.      .
+        // enabled == false     -   ( )
+        void update(const glm::mat4& view, const glm::mat4& projection, const float near, const float far, const DirectionalLight& sun,
+            const PointLight* pLights, const size_t lights_count, const TransformsSoA& casters, const Mesh* pCasterMesh,
+            const size_t max_updates, const bool enabled);
+        //  ,        (   )
+        void bind(const ShaderProgram& shader_program) const;
+        //  :    fence
+        void end_frame();
+
+        //       ( #version,    ):
+        // get_sun_shadow(   )  get_point_shadow( , ,  )
+        static const char* get_shader_source();
+
+        const Stats& get_stats() const { return m_stats; }
+        const Framebuffer& get_atlas() const { return m_atlas; }
+
+        //  
+        void on_ui_draw();
+
+    private:
+        //    (    )
+        struct ShadowView {
+            //      ,    
+            glm::mat4 view_projection{ 1.f };
+            glm::mat4 rendered_view_projection{ 1.f };
+            //    ()
+            unsigned int x = 0, y = 0, size = 0;
+            uint64_t signature = 0;
+            uint64_t rendered_signature = 0;
+            float priority = 0.f;
+            bool active = false;
+            bool rendered = false;
+        };
+
+        //    GPU (std430):       ,   (0 -  )
+        struct GpuShadowView {
+            glm::mat4 view_to_shadow;
+            glm::vec4 atlas_rect;
+        };
+
+        //     
+        void update_cascades(const glm::mat4& projection, const float near, const float far, const DirectionalLight& sun);
+        void update_point_slots(const glm::mat4& view, const glm::mat4& projection, const float near, const PointLight* pLights,
+            const size_t lights_count);
+        //     (  m_visible_casters)   
+        void cull_casters(const glm::mat4& view_projection);
+        uint64_t get_signature(const glm::mat4& view_projection, const TransformsSoA& casters) const;
+        //  
+        void render_view(ShadowView& shadow_view, const Mesh& caster_mesh);
+        //       
+        void write_shading_data(const size_t lights_count);
+
+        Framebuffer m_atlas;
+        ShaderProgram m_depth_program;
+        StagingBuffer m_staging_buffer;
+        std::array<ShadowView, s_views_count> m_views;
+
+        //     (SIZE_MAX - )     
+        std::array<size_t, s_point_slots_count> m_slot_lights;
+        std::array<float, s_point_slots_count> m_slot_coverages{};
+        //      
+        glm::vec4 m_cascade_splits{ 0.f };
+        glm::mat4 m_inverse_view{ 1.f };
+        glm::mat3 m_inverse_view_rotation{ 1.f };
+
+        //     (  )     
+        std::vector<glm::vec4> m_caster_spheres;
+        std::vector<uint32_t> m_visible_casters;
+        //        ( )
+        std::vector<float> m_light_coverages;
+        std::vector<size_t> m_light_order;
+
+        //      (0  -  )
+        size_t m_matrices_offset = 0;
+        size_t m_matrices_size = 0;
+        size_t m_views_offset = 0;
+        size_t m_views_size = 0;
+        size_t m_light_shadows_offset = 0;
+        size_t m_light_shadows_size = 0;
+        bool m_enabled = false;
+        //  ,      (   )
+        bool m_casters_limit_reported = false;
+
+        Stats m_stats;
+    };
+
+}
\ No newline at end of file
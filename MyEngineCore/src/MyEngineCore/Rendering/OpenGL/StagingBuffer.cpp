@@ -0,0 +1,103 @@
+#include "StagingBuffer.hpp"
+#include "GpuMemoryTracker.hpp"
+#include "Render_OpenGL.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <glad/glad.h>
+
+namespace MyEngine {
+
+    // :  ,       
+    StagingBuffer::StagingBuffer(const size_t size) : m_block_size(size / s_blocks_count) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_id);
+        glNamedBufferStorage(m_id, m_block_size * s_blocks_count, nullptr, flags);
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::Staging, m_block_size * s_blocks_count);
+        m_pMapped = static_cast<unsigned char*>(glMapNamedBufferRange(m_id, 0, m_block_size * s_blocks_count, flags));
+        if (!m_pMapped) {
+            LOG_ERROR("StagingBuffer: failed to map {0} bytes", m_block_size * s_blocks_count);
+        }
+    }
+
+    // 
+    StagingBuffer::~StagingBuffer() {
+        for (void*& fence : m_fences) {
+            if (fence) {
+                glDeleteSync(static_cast<GLsync>(fence));
+                fence = nullptr;
+            }
+        }
+        if (m_pMapped) {
+            glUnmapNamedBuffer(m_id);
+        }
+        Render_OpenGL::on_buffer_deleted(m_id);
+        glDeleteBuffers(1, &m_id);
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::Staging, m_block_size * s_blocks_count);
+    }
+
+    // ,  GPU   
+    void StagingBuffer::wait_block(const size_t block) {
+        GLsync fence = static_cast<GLsync>(m_fences[block]);
+        if (!fence) {
+            return;
+        }
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        }
+        glDeleteSync(fence);
+        m_fences[block] = nullptr;
+    }
+
+    //     
+    void* StagingBuffer::allocate(const size_t size, const size_t alignment, size_t& offset) {
+        if (!m_pMapped || size > m_block_size) {
+            LOG_ERROR("StagingBuffer: allocation of {0} bytes does not fit block of {1} bytes", size, m_block_size);
+            return nullptr;
+        }
+        size_t aligned_used = (m_block_used + alignment - 1) / alignment * alignment;
+        if (aligned_used + size > m_block_size) {
+            flush();
+            aligned_used = 0;
+        }
+        //    : ,  GPU  
+        if (aligned_used == 0) {
+            wait_block(m_current_block);
+        }
+        offset = m_current_block * m_block_size + aligned_used;
+        m_block_used = aligned_used + size;
+        Render_OpenGL::on_buffer_uploaded(size);
+        return m_pMapped + offset;
+    }
+
+    //   
+    void StagingBuffer::flush() {
+        if (m_block_used == 0) {
+            return;
+        }
+        m_fences[m_current_block] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_current_block = (m_current_block + 1) % s_blocks_count;
+        m_block_used = 0;
+    }
+
+    //     GPU     
+    void StagingBuffer::upload(const unsigned int dst_buffer, const size_t dst_offset, const void* data, const size_t size) {
+        const unsigned char* src = static_cast<const unsigned char*>(data);
+        size_t uploaded = 0;
+        while (uploaded < size) {
+            const size_t chunk = std::min(m_block_size, size - uploaded);
+            size_t staging_offset = 0;
+            void* dst = allocate(chunk, 16, staging_offset);
+            if (!dst) {
+                return;
+            }
+            std::memcpy(dst, src + uploaded, chunk);
+            glCopyNamedBufferSubData(m_id, dst_buffer, staging_offset, dst_offset + uploaded, chunk);
+            uploaded += chunk;
+        }
+        flush();
+    }
+}
\ No newline at end of file
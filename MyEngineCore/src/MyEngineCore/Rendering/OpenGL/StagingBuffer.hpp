@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace MyEngine {
+
+    //   (persistent mapped)      GPU.
+    //    ,     fence:  GPU  , CPU   
+    class StagingBuffer {
+    public:
+        //    
+        static constexpr size_t s_blocks_count = 4;
+
+        //  (  )  
+        explicit StagingBuffer(const size_t size);
+        ~StagingBuffer();
+
+        //      
+        StagingBuffer(const StagingBuffer&) = delete;
+        StagingBuffer& operator=(const StagingBuffer&) = delete;
+        StagingBuffer& operator=(StagingBuffer&&) = delete;
+        StagingBuffer(StagingBuffer&&) = delete;
+
+        //      (size    ), offset -   
+        void* allocate(const size_t size, const size_t alignment, size_t& offset);
+        //   :  fence    
+        void flush();
+
+        //     GPU   
+        void upload(const unsigned int dst_buffer, const size_t dst_offset, const void* data, const size_t size);
+
+        unsigned int get_handle() const { return m_id; }
+        size_t get_block_size() const { return m_block_size; }
+
+    private:
+        //    GPU
+        void wait_block(const size_t block);
+
+        // id ,    ,  
+        unsigned int m_id = 0;
+        unsigned char* m_pMapped = nullptr;
+        size_t m_block_size = 0;
+
+        //  ,    fence  
+        size_t m_current_block = 0;
+        size_t m_block_used = 0;
+        std::array<void*, s_blocks_count> m_fences{};
+    };
+
+}
\ No newline at end of file
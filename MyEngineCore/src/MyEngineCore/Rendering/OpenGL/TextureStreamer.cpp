@@ -0,0 +1,235 @@
+#include "TextureStreamer.hpp"
+#include "GpuMemoryTracker.hpp"
+#include "Render_OpenGL.hpp"
+
+#include "MyEngineCore/Camera.hpp"
+#include "MyEngineCore/Core/FrameAllocator.hpp"
+#include "MyEngineCore/Log.hpp"
+#include "MyEngineCore/Resources/TextureFile.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <glad/glad.h>
+
+namespace MyEngine {
+
+    //   
+    constexpr size_t s_ring_alignment = 64;
+
+    // :  PBO   
+    TextureStreamer::TextureStreamer(const size_t ring_size)
+        : m_ring_allocator(ring_size, s_ring_alignment), m_ring_size(m_ring_allocator.get_size()) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &m_ring_id);
+        glNamedBufferStorage(m_ring_id, m_ring_size, nullptr, flags);
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::Staging, m_ring_size);
+        m_pRing = static_cast<unsigned char*>(glMapNamedBufferRange(m_ring_id, 0, m_ring_size, flags));
+        if (!m_pRing) {
+            LOG_ERROR("TextureStreamer: failed to map {0} bytes", m_ring_size);
+        }
+        m_stats.ring_size = m_ring_size;
+    }
+
+    // :     (   ),  fence  
+    TextureStreamer::~TextureStreamer() {
+        m_stop.store(true, std::memory_order_relaxed);
+        for (Request* request : m_requests) {
+            JobSystem::wait(request->job);
+        }
+        for (Request* request : m_requests) {
+            if (request->fence) {
+                glDeleteSync(static_cast<GLsync>(request->fence));
+            }
+            m_request_pool.destroy(request);
+        }
+        if (m_pRing) {
+            glUnmapNamedBuffer(m_ring_id);
+        }
+        Render_OpenGL::on_buffer_deleted(m_ring_id);
+        glDeleteBuffers(1, &m_ring_id);
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::Staging, m_ring_size);
+    }
+
+    //       .       
+    void TextureStreamer::decode(const StreamedTexture& texture, Request& request) {
+        const bool decoded = !m_stop.load(std::memory_order_relaxed) &&
+            texture.provider(request.level, m_pRing + request.ring_offset, request.data_size);
+        request.state.store(decoded ? ERequestState::Decoded : ERequestState::Failed, std::memory_order_release);
+    }
+
+    //  
+    size_t TextureStreamer::add_texture(const unsigned int width, const unsigned int height, const ETextureFormat format, const unsigned int mips_count,
+        MipProvider provider, const unsigned int resident_size) {
+        auto streamed_texture = std::make_unique<StreamedTexture>();
+        streamed_texture->texture = std::make_unique<Texture2D>(width, height, format, mips_count);
+        streamed_texture->provider = std::move(provider);
+        const unsigned int levels_count = streamed_texture->texture->get_mips_count();
+
+        //    ,        
+        unsigned int resident_level = levels_count - 1;
+        while (resident_level > 0 && std::max(width >> (resident_level - 1), height >> (resident_level - 1)) <= resident_size) {
+            --resident_level;
+        }
+        //      :    -  
+        std::vector<unsigned char> data;
+        for (unsigned int level = levels_count; level-- > resident_level;) {
+            data.resize(calculate_mip_size(format, std::max(width >> level, 1u), std::max(height >> level, 1u)));
+            if (!streamed_texture->provider(level, data.data(), data.size())) {
+                LOG_ERROR("TextureStreamer: failed to prepare resident mip {0} of {1}x{2} texture", level, width, height);
+                return s_invalid_texture;
+            }
+            streamed_texture->texture->set_mip_data(level, data.data(), data.size());
+        }
+        streamed_texture->resident_level = resident_level;
+        streamed_texture->texture->set_base_level(resident_level);
+
+        m_textures.push_back(std::move(streamed_texture));
+        m_stats.textures_count = m_textures.size();
+        return m_textures.size() - 1;
+    }
+
+    //    :      (    )
+    size_t TextureStreamer::add_texture(std::shared_ptr<TextureFile> texture_file, const unsigned int resident_size) {
+        const TextureFileHeader& header = texture_file->get_header();
+        const unsigned int width = header.width;
+        const unsigned int height = header.height;
+        const ETextureFormat format = texture_file->get_format();
+        const unsigned int mips_count = header.mips_count;
+        return add_texture(width, height, format, mips_count,
+            [texture_file](const unsigned int level, unsigned char* destination, const size_t size) {
+                if (texture_file->get_mip(level).data_size != size) {
+                    return false;
+                }
+                std::memcpy(destination, texture_file->get_mip_data(level), size);
+                return true;
+            }, resident_size);
+    }
+
+    //      
+    void TextureStreamer::request_screen_size(const size_t texture, const float screen_size) {
+        m_textures[texture]->screen_size = std::max(m_textures[texture]->screen_size, screen_size);
+    }
+
+    //   
+    void TextureStreamer::update(const double time_budget_ms, const size_t bytes_budget) {
+        const auto start_time = std::chrono::steady_clock::now();
+        m_stats.bytes_uploaded_last_frame = 0;
+        m_stats.uploads_last_frame = 0;
+
+        //   GPU :    
+        for (Request* request : m_requests) {
+            const ERequestState state = request->state.load(std::memory_order_acquire);
+            if (state == ERequestState::Uploaded) {
+                const GLenum result = glClientWaitSync(static_cast<GLsync>(request->fence), 0, 0);
+                if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+                    continue;
+                }
+                glDeleteSync(static_cast<GLsync>(request->fence));
+                request->fence = nullptr;
+                StreamedTexture& texture = *m_textures[request->texture];
+                texture.resident_level = std::min(texture.resident_level, request->level);
+                texture.texture->set_base_level(texture.resident_level);
+                texture.request_in_flight = false;
+                request->state.store(ERequestState::Retired, std::memory_order_relaxed);
+            }
+            else if (state == ERequestState::Failed) {
+                //    :      
+                StreamedTexture& texture = *m_textures[request->texture];
+                LOG_ERROR("TextureStreamer: failed to prepare mip {0} of texture {1}, keeping mip {2}", request->level, request->texture,
+                    texture.resident_level);
+                texture.min_level = std::max(texture.min_level, request->level + 1);
+                texture.request_in_flight = false;
+                ++m_stats.failed_levels_count;
+                request->state.store(ERequestState::Retired, std::memory_order_relaxed);
+            }
+        }
+        //      
+        while (!m_requests.empty() && m_requests.front()->state.load(std::memory_order_relaxed) == ERequestState::Retired) {
+            m_ring_allocator.release(m_requests.front()->ring_size);
+            m_request_pool.destroy(m_requests.front());
+            m_requests.pop_front();
+        }
+
+        //      ,     
+        FrameVector<Request*> decoded(FrameAllocator::get_resource());
+        decoded.reserve(m_requests.size());
+        for (Request* request : m_requests) {
+            if (request->state.load(std::memory_order_acquire) == ERequestState::Decoded) {
+                decoded.push_back(request);
+            }
+        }
+        std::sort(decoded.begin(), decoded.end(), [this](const Request* left, const Request* right) {
+            return m_textures[left->texture]->screen_size > m_textures[right->texture]->screen_size;
+        });
+        for (Request* request : decoded) {
+            const double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+            if (m_stats.uploads_last_frame > 0 && (elapsed_ms > time_budget_ms || m_stats.bytes_uploaded_last_frame + request->data_size > bytes_budget)) {
+                break;
+            }
+            m_textures[request->texture]->texture->set_mip_data_from_buffer(request->level, m_ring_id, request->ring_offset, request->data_size);
+            request->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            request->state.store(ERequestState::Uploaded, std::memory_order_relaxed);
+            m_stats.bytes_uploaded_last_frame += request->data_size;
+            ++m_stats.uploads_last_frame;
+        }
+
+        //  :    ,      
+        FrameVector<size_t> candidates(FrameAllocator::get_resource());
+        candidates.reserve(m_textures.size());
+        for (size_t i = 0; i < m_textures.size(); ++i) {
+            const StreamedTexture& texture = *m_textures[i];
+            if (texture.request_in_flight || texture.resident_level <= texture.min_level || texture.screen_size <= 0.f) {
+                continue;
+            }
+            const float texture_size = static_cast<float>(std::max(texture.texture->get_width(), texture.texture->get_height()));
+            const float desired_level = std::floor(std::log2(std::max(texture_size / texture.screen_size, 1.f)));
+            if (desired_level < static_cast<float>(texture.resident_level)) {
+                candidates.push_back(i);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [this](const size_t left, const size_t right) {
+            return m_textures[left]->screen_size > m_textures[right]->screen_size;
+        });
+        for (const size_t index : candidates) {
+            StreamedTexture& texture = *m_textures[index];
+            Request* request = m_request_pool.create();
+            request->texture = index;
+            request->level = texture.resident_level - 1;
+            request->data_size = calculate_mip_size(texture.texture->get_format(),
+                std::max(texture.texture->get_width() >> request->level, 1u), std::max(texture.texture->get_height() >> request->level, 1u));
+            if (!m_pRing || !m_ring_allocator.allocate(request->data_size, request->ring_offset, request->ring_size)) {
+                m_request_pool.destroy(request);
+                break;
+            }
+            texture.request_in_flight = true;
+            request->job = JobSystem::schedule_background([this, pTexture = &texture, pRequest = request]() {
+                decode(*pTexture, *pRequest);
+            });
+            m_requests.push_back(request);
+        }
+
+        //      
+        for (const auto& texture : m_textures) {
+            texture->screen_size = 0.f;
+        }
+        m_stats.requests_in_flight = m_requests.size();
+        m_stats.queued_requests = candidates.size();
+        m_stats.ring_used = m_ring_allocator.get_used();
+    }
+
+    //    :     
+    float TextureStreamer::calculate_screen_size(const Camera& camera, const float center[3], const float radius) {
+        const glm::vec3& position = camera.get_position();
+        const float dx = center[0] - position.x;
+        const float dy = center[1] - position.y;
+        const float dz = center[2] - position.z;
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (distance <= radius) {
+            return camera.get_viewport_height();
+        }
+        const float tan_half_fov = std::tan(camera.get_field_of_view() * 0.5f * 3.14159265f / 180.f);
+        return std::min(radius / (distance * tan_half_fov) * camera.get_viewport_height(), camera.get_viewport_height() * 4.f);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Texture_2D.hpp"
+#include "MyEngineCore/Core/JobSystem.hpp"
+#include "MyEngineCore/Core/ObjectPool.hpp"
+#include "MyEngineCore/Core/RingAllocator.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace MyEngine {
+
+    class Camera;
+    class TextureFile;
+
+    //   .     () ,  
+    //           pixel unpack   
+    //      .    , GL_TEXTURE_BASE_LEVEL  min LOD
+    //    .   -   
+    class TextureStreamer {
+    public:
+        //  :  size   level  destination (   )
+        using MipProvider = std::function<bool(const unsigned int level, unsigned char* destination, const size_t size)>;
+
+        // ,  add_texture ,     
+        static constexpr size_t s_invalid_texture = static_cast<size_t>(-1);
+
+        //   
+        struct Stats {
+            size_t textures_count = 0;
+            size_t failed_levels_count = 0;
+            size_t queued_requests = 0;
+            size_t requests_in_flight = 0;
+            size_t bytes_uploaded_last_frame = 0;
+            size_t uploads_last_frame = 0;
+            size_t ring_used = 0;
+            size_t ring_size = 0;
+        };
+
+        //  (  PBO)  
+        explicit TextureStreamer(const size_t ring_size = 32 * 1024 * 1024);
+        ~TextureStreamer();
+
+        //      
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(TextureStreamer&&) = delete;
+        TextureStreamer(TextureStreamer&&) = delete;
+
+        //  .    resident_size      ;
+        //         ,      s_invalid_texture
+        size_t add_texture(const unsigned int width, const unsigned int height, const ETextureFormat format, const unsigned int mips_count,
+            MipProvider provider, const unsigned int resident_size = 64);
+        //     .tex (   )
+        size_t add_texture(std::shared_ptr<TextureFile> texture_file, const unsigned int resident_size = 64);
+
+        //         (      )
+        void request_screen_size(const size_t texture, const float screen_size);
+        //   :  ,     ,  
+        void update(const double time_budget_ms = 2.0, const size_t bytes_budget = 8 * 1024 * 1024);
+
+        const Texture2D& get_texture(const size_t texture) const { return *m_textures[texture]->texture; }
+        //    
+        unsigned int get_resident_level(const size_t texture) const { return m_textures[texture]->resident_level; }
+        const Stats& get_stats() const { return m_stats; }
+
+        //       (center, radius)    
+        static float calculate_screen_size(const Camera& camera, const float center[3], const float radius);
+
+    private:
+        //   
+        enum class ERequestState {
+            Decoding,
+            Decoded,
+            Failed,
+            Uploaded,
+            Retired
+        };
+
+        //  :     fence 
+        struct Request {
+            size_t texture = 0;
+            unsigned int level = 0;
+            size_t ring_offset = 0;
+            size_t ring_size = 0;
+            size_t data_size = 0;
+            std::atomic<ERequestState> state{ ERequestState::Decoding };
+            JobHandle job;
+            void* fence = nullptr;
+        };
+
+        //  
+        struct StreamedTexture {
+            std::unique_ptr<Texture2D> texture;
+            MipProvider provider;
+            unsigned int resident_level = 0;
+            //   ,    :     
+            //    ,      
+            unsigned int min_level = 0;
+            float screen_size = 0.f;
+            bool request_in_flight = false;
+        };
+
+        //   ( )
+        void decode(const StreamedTexture& texture, Request& request);
+
+        std::vector<std::unique_ptr<StreamedTexture>> m_textures;
+        //       .      ,    
+        std::deque<Request*> m_requests;
+        ObjectPool<Request> m_request_pool{ 64 };
+
+        //  PBO: id ,  ,   (,    )  
+        unsigned int m_ring_id = 0;
+        unsigned char* m_pRing = nullptr;
+        RingAllocator m_ring_allocator;
+        size_t m_ring_size = 0;
+
+        //       
+        std::atomic<bool> m_stop{ false };
+
+        Stats m_stats;
+    };
+
+}
\ No newline at end of file
@@ -1,39 +1,196 @@
 #include "Texture_2D.hpp"
+#include "Render_OpenGL.hpp"
+#include "GpuMemoryTracker.hpp"
+
+#include "MyEngineCore/Resources/TextureFile.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <glad/glad.h>
 
 namespace MyEngine {
 
     // 
-    Texture2D::Texture2D(const unsigned char* data, const unsigned int width, const unsigned int height) : m_width(width), m_height(height){
-        //  , ,    
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_id);
-        const GLsizei mip_levels = static_cast<GLsizei>(std::log2(std::max(m_width, m_height))) + 1;
-        glTextureStorage2D(m_id, mip_levels, GL_RGB8, m_width, m_height);
-        glTextureSubImage2D(m_id, 0, 0, 0, m_width, m_height, GL_RGB, GL_UNSIGNED_BYTE, data);
+    Texture2D::Texture2D(const unsigned char* data, const unsigned int width, const unsigned int height) : Texture2D(width, height) {
+        set_data(data);
+    }
+
+    //  S3TC    glad ( ),   
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+    //   OpenGL
+    unsigned int Texture2D::get_internal_format(const ETextureFormat format) {
+        switch (format) {
+        case ETextureFormat::RGB8: return GL_RGB8;
+        case ETextureFormat::RGBA8: return GL_RGBA8;
+        case ETextureFormat::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case ETextureFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case ETextureFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+        case ETextureFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+        case ETextureFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        }
+        return GL_RGB8;
+    }
+
+    //   
+    Texture2D::Texture2D(const unsigned int width, const unsigned int height, const ETextureFormat format, const unsigned int mips_count)
+        : m_width(width), m_height(height), m_format(format), m_mips_count(mips_count == 0 ? calculate_mips_count(width, height) : mips_count) {
+        m_id = create_storage(m_width, m_height, m_format, m_mips_count);
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::Textures, get_memory_size());
+    }
+
+    //  ,    
+    unsigned int Texture2D::create_storage(const unsigned int width, const unsigned int height, const ETextureFormat format, const unsigned int mips_count) {
+        GLuint id = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &id);
+        glTextureStorage2D(id, mips_count, get_internal_format(format), width, height);
         // ,     
-        glTextureParameteri(m_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTextureParameteri(m_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        //  
-        glGenerateTextureMipmap(m_id);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        return id;
+    }
+
+    //   :  ,          GPU
+    bool Texture2D::drop_mips(const unsigned int levels_count) {
+        if (levels_count == 0 || levels_count >= m_mips_count) {
+            return false;
+        }
+        const unsigned int width = std::max(m_width >> levels_count, 1u);
+        const unsigned int height = std::max(m_height >> levels_count, 1u);
+        const unsigned int mips_count = m_mips_count - levels_count;
+        const GLuint id = create_storage(width, height, m_format, mips_count);
+        for (unsigned int level = 0; level < mips_count; ++level) {
+            glCopyImageSubData(m_id, GL_TEXTURE_2D, level + levels_count, 0, 0, 0, id, GL_TEXTURE_2D, level, 0, 0, 0,
+                std::max(width >> level, 1u), std::max(height >> level, 1u), 1);
+        }
+        //      ,      
+        for (const GLenum parameter : { GL_TEXTURE_WRAP_S, GL_TEXTURE_WRAP_T, GL_TEXTURE_MIN_FILTER, GL_TEXTURE_MAG_FILTER }) {
+            GLint value = 0;
+            glGetTextureParameteriv(m_id, parameter, &value);
+            glTextureParameteri(id, parameter, value);
+        }
+        GLint base_level = 0;
+        glGetTextureParameteriv(m_id, GL_TEXTURE_BASE_LEVEL, &base_level);
+        if (base_level > static_cast<GLint>(levels_count)) {
+            glTextureParameteri(id, GL_TEXTURE_BASE_LEVEL, base_level - static_cast<GLint>(levels_count));
+            glTextureParameterf(id, GL_TEXTURE_MIN_LOD, static_cast<GLfloat>(base_level - static_cast<GLint>(levels_count)));
+        }
+
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::Textures, get_memory_size());
+        Render_OpenGL::on_texture_deleted(m_id);
+        glDeleteTextures(1, &m_id);
+        m_id = id;
+        m_width = width;
+        m_height = height;
+        m_mips_count = mips_count;
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::Textures, get_memory_size());
+        return true;
+    }
+
+    //     
+    Texture2D::Texture2D(const TextureData& texture_data)
+        : Texture2D(texture_data.width, texture_data.height, texture_data.format, static_cast<unsigned int>(texture_data.mips.size())) {
+        for (unsigned int level = 0; level < m_mips_count; ++level) {
+            set_mip_data(level, texture_data.mips[level].data.data(), texture_data.mips[level].data.size());
+        }
+    }
+
+    //   :      
+    Texture2D::Texture2D(const TextureFile& texture_file)
+        : Texture2D(texture_file.get_header().width, texture_file.get_header().height, texture_file.get_format(), texture_file.get_header().mips_count) {
+        for (unsigned int level = 0; level < m_mips_count; ++level) {
+            set_mip_data(level, texture_file.get_mip_data(level), static_cast<size_t>(texture_file.get_mip(level).data_size));
+        }
+    }
+
+    //    
+    void Texture2D::set_data(const unsigned char* data) {
+        set_mip_data(0, data, calculate_mip_size(m_format, m_width, m_height));
+        if (!is_compressed_format(m_format)) {
+            glGenerateTextureMipmap(m_id);
+        }
+    }
+
+    //    pixel unpack :     GPU
+    void Texture2D::set_data_from_buffer(const unsigned int pixel_unpack_buffer, const size_t offset) {
+        Render_OpenGL::bind_pixel_unpack_buffer(pixel_unpack_buffer);
+        set_data(reinterpret_cast<const unsigned char*>(offset));
+        Render_OpenGL::bind_pixel_unpack_buffer(0);
+    }
+
+    //   
+    void Texture2D::set_mip_data(const unsigned int level, const void* data, const size_t size) {
+        const GLsizei width = std::max(m_width >> level, 1u);
+        const GLsizei height = std::max(m_height >> level, 1u);
+        Render_OpenGL::on_texture_uploaded(size);
+        if (is_compressed_format(m_format)) {
+            glCompressedTextureSubImage2D(m_id, level, 0, 0, width, height, get_internal_format(m_format), static_cast<GLsizei>(size), data);
+            return;
+        }
+        //  RGB8   
+        Render_OpenGL::set_unpack_alignment(1);
+        glTextureSubImage2D(m_id, level, 0, 0, width, height, m_format == ETextureFormat::RGBA8 ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, data);
+    }
+
+    //     pixel unpack 
+    void Texture2D::set_mip_data_from_buffer(const unsigned int level, const unsigned int pixel_unpack_buffer, const size_t offset, const size_t size) {
+        Render_OpenGL::bind_pixel_unpack_buffer(pixel_unpack_buffer);
+        set_mip_data(level, reinterpret_cast<const void*>(offset), size);
+        Render_OpenGL::bind_pixel_unpack_buffer(0);
+    }
+
+    //   
+    void Texture2D::set_base_level(const unsigned int base_level) const {
+        glTextureParameteri(m_id, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(base_level));
+        glTextureParameterf(m_id, GL_TEXTURE_MIN_LOD, static_cast<GLfloat>(base_level));
+    }
+
+    //   
+    bool Texture2D::is_format_supported(const ETextureFormat format) {
+        if (format != ETextureFormat::BC1 && format != ETextureFormat::BC3) {
+            return true;
+        }
+        //    
+        static const bool s_s3tc_supported = Render_OpenGL::is_extension_supported("GL_EXT_texture_compression_s3tc");
+        return s_s3tc_supported;
+    }
+
+    //  
+    size_t Texture2D::get_memory_size() const {
+        const ETextureFormat format = m_format == ETextureFormat::RGB8 ? ETextureFormat::RGBA8 : m_format;
+        return calculate_texture_size(format, m_width, m_height, m_mips_count);
     }
 
     // 
     Texture2D::~Texture2D() {
+        if (m_id) {
+            GpuMemoryTracker::on_free(EGpuMemoryCategory::Textures, get_memory_size());
+        }
+        Render_OpenGL::on_texture_deleted(m_id);
         glDeleteTextures(1, &m_id);
     }
 
     //  
     Texture2D& Texture2D::operator=(Texture2D&& texture) noexcept
     {
+        if (m_id) {
+            GpuMemoryTracker::on_free(EGpuMemoryCategory::Textures, get_memory_size());
+        }
+        Render_OpenGL::on_texture_deleted(m_id);
         glDeleteTextures(1, &m_id);
         m_id = texture.m_id;
         m_width = texture.m_width;
         m_height = texture.m_height;
+        m_format = texture.m_format;
+        m_mips_count = texture.m_mips_count;
         texture.m_id = 0;
         return *this;
     }
@@ -43,11 +200,13 @@ namespace MyEngine {
         m_id = texture.m_id;
         m_width = texture.m_width;
         m_height = texture.m_height;
+        m_format = texture.m_format;
+        m_mips_count = texture.m_mips_count;
         texture.m_id = 0;
     }
 
     //  
     void Texture2D::bind(const unsigned int unit) const {
-        glBindTextureUnit(unit, m_id);
+        Render_OpenGL::bind_texture_unit(unit, m_id);
     }
 }
\ No newline at end of file
@@ -1,11 +1,24 @@
 #pragma once
 
+#include "MyEngineCore/Rendering/TextureFormat.hpp"
+
+#include <cstddef>
+
 namespace MyEngine {
 
+    struct TextureData;
+    class TextureFile;
+
     class Texture2D {
     public:
         //   
         Texture2D(const unsigned char* data, const unsigned int width, const unsigned int height);
+        //    (    set_data), mips_count = 0 -   
+        Texture2D(const unsigned int width, const unsigned int height, const ETextureFormat format = ETextureFormat::RGB8,
+            const unsigned int mips_count = 0);
+        //     (   )     
+        explicit Texture2D(const TextureData& texture_data);
+        explicit Texture2D(const TextureFile& texture_file);
         ~Texture2D();
 
         //   ,  ,     
@@ -17,11 +30,43 @@ namespace MyEngine {
         //   
         void bind(const unsigned int unit) const;
 
+        //        pixel unpack  (offset -    ),
+        //        GPU
+        void set_data(const unsigned char* data);
+        void set_data_from_buffer(const unsigned int pixel_unpack_buffer, const size_t offset);
+        //    (size -   ,    )
+        void set_mip_data(const unsigned int level, const void* data, const size_t size);
+        void set_mip_data_from_buffer(const unsigned int level, const unsigned int pixel_unpack_buffer, const size_t offset, const size_t size);
+
+        //   :   base_level   (GL_TEXTURE_BASE_LEVEL  min LOD)
+        void set_base_level(const unsigned int base_level) const;
+        //  levels_count      ( , id )
+        bool drop_mips(const unsigned int levels_count);
+
+        //     (BC1/BC3 -  S3TC,     OpenGL 4.6)
+        static bool is_format_supported(const ETextureFormat format);
+        //   OpenGL   
+        static unsigned int get_internal_format(const ETextureFormat format);
+
+        ETextureFormat get_format() const { return m_format; }
+        unsigned int get_mips_count() const { return m_mips_count; }
+        unsigned int get_width() const { return m_width; }
+        unsigned int get_height() const { return m_height; }
+        //    (RGB8     RGBA8)
+        size_t get_memory_size() const;
+
     private:
+        //       
+        static unsigned int create_storage(const unsigned int width, const unsigned int height, const ETextureFormat format,
+            const unsigned int mips_count);
+
         // id,   
         unsigned int m_id = 0;
         unsigned int m_width = 0;
         unsigned int m_height = 0;
+        //    
+        ETextureFormat m_format = ETextureFormat::RGB8;
+        unsigned int m_mips_count = 0;
     };
 
 }
\ No newline at end of file
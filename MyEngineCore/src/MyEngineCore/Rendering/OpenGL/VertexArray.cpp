@@ -1,4 +1,5 @@
 #include "VertexArray.hpp"
+#include "Render_OpenGL.hpp"
 
 #include "MyEngineCore/Log.hpp"
 
@@ -13,6 +14,7 @@ namespace MyEngine {
 
     //  
     VertexArray::~VertexArray(){
+        Render_OpenGL::on_vertex_array_deleted(m_id);
         glDeleteVertexArrays(1, &m_id);
     }
 
@@ -34,12 +36,12 @@ namespace MyEngine {
 
     //    
     void VertexArray::bind() const {
-        glBindVertexArray(m_id);
+        Render_OpenGL::bind_vertex_array(m_id);
     }
 
     //    
     void VertexArray::unbind(){
-        glBindVertexArray(0);
+        Render_OpenGL::bind_vertex_array(0);
     }
 
     //    
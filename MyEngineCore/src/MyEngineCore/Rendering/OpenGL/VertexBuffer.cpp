@@ -1,4 +1,6 @@
 #include "VertexBuffer.hpp"
+#include "GpuMemoryTracker.hpp"
+#include "Render_OpenGL.hpp"
 
 #include "MyEngineCore/Log.hpp"
 
@@ -77,6 +79,7 @@ namespace MyEngine {
         case VertexBuffer::EUsage::Static:  return GL_STATIC_DRAW;
         case VertexBuffer::EUsage::Dynamic: return GL_DYNAMIC_DRAW;
         case VertexBuffer::EUsage::Stream:  return GL_STREAM_DRAW;
+        case VertexBuffer::EUsage::Immutable: return GL_STATIC_DRAW;
         }
         LOG_ERROR("Unknown VertexBuffer usage");
         return GL_STREAM_DRAW;
@@ -90,13 +93,25 @@ namespace MyEngine {
 
     // 
     VertexBuffer::~VertexBuffer(){
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::VertexBuffers, m_size);
         glDeleteBuffers(1, &m_id);
     }
 
     //  
     VertexBuffer::VertexBuffer(const void* data, const size_t size, BufferLayout buffer_layout, const EUsage usage)
-        : m_buffer_layout(std::move(buffer_layout))
+        : m_size(size), m_buffer_layout(std::move(buffer_layout))
     {
+        GpuMemoryTracker::on_allocate(EGpuMemoryCategory::VertexBuffers, size);
+        if (data) {
+            Render_OpenGL::on_buffer_uploaded(size);
+        }
+        //  :       (,   ),
+        //  data     glCopyNamedBufferSubData  staging-
+        if (usage == EUsage::Immutable) {
+            glCreateBuffers(1, &m_id);
+            glNamedBufferStorage(m_id, size, data, 0);
+            return;
+        }
         glGenBuffers(1, &m_id);
         glBindBuffer(GL_ARRAY_BUFFER, m_id);
         glBufferData(GL_ARRAY_BUFFER, size, data, usage_to_GLenum(usage));
@@ -104,14 +119,20 @@ namespace MyEngine {
 
     //   
     VertexBuffer& VertexBuffer::operator = (VertexBuffer&& vertex_buffer) noexcept {
+        GpuMemoryTracker::on_free(EGpuMemoryCategory::VertexBuffers, m_size);
+        glDeleteBuffers(1, &m_id);
         m_id = vertex_buffer.m_id;
+        m_size = vertex_buffer.m_size;
+        m_buffer_layout = std::move(vertex_buffer.m_buffer_layout);
         vertex_buffer.m_id = 0;
+        vertex_buffer.m_size = 0;
         return *this;
     }
 
     // 
     VertexBuffer::VertexBuffer(VertexBuffer&& vertex_buffer) noexcept
-        : m_id(vertex_buffer.m_id), m_buffer_layout(std::move(vertex_buffer.m_buffer_layout)){
+        : m_id(vertex_buffer.m_id), m_size(vertex_buffer.m_size), m_buffer_layout(std::move(vertex_buffer.m_buffer_layout)){
         vertex_buffer.m_id = 0;
+        vertex_buffer.m_size = 0;
     }
 }
\ No newline at end of file
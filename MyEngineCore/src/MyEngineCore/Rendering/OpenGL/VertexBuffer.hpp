@@ -32,6 +32,21 @@ namespace MyEngine {
         // 
         BufferLayout(std::initializer_list<BufferElement> elements)
             : m_elements(std::move(elements)) {
+            calculate_offsets();
+        }
+
+        //      (layout,    )
+        BufferLayout(std::vector<BufferElement> elements)
+            : m_elements(std::move(elements)) {
+            calculate_offsets();
+        }
+
+        const std::vector<BufferElement>& get_elements() const { return m_elements; }
+        size_t get_stride() const { return m_stride; }
+
+    private:
+        //      
+        void calculate_offsets() {
             size_t offset = 0;
             m_stride = 0;
             for (auto& element : m_elements) {
@@ -41,10 +56,6 @@ namespace MyEngine {
             }
         }
 
-        const std::vector<BufferElement>& get_elements() const { return m_elements; }
-        size_t get_stride() const { return m_stride; }
-
-    private:
         std::vector<BufferElement> m_elements;
         size_t m_stride = 0;
     };
@@ -53,11 +64,12 @@ namespace MyEngine {
     class VertexBuffer {
     public:
 
-        //   
+        //    (Immutable -    glNamedBufferStorage)
         enum class EUsage {
             Static,
             Dynamic,
-            Stream
+            Stream,
+            Immutable
         };
 
         //   
@@ -70,8 +82,9 @@ namespace MyEngine {
         VertexBuffer& operator = (VertexBuffer&& vertexBuffer) noexcept;
         VertexBuffer(VertexBuffer&& vertexBuffer) noexcept;
 
-        //   
+        //        
         unsigned int get_handle() const { return m_id; }
+        size_t get_size() const { return m_size; }
 
         //    layout
         const BufferLayout& get_layout() const { return m_buffer_layout; }
@@ -79,6 +92,7 @@ namespace MyEngine {
     private:
         // id      (  )
         unsigned int m_id = 0;
+        size_t m_size = 0;
         BufferLayout m_buffer_layout;
     };
 
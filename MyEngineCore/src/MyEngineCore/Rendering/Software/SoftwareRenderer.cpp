@@ -0,0 +1,766 @@
+#include "SoftwareRenderer.hpp"
+#include "SoftwareTexture.hpp"
+
+#include "MyEngineCore/Core/Parallel.hpp"
+#include "MyEngineCore/Core/TransformBatch.hpp"
+#include "MyEngineCore/Rendering/OpenGL/LightClusters.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <imgui/imgui.h>
+#include <glm/geometric.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+//    SSE2   x86 (  TransformBatch),  - 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define MYENGINE_RASTER_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #define MYENGINE_TARGET_SSE
+    #else
+        #define MYENGINE_TARGET_SSE __attribute__((target("sse2")))
+    #endif
+#endif
+
+namespace MyEngine {
+
+    //            
+    constexpr double s_subpixel_scale = 256.0;
+    constexpr float s_guard_band_pixels = 16384.f;
+    //      
+    constexpr int s_max_clipped_vertices = 9;
+
+    //   RGBA8   (     OpenGL)
+    static uint32_t pack_color(const glm::vec4& color) {
+        uint32_t packed = 0;
+        for (int channel = 0; channel < 4; ++channel) {
+            const float value = std::min(std::max(color[channel], 0.f), 1.f);
+            packed |= static_cast<uint32_t>(value * 255.f + 0.5f) << (8 * channel);
+        }
+        return packed;
+    }
+
+    //   reflect  GLSL
+    static glm::vec3 reflect(const glm::vec3& incident, const glm::vec3& normal) {
+        return incident - 2.f * glm::dot(normal, incident) * normal;
+    }
+
+    //    :     start_x ( 4),  [min_x, max_x)
+    struct RowSpan {
+        int start_x;
+        int min_x;
+        int max_x;
+        int y;
+        int groups_count;
+    };
+
+    //  ,   [min_x, max_x)
+    static int get_range_mask(const int x, const int min_x, const int max_x) {
+        int mask = 0;
+        for (int lane = 0; lane < 4; ++lane) {
+            if (x + lane >= min_x && x + lane < max_x) {
+                mask |= 1 << lane;
+            }
+        }
+        return mask;
+    }
+
+    //   : masks[i] -   start_x + 4 * i .. + 3,      
+    //   
+    template<typename Triangle>
+    static void calculate_row_masks_scalar(const Triangle& triangle, const RowSpan& span, const float* pDepthRow, uint8_t* pMasks) {
+        const double py = span.y * s_subpixel_scale + s_subpixel_scale * 0.5;
+        const float depth_dy = (static_cast<float>(span.y) + 0.5f - triangle.origin_y) * triangle.depth[1] + triangle.depth[2];
+        for (int group = 0; group < span.groups_count; ++group) {
+            const int x = span.start_x + 4 * group;
+            int mask = get_range_mask(x, span.min_x, span.max_x);
+            for (int lane = 0; lane < 4; ++lane) {
+                if (!(mask & (1 << lane))) {
+                    continue;
+                }
+                const double px = (x + lane) * s_subpixel_scale + s_subpixel_scale * 0.5;
+                bool inside = true;
+                for (int edge = 0; edge < 3; ++edge) {
+                    inside = inside && triangle.edges[edge][0] * px + triangle.edges[edge][1] * py + triangle.edges[edge][2] >= 0.0;
+                }
+                const float depth = depth_dy + (static_cast<float>(x + lane) + 0.5f - triangle.origin_x) * triangle.depth[0];
+                if (!inside || !(depth < pDepthRow[x + lane])) {
+                    mask &= ~(1 << lane);
+                }
+            }
+            pMasks[group] = static_cast<uint8_t>(mask);
+        }
+    }
+
+#if defined(MYENGINE_RASTER_X86)
+
+    //   -  2    double ( ,  ),  - 4   float
+    template<typename Triangle>
+    MYENGINE_TARGET_SSE static void calculate_row_masks_sse(const Triangle& triangle, const RowSpan& span, const float* pDepthRow, uint8_t* pMasks) {
+        const double py = span.y * s_subpixel_scale + s_subpixel_scale * 0.5;
+        const double px = span.start_x * s_subpixel_scale + s_subpixel_scale * 0.5;
+        __m128d edges_low[3];
+        __m128d edges_high[3];
+        __m128d edges_step[3];
+        for (int edge = 0; edge < 3; ++edge) {
+            const double a = triangle.edges[edge][0] * s_subpixel_scale;
+            const __m128d start = _mm_set1_pd(triangle.edges[edge][0] * px + triangle.edges[edge][1] * py + triangle.edges[edge][2]);
+            edges_low[edge] = _mm_add_pd(start, _mm_set_pd(a, 0.0));
+            edges_high[edge] = _mm_add_pd(start, _mm_set_pd(3.0 * a, 2.0 * a));
+            edges_step[edge] = _mm_set1_pd(4.0 * a);
+        }
+        const __m128d zero = _mm_setzero_pd();
+
+        const float depth_start = triangle.depth[2] + (static_cast<float>(span.y) + 0.5f - triangle.origin_y) * triangle.depth[1]
+            + (static_cast<float>(span.start_x) + 0.5f - triangle.origin_x) * triangle.depth[0];
+        __m128 depth = _mm_add_ps(_mm_set1_ps(depth_start), _mm_mul_ps(_mm_set1_ps(triangle.depth[0]), _mm_setr_ps(0.f, 1.f, 2.f, 3.f)));
+        const __m128 depth_step = _mm_set1_ps(4.f * triangle.depth[0]);
+
+        for (int group = 0; group < span.groups_count; ++group) {
+            const int x = span.start_x + 4 * group;
+            const __m128d inside_low = _mm_and_pd(_mm_and_pd(_mm_cmpge_pd(edges_low[0], zero), _mm_cmpge_pd(edges_low[1], zero)),
+                _mm_cmpge_pd(edges_low[2], zero));
+            const __m128d inside_high = _mm_and_pd(_mm_and_pd(_mm_cmpge_pd(edges_high[0], zero), _mm_cmpge_pd(edges_high[1], zero)),
+                _mm_cmpge_pd(edges_high[2], zero));
+            int mask = (_mm_movemask_pd(inside_low) | (_mm_movemask_pd(inside_high) << 2)) & get_range_mask(x, span.min_x, span.max_x);
+            if (mask) {
+                mask &= _mm_movemask_ps(_mm_cmplt_ps(depth, _mm_loadu_ps(pDepthRow + x)));
+            }
+            pMasks[group] = static_cast<uint8_t>(mask);
+
+            for (int edge = 0; edge < 3; ++edge) {
+                edges_low[edge] = _mm_add_pd(edges_low[edge], edges_step[edge]);
+                edges_high[edge] = _mm_add_pd(edges_high[edge], edges_step[edge]);
+            }
+            depth = _mm_add_ps(depth, depth_step);
+        }
+    }
+
+#endif
+
+    bool SoftwareMesh::create(const MeshData& mesh_data) {
+        if (mesh_data.streams.empty()) {
+            return false;
+        }
+        const MeshData::Stream& stream = mesh_data.streams[0];
+        const bool layout_matches = stream.elements.size() == 3 && stream.elements[0] == ShaderDataType::Float3
+            && stream.elements[1] == ShaderDataType::Float3 && stream.elements[2] == ShaderDataType::Float2;
+        if (!layout_matches || stream.data.size() != mesh_data.vertices_count * sizeof(MeshVertex)) {
+            return false;
+        }
+        vertices.resize(static_cast<size_t>(mesh_data.vertices_count));
+        if (!vertices.empty()) {
+            std::memcpy(vertices.data(), stream.data.data(), stream.data.size());
+        }
+
+        //       ,   
+        indices.clear();
+        if (mesh_data.lods.empty()) {
+            indices = mesh_data.indices;
+        }
+        else {
+            const MeshLOD& lod = mesh_data.lods[0];
+            for (uint32_t submesh_index = lod.first_submesh; submesh_index < lod.first_submesh + lod.submeshes_count; ++submesh_index) {
+                const MeshSubmesh& submesh = mesh_data.submeshes[submesh_index];
+                for (uint32_t i = submesh.first_index; i < submesh.first_index + submesh.indices_count; ++i) {
+                    indices.push_back(static_cast<uint32_t>(static_cast<int64_t>(mesh_data.indices[i]) + submesh.base_vertex));
+                }
+            }
+        }
+        indices.resize(indices.size() / 3 * 3);
+        const MeshBounds& bounds = mesh_data.bounds;
+        bounding_sphere = glm::vec4(bounds.center[0], bounds.center[1], bounds.center[2], bounds.radius);
+        return true;
+    }
+
+    SoftwareRenderer::SoftwareRenderer(const unsigned int width, const unsigned int height) {
+        m_simd = TransformBatch::get_kernel() != ETransformKernel::Scalar;
+        resize(width, height);
+    }
+
+    SoftwareRenderer::~SoftwareRenderer() = default;
+
+    void SoftwareRenderer::resize(const unsigned int width, const unsigned int height) {
+        m_width = std::max(width, 1u);
+        m_height = std::max(height, 1u);
+        m_tiles_x = (m_width + s_tile_size - 1) / s_tile_size;
+        m_tiles_y = (m_height + s_tile_size - 1) / s_tile_size;
+        m_depth_stride = (m_width + 3) & ~3u;
+        m_color.assign(static_cast<size_t>(m_width) * m_height, 0);
+        m_depth.assign(static_cast<size_t>(m_depth_stride) * m_height, 1.f);
+        //   (ndc * 0.5 + 0.5) * size    +-s_guard_band_pixels
+        m_guard_band_x = 2.f * s_guard_band_pixels / static_cast<float>(m_width) - 1.f;
+        m_guard_band_y = 2.f * s_guard_band_pixels / static_cast<float>(m_height) - 1.f;
+    }
+
+    void SoftwareRenderer::begin_frame(const glm::vec4& clear_color, const glm::mat4& view, const glm::mat4& projection,
+        const SoftwareLighting& lighting) {
+        m_clear_color = pack_color(clear_color);
+        m_view = view;
+        m_projection = projection;
+        m_lighting = lighting;
+        m_sun_direction_eye = glm::mat3(view) * lighting.sun_direction;
+        m_draws.clear();
+        m_vertices_count = 0;
+        m_triangles_count = 0;
+    }
+
+    void SoftwareRenderer::draw(const SoftwareMesh& mesh, const glm::mat4& model, const SoftwareMaterial& material) {
+        m_draws.push_back(DrawCommand{ &mesh, model, material, m_vertices_count, m_triangles_count, 0, 0 });
+        m_vertices_count += mesh.vertices.size();
+        m_triangles_count += mesh.indices.size() / 3;
+    }
+
+    template<typename Function>
+    void SoftwareRenderer::run_tasks(const size_t tasks_count, const size_t items_count, Function&& function) {
+        std::atomic<size_t> next_item{ 0 };
+        parallel_for(std::min(tasks_count, items_count), 1, [&](const size_t begin, const size_t end) {
+            for (size_t task = begin; task < end; ++task) {
+                for (size_t item = next_item.fetch_add(1, std::memory_order_relaxed); item < items_count;
+                    item = next_item.fetch_add(1, std::memory_order_relaxed)) {
+                    function(item);
+                }
+            }
+        });
+    }
+
+    void SoftwareRenderer::end_frame(const size_t threads_count) {
+        const auto start_time = std::chrono::steady_clock::now();
+        const auto get_elapsed_ms = [](const std::chrono::steady_clock::time_point from) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - from).count();
+        };
+        const size_t tasks_count = threads_count == 0 ? get_workers_count() : std::min(threads_count, get_workers_count());
+        m_stats = Stats{};
+        m_stats.draws_count = m_draws.size();
+        m_stats.triangles_count = m_triangles_count;
+        m_stats.tiles_count = static_cast<size_t>(m_tiles_x) * m_tiles_y;
+        m_stats.threads_count = tasks_count;
+        m_stats.simd = m_simd;
+
+        //       ,   
+        m_lights.resize(m_lighting.lights_count);
+        for (size_t i = 0; i < m_lighting.lights_count; ++i) {
+            const PointLight& light = m_lighting.pLights[i];
+            m_lights[i].position = glm::vec3(m_view * glm::vec4(light.position, 1.f));
+            m_lights[i].radius_squared = light.radius * light.radius;
+            m_lights[i].radiance = light.color * light.intensity;
+        }
+        m_draw_lights.clear();
+        for (DrawCommand& draw : m_draws) {
+            const glm::vec4& sphere = draw.pMesh->bounding_sphere;
+            const float scale = std::max(glm::length(glm::vec3(draw.model[0])), std::max(glm::length(glm::vec3(draw.model[1])),
+                glm::length(glm::vec3(draw.model[2]))));
+            const glm::vec3 center = glm::vec3(m_view * (draw.model * glm::vec4(glm::vec3(sphere), 1.f)));
+            const float radius = sphere.w * scale;
+            draw.first_light = m_draw_lights.size();
+            for (size_t i = 0; i < m_lights.size(); ++i) {
+                const glm::vec3 offset = m_lights[i].position - center;
+                const float reach = std::sqrt(m_lights[i].radius_squared) + radius;
+                if (glm::dot(offset, offset) < reach * reach) {
+                    m_draw_lights.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            draw.lights_count = m_draw_lights.size() - draw.first_light;
+        }
+
+        // 1. 
+        m_vertices.resize(m_vertices_count);
+        run_tasks(tasks_count, (m_vertices_count + s_vertices_per_task - 1) / s_vertices_per_task, [this](const size_t block_index) {
+            transform_vertices(block_index);
+        });
+        m_stats.vertex_ms = get_elapsed_ms(start_time);
+
+        // 2. ,     
+        const auto binning_start_time = std::chrono::steady_clock::now();
+        m_chunks_count = (m_triangles_count + s_triangles_per_chunk - 1) / s_triangles_per_chunk;
+        if (m_chunks.size() < m_chunks_count) {
+            m_chunks.resize(m_chunks_count);
+        }
+        run_tasks(tasks_count, m_chunks_count, [this](const size_t chunk_index) {
+            setup_chunk(chunk_index);
+        });
+        for (size_t i = 0; i < m_chunks_count; ++i) {
+            m_stats.rasterized_triangles_count += m_chunks[i].triangles.size();
+            m_stats.binned_triangles_count += m_chunks[i].entries_count;
+        }
+        m_stats.binning_ms = get_elapsed_ms(binning_start_time);
+
+        // 3.  (    )
+        const auto raster_start_time = std::chrono::steady_clock::now();
+        m_shaded_pixels_count.store(0, std::memory_order_relaxed);
+        run_tasks(tasks_count, m_stats.tiles_count, [this](const size_t tile_index) {
+            rasterize_tile(tile_index);
+        });
+        m_stats.shaded_pixels_count = m_shaded_pixels_count.load(std::memory_order_relaxed);
+        m_stats.raster_ms = get_elapsed_ms(raster_start_time);
+        m_stats.total_ms = get_elapsed_ms(start_time);
+    }
+
+    void SoftwareRenderer::transform_vertices(const size_t block_index) {
+        const size_t begin = block_index * s_vertices_per_task;
+        const size_t end = std::min(begin + s_vertices_per_task, m_vertices_count);
+        //    
+        size_t draw_index = static_cast<size_t>(std::upper_bound(m_draws.begin(), m_draws.end(), begin,
+            [](const size_t vertex, const DrawCommand& draw) { return vertex < draw.first_vertex; }) - m_draws.begin()) - 1;
+
+        size_t i = begin;
+        while (i < end) {
+            const DrawCommand& draw = m_draws[draw_index];
+            const size_t draw_end = std::min(end, draw.first_vertex + draw.pMesh->vertices.size());
+            const glm::mat4 model_view = m_view * draw.model;
+            const glm::mat4 mvp = m_projection * model_view;
+            const glm::mat3 normal_matrix = glm::inverseTranspose(glm::mat3(model_view));
+            for (; i < draw_end; ++i) {
+                const MeshVertex& vertex = draw.pMesh->vertices[i - draw.first_vertex];
+                const glm::vec4 position(vertex.position[0], vertex.position[1], vertex.position[2], 1.f);
+                TransformedVertex& out = m_vertices[i];
+                out.clip = mvp * position;
+                out.position_eye = glm::vec3(model_view * position);
+                out.normal_eye = normal_matrix * glm::vec3(vertex.normal[0], vertex.normal[1], vertex.normal[2]);
+                out.uv = glm::vec2(vertex.uv[0], vertex.uv[1]);
+            }
+            ++draw_index;
+        }
+    }
+
+    void SoftwareRenderer::setup_chunk(const size_t chunk_index) {
+        Chunk& chunk = m_chunks[chunk_index];
+        chunk.triangles.clear();
+        const size_t begin = chunk_index * s_triangles_per_chunk;
+        const size_t end = std::min(begin + s_triangles_per_chunk, m_triangles_count);
+        size_t draw_index = static_cast<size_t>(std::upper_bound(m_draws.begin(), m_draws.end(), begin,
+            [](const size_t triangle, const DrawCommand& draw) { return triangle < draw.first_triangle; }) - m_draws.begin()) - 1;
+
+        for (size_t i = begin; i < end; ++i) {
+            while (i >= m_draws[draw_index].first_triangle + m_draws[draw_index].pMesh->indices.size() / 3) {
+                ++draw_index;
+            }
+            const DrawCommand& draw = m_draws[draw_index];
+            const uint32_t* pIndices = draw.pMesh->indices.data() + 3 * (i - draw.first_triangle);
+            const TransformedVertex* pVertices[3] = { &m_vertices[draw.first_vertex + pIndices[0]], &m_vertices[draw.first_vertex + pIndices[1]],
+                &m_vertices[draw.first_vertex + pIndices[2]] };
+            clip_triangle(chunk, pVertices, static_cast<uint32_t>(draw_index));
+        }
+
+        // :      ,     ,   
+        const size_t tiles_count = static_cast<size_t>(m_tiles_x) * m_tiles_y;
+        chunk.offsets.assign(tiles_count + 1, 0);
+        chunk.counts.assign(tiles_count, 0);
+        for (const Triangle& triangle : chunk.triangles) {
+            for (int tile_y = triangle.min_y / static_cast<int>(s_tile_size); tile_y <= (triangle.max_y - 1) / static_cast<int>(s_tile_size); ++tile_y) {
+                for (int tile_x = triangle.min_x / static_cast<int>(s_tile_size); tile_x <= (triangle.max_x - 1) / static_cast<int>(s_tile_size); ++tile_x) {
+                    ++chunk.offsets[static_cast<size_t>(tile_y) * m_tiles_x + tile_x + 1];
+                }
+            }
+        }
+        for (size_t tile = 0; tile < tiles_count; ++tile) {
+            chunk.offsets[tile + 1] += chunk.offsets[tile];
+        }
+        chunk.entries.resize(chunk.offsets[tiles_count]);
+        size_t entries_count = 0;
+        for (uint32_t triangle_index = 0; triangle_index < chunk.triangles.size(); ++triangle_index) {
+            const Triangle& triangle = chunk.triangles[triangle_index];
+            for (int tile_y = triangle.min_y / static_cast<int>(s_tile_size); tile_y <= (triangle.max_y - 1) / static_cast<int>(s_tile_size); ++tile_y) {
+                for (int tile_x = triangle.min_x / static_cast<int>(s_tile_size); tile_x <= (triangle.max_x - 1) / static_cast<int>(s_tile_size); ++tile_x) {
+                    const int min_x = std::max(triangle.min_x, tile_x * static_cast<int>(s_tile_size));
+                    const int min_y = std::max(triangle.min_y, tile_y * static_cast<int>(s_tile_size));
+                    const int max_x = std::min(triangle.max_x, (tile_x + 1) * static_cast<int>(s_tile_size));
+                    const int max_y = std::min(triangle.max_y, (tile_y + 1) * static_cast<int>(s_tile_size));
+                    if (!touches_rectangle(triangle, min_x, min_y, max_x, max_y)) {
+                        continue;
+                    }
+                    const size_t tile = static_cast<size_t>(tile_y) * m_tiles_x + tile_x;
+                    chunk.entries[chunk.offsets[tile] + chunk.counts[tile]++] = triangle_index;
+                    ++entries_count;
+                }
+            }
+        }
+        chunk.entries_count = entries_count;
+    }
+
+    //       ,    
+    bool SoftwareRenderer::touches_rectangle(const Triangle& triangle, const int min_x, const int min_y, const int max_x, const int max_y) {
+        for (int edge = 0; edge < 3; ++edge) {
+            const double a = triangle.edges[edge][0];
+            const double b = triangle.edges[edge][1];
+            const int x = a > 0.0 ? max_x - 1 : min_x;
+            const int y = b > 0.0 ? max_y - 1 : min_y;
+            const double value = a * (x * s_subpixel_scale + s_subpixel_scale * 0.5) + b * (y * s_subpixel_scale + s_subpixel_scale * 0.5) + triangle.edges[edge][2];
+            if (value < 0.0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //     ( - ):       w,
+    //        
+    void SoftwareRenderer::clip_triangle(Chunk& chunk, const TransformedVertex* pVertices[3], const uint32_t draw_index) const {
+        //   : , ,   , ,    (>= 0 - )
+        const auto get_distance = [this](const glm::vec4& clip, const int plane) {
+            switch (plane) {
+            case 0: return clip.z + clip.w;
+            case 1: return clip.w - clip.z;
+            case 2: return clip.x + m_guard_band_x * clip.w;
+            case 3: return m_guard_band_x * clip.w - clip.x;
+            case 4: return clip.y + m_guard_band_y * clip.w;
+            default: return m_guard_band_y * clip.w - clip.y;
+            }
+        };
+
+        int outside_all = 0x3F;
+        int outside_any = 0;
+        for (int i = 0; i < 3; ++i) {
+            int outside = 0;
+            for (int plane = 0; plane < 6; ++plane) {
+                if (get_distance(pVertices[i]->clip, plane) < 0.f) {
+                    outside |= 1 << plane;
+                }
+            }
+            outside_all &= outside;
+            outside_any |= outside;
+        }
+        if (outside_all) {
+            return;
+        }
+        if (!outside_any) {
+            setup_triangle(chunk, *pVertices[0], *pVertices[1], *pVertices[2], draw_index);
+            return;
+        }
+
+        TransformedVertex polygons[2][s_max_clipped_vertices];
+        int vertices_count = 3;
+        for (int i = 0; i < 3; ++i) {
+            polygons[0][i] = *pVertices[i];
+        }
+        int current = 0;
+        for (int plane = 0; plane < 6 && vertices_count >= 3; ++plane) {
+            if (!(outside_any & (1 << plane))) {
+                continue;
+            }
+            const TransformedVertex* pInput = polygons[current];
+            TransformedVertex* pOutput = polygons[1 - current];
+            int output_count = 0;
+            for (int i = 0; i < vertices_count; ++i) {
+                const TransformedVertex& a = pInput[i];
+                const TransformedVertex& b = pInput[(i + 1) % vertices_count];
+                const float distance_a = get_distance(a.clip, plane);
+                const float distance_b = get_distance(b.clip, plane);
+                if (distance_a >= 0.f) {
+                    pOutput[output_count++] = a;
+                }
+                if ((distance_a >= 0.f) != (distance_b >= 0.f)) {
+                    const float t = distance_a / (distance_a - distance_b);
+                    TransformedVertex& vertex = pOutput[output_count++];
+                    vertex.clip = a.clip + (b.clip - a.clip) * t;
+                    vertex.position_eye = a.position_eye + (b.position_eye - a.position_eye) * t;
+                    vertex.normal_eye = a.normal_eye + (b.normal_eye - a.normal_eye) * t;
+                    vertex.uv = a.uv + (b.uv - a.uv) * t;
+                }
+            }
+            vertices_count = output_count;
+            current = 1 - current;
+        }
+        for (int i = 1; i + 1 < vertices_count; ++i) {
+            setup_triangle(chunk, polygons[current][0], polygons[current][i], polygons[current][i + 1], draw_index);
+        }
+    }
+
+    void SoftwareRenderer::setup_triangle(Chunk& chunk, const TransformedVertex& v0, const TransformedVertex& v1, const TransformedVertex& v2,
+        const uint32_t draw_index) const {
+        const TransformedVertex* pVertices[3] = { &v0, &v1, &v2 };
+        double x[3];
+        double y[3];
+        float depth[3];
+        float inverse_w[3];
+        for (int i = 0; i < 3; ++i) {
+            const glm::vec4& clip = pVertices[i]->clip;
+            if (!(clip.w > 0.f)) {
+                return;
+            }
+            inverse_w[i] = 1.f / clip.w;
+            //  ,   1/256  (  )
+            x[i] = std::round((static_cast<double>(clip.x * inverse_w[i]) * 0.5 + 0.5) * m_width * s_subpixel_scale);
+            y[i] = std::round((static_cast<double>(clip.y * inverse_w[i]) * 0.5 + 0.5) * m_height * s_subpixel_scale);
+            depth[i] = std::min(std::max(clip.z * inverse_w[i] * 0.5f + 0.5f, 0.f), 1.f);
+        }
+
+        //     (   ),   
+        double area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if (area == 0.0) {
+            return;
+        }
+        if (area < 0.0) {
+            std::swap(pVertices[1], pVertices[2]);
+            std::swap(x[1], x[2]);
+            std::swap(y[1], y[2]);
+            std::swap(depth[1], depth[2]);
+            std::swap(inverse_w[1], inverse_w[2]);
+            area = -area;
+        }
+
+        // ,      
+        Triangle triangle;
+        const double min_x = std::min(x[0], std::min(x[1], x[2])) / s_subpixel_scale;
+        const double max_x = std::max(x[0], std::max(x[1], x[2])) / s_subpixel_scale;
+        const double min_y = std::min(y[0], std::min(y[1], y[2])) / s_subpixel_scale;
+        const double max_y = std::max(y[0], std::max(y[1], y[2])) / s_subpixel_scale;
+        triangle.min_x = std::max(static_cast<int>(std::ceil(min_x - 0.5)), 0);
+        triangle.min_y = std::max(static_cast<int>(std::ceil(min_y - 0.5)), 0);
+        triangle.max_x = std::min(static_cast<int>(std::floor(max_x - 0.5)) + 1, static_cast<int>(m_width));
+        triangle.max_y = std::min(static_cast<int>(std::floor(max_y - 0.5)) + 1, static_cast<int>(m_height));
+        if (triangle.min_x >= triangle.max_x || triangle.min_y >= triangle.max_y) {
+            return;
+        }
+
+        //  k    k.          :
+        // ,   a > 0  a == 0  b < 0
+        for (int edge = 0; edge < 3; ++edge) {
+            const int i = (edge + 1) % 3;
+            const int j = (edge + 2) % 3;
+            const double a = y[i] - y[j];
+            const double b = x[j] - x[i];
+            triangle.edges[edge][0] = a;
+            triangle.edges[edge][1] = b;
+            triangle.edges[edge][2] = x[i] * y[j] - x[j] * y[i] - (a > 0.0 || (a == 0.0 && b < 0.0) ? 0.0 : 1.0);
+        }
+
+        //    0  
+        const double d1x = (x[1] - x[0]) / s_subpixel_scale;
+        const double d1y = (y[1] - y[0]) / s_subpixel_scale;
+        const double d2x = (x[2] - x[0]) / s_subpixel_scale;
+        const double d2y = (y[2] - y[0]) / s_subpixel_scale;
+        const double inverse_determinant = 1.0 / (d1x * d2y - d2x * d1y);
+        const auto set_plane = [&](float* pPlane, const float f0, const float f1, const float f2) {
+            pPlane[0] = static_cast<float>(((f1 - f0) * d2y - (f2 - f0) * d1y) * inverse_determinant);
+            pPlane[1] = static_cast<float>(((f2 - f0) * d1x - (f1 - f0) * d2x) * inverse_determinant);
+            pPlane[2] = f0;
+        };
+        triangle.origin_x = static_cast<float>(x[0] / s_subpixel_scale);
+        triangle.origin_y = static_cast<float>(y[0] / s_subpixel_scale);
+        set_plane(triangle.depth, depth[0], depth[1], depth[2]);
+        set_plane(triangle.inverse_w, inverse_w[0], inverse_w[1], inverse_w[2]);
+        float attributes[3][s_attributes_count];
+        for (int i = 0; i < 3; ++i) {
+            const TransformedVertex& vertex = *pVertices[i];
+            const float values[s_attributes_count] = { vertex.position_eye.x, vertex.position_eye.y, vertex.position_eye.z,
+                vertex.normal_eye.x, vertex.normal_eye.y, vertex.normal_eye.z, vertex.uv.x, vertex.uv.y };
+            for (int attribute = 0; attribute < s_attributes_count; ++attribute) {
+                attributes[i][attribute] = values[attribute] * inverse_w[i];
+            }
+        }
+        for (int attribute = 0; attribute < s_attributes_count; ++attribute) {
+            set_plane(triangle.attributes[attribute], attributes[0][attribute], attributes[1][attribute], attributes[2][attribute]);
+        }
+        triangle.draw_index = draw_index;
+        chunk.triangles.push_back(triangle);
+    }
+
+    void SoftwareRenderer::rasterize_tile(const size_t tile_index) {
+        const int min_x = static_cast<int>((tile_index % m_tiles_x) * s_tile_size);
+        const int min_y = static_cast<int>((tile_index / m_tiles_x) * s_tile_size);
+        const int max_x = std::min(min_x + static_cast<int>(s_tile_size), static_cast<int>(m_width));
+        const int max_y = std::min(min_y + static_cast<int>(s_tile_size), static_cast<int>(m_height));
+        for (int y = min_y; y < max_y; ++y) {
+            std::fill_n(m_color.begin() + static_cast<size_t>(y) * m_width + min_x, max_x - min_x, m_clear_color);
+            std::fill_n(m_depth.begin() + static_cast<size_t>(y) * m_depth_stride + min_x, max_x - min_x, 1.f);
+        }
+
+        size_t shaded_pixels_count = 0;
+        for (size_t chunk_index = 0; chunk_index < m_chunks_count; ++chunk_index) {
+            const Chunk& chunk = m_chunks[chunk_index];
+            const uint32_t* pEntries = chunk.entries.data() + chunk.offsets[tile_index];
+            for (uint32_t i = 0; i < chunk.counts[tile_index]; ++i) {
+                shaded_pixels_count += rasterize_triangle(chunk.triangles[pEntries[i]], min_x, min_y, max_x, max_y);
+            }
+        }
+        m_shaded_pixels_count.fetch_add(shaded_pixels_count, std::memory_order_relaxed);
+    }
+
+    size_t SoftwareRenderer::rasterize_triangle(const Triangle& triangle, const int tile_min_x, const int tile_min_y, const int tile_max_x,
+        const int tile_max_y) {
+        RowSpan span;
+        span.min_x = std::max(triangle.min_x, tile_min_x);
+        span.max_x = std::min(triangle.max_x, tile_max_x);
+        const int min_y = std::max(triangle.min_y, tile_min_y);
+        const int max_y = std::min(triangle.max_y, tile_max_y);
+        if (span.min_x >= span.max_x || min_y >= max_y) {
+            return 0;
+        }
+        //    4 :    4,      4
+        span.start_x = span.min_x & ~3;
+        span.groups_count = (span.max_x - span.start_x + 3) / 4;
+
+        size_t shaded_pixels_count = 0;
+        uint8_t masks[s_tile_size / 4];
+        for (int y = min_y; y < max_y; ++y) {
+            span.y = y;
+            float* pDepthRow = m_depth.data() + static_cast<size_t>(y) * m_depth_stride;
+            uint32_t* pColorRow = m_color.data() + static_cast<size_t>(y) * m_width;
+#if defined(MYENGINE_RASTER_X86)
+            if (m_simd) {
+                calculate_row_masks_sse(triangle, span, pDepthRow, masks);
+            }
+            else {
+                calculate_row_masks_scalar(triangle, span, pDepthRow, masks);
+            }
+#else
+            calculate_row_masks_scalar(triangle, span, pDepthRow, masks);
+#endif
+            for (int group = 0; group < span.groups_count; ++group) {
+                const int mask = masks[group];
+                if (!mask) {
+                    continue;
+                }
+                const int x = span.start_x + 4 * group;
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (!(mask & (1 << lane))) {
+                        continue;
+                    }
+                    const float pixel_x = static_cast<float>(x + lane) + 0.5f - triangle.origin_x;
+                    const float pixel_y = static_cast<float>(y) + 0.5f - triangle.origin_y;
+                    pDepthRow[x + lane] = triangle.depth[2] + triangle.depth[0] * pixel_x + triangle.depth[1] * pixel_y;
+                    pColorRow[x + lane] = shade_pixel(triangle, x + lane, y);
+                    ++shaded_pixels_count;
+                }
+            }
+        }
+        return shaded_pixels_count;
+    }
+
+    //       Application  :  ,  
+    //      ,    () 
+    uint32_t SoftwareRenderer::shade_pixel(const Triangle& triangle, const int x, const int y) const {
+        const float dx = static_cast<float>(x) + 0.5f - triangle.origin_x;
+        const float dy = static_cast<float>(y) + 0.5f - triangle.origin_y;
+        const float inverse_w = triangle.inverse_w[2] + triangle.inverse_w[0] * dx + triangle.inverse_w[1] * dy;
+        const float w = 1.f / inverse_w;
+        float attributes[s_attributes_count];
+        for (int attribute = 0; attribute < s_attributes_count; ++attribute) {
+            const float* pPlane = triangle.attributes[attribute];
+            attributes[attribute] = (pPlane[2] + pPlane[0] * dx + pPlane[1] * dy) * w;
+        }
+
+        const DrawCommand& draw = m_draws[triangle.draw_index];
+        const SoftwareMaterial& material = draw.material;
+        if (!material.lit) {
+            return pack_color(glm::vec4(material.color, 1.f));
+        }
+
+        //  uv = (u / w) / (1 / w)   : (d(u / w) - u * d(1 / w)) * w
+        glm::vec4 albedo(material.color, 1.f);
+        if (material.pTexture) {
+            const float u = attributes[6];
+            const float v = attributes[7];
+            const float* pU = triangle.attributes[6];
+            const float* pV = triangle.attributes[7];
+            const float lod = material.pTexture->calculate_lod((pU[0] - u * triangle.inverse_w[0]) * w, (pV[0] - v * triangle.inverse_w[0]) * w,
+                (pU[1] - u * triangle.inverse_w[1]) * w, (pV[1] - v * triangle.inverse_w[1]) * w);
+            albedo = material.pTexture->sample(u, v, lod);
+        }
+
+        const glm::vec3 position(attributes[0], attributes[1], attributes[2]);
+        const glm::vec3 normal = glm::normalize(glm::vec3(attributes[3], attributes[4], attributes[5]));
+        const glm::vec3 view_direction = glm::normalize(-position);
+        const SoftwareLighting& lighting = m_lighting;
+
+        glm::vec3 diffuse = lighting.diffuse_factor * lighting.sun_radiance * std::max(glm::dot(normal, -m_sun_direction_eye), 0.f);
+        glm::vec3 specular = lighting.specular_factor * lighting.sun_radiance
+            * std::pow(std::max(glm::dot(view_direction, reflect(m_sun_direction_eye, normal)), 0.f), lighting.shininess);
+        for (size_t i = draw.first_light; i < draw.first_light + draw.lights_count; ++i) {
+            const EyeLight& light = m_lights[m_draw_lights[i]];
+            const glm::vec3 to_light = light.position - position;
+            const float distance_squared = glm::dot(to_light, to_light);
+            const float falloff = std::min(std::max(1.f - distance_squared / light.radius_squared, 0.f), 1.f);
+            if (falloff <= 0.f) {
+                continue;
+            }
+            const glm::vec3 radiance = light.radiance * (falloff * falloff);
+            const glm::vec3 light_direction = to_light / std::sqrt(distance_squared);
+            diffuse += lighting.diffuse_factor * radiance * std::max(glm::dot(normal, light_direction), 0.f);
+            specular += lighting.specular_factor * radiance
+                * std::pow(std::max(glm::dot(view_direction, reflect(-light_direction, normal)), 0.f), lighting.shininess);
+        }
+        return pack_color(albedo * glm::vec4(lighting.ambient_color + diffuse + specular, 1.f));
+    }
+
+    SoftwareRenderer::ImageDifference SoftwareRenderer::compare(const uint32_t* pFirst, const uint32_t* pSecond, const size_t pixels_count,
+        const unsigned int tolerance) {
+        ImageDifference difference;
+        if (pixels_count == 0) {
+            return difference;
+        }
+        uint64_t error_sum = 0;
+        size_t mismatched_count = 0;
+        for (size_t i = 0; i < pixels_count; ++i) {
+            unsigned int pixel_error = 0;
+            for (int channel = 0; channel < 3; ++channel) {
+                const int first = static_cast<int>((pFirst[i] >> (8 * channel)) & 0xFF);
+                const int second = static_cast<int>((pSecond[i] >> (8 * channel)) & 0xFF);
+                const unsigned int error = static_cast<unsigned int>(std::abs(first - second));
+                error_sum += error;
+                pixel_error = std::max(pixel_error, error);
+            }
+            difference.max_error = std::max(difference.max_error, pixel_error);
+            if (pixel_error > tolerance) {
+                ++mismatched_count;
+            }
+        }
+        difference.mean_error = static_cast<double>(error_sum) / (3.0 * static_cast<double>(pixels_count));
+        difference.mismatched_fraction = static_cast<double>(mismatched_count) / static_cast<double>(pixels_count);
+        return difference;
+    }
+
+    //    TGA:  18 , 32      BGRA,    
+    bool SoftwareRenderer::write_image(const char* path) const {
+        if (m_width > 0xFFFF || m_height > 0xFFFF) {
+            LOG_CATEGORY_ERROR(Render, "SoftwareRenderer: {0}x{1} frame is too large for TGA", m_width, m_height);
+            return false;
+        }
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            LOG_CATEGORY_ERROR(Render, "SoftwareRenderer: can't create '{0}'", path);
+            return false;
+        }
+        const unsigned char header[18] = { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            static_cast<unsigned char>(m_width & 0xFF), static_cast<unsigned char>(m_width >> 8),
+            static_cast<unsigned char>(m_height & 0xFF), static_cast<unsigned char>(m_height >> 8), 32, 8 };
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        std::vector<unsigned char> row(static_cast<size_t>(m_width) * 4);
+        for (unsigned int y = 0; y < m_height; ++y) {
+            const uint32_t* pRow = m_color.data() + static_cast<size_t>(y) * m_width;
+            for (unsigned int x = 0; x < m_width; ++x) {
+                row[x * 4 + 0] = static_cast<unsigned char>((pRow[x] >> 16) & 0xFF);
+                row[x * 4 + 1] = static_cast<unsigned char>((pRow[x] >> 8) & 0xFF);
+                row[x * 4 + 2] = static_cast<unsigned char>(pRow[x] & 0xFF);
+                row[x * 4 + 3] = static_cast<unsigned char>(pRow[x] >> 24);
+            }
+            file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+        if (!file) {
+            LOG_CATEGORY_ERROR(Render, "SoftwareRenderer: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+
+    void SoftwareRenderer::on_ui_draw() {
+        ImGui::Begin("Software renderer");
+        ImGui::Text("Resolution: %ux%u, %zu tiles of %ux%u", m_width, m_height, m_stats.tiles_count, s_tile_size, s_tile_size);
+        ImGui::Text("Threads: %zu, coverage: %s", m_stats.threads_count, m_stats.simd ? "SSE2" : "scalar");
+        ImGui::Text("Draws: %zu, triangles: %zu", m_stats.draws_count, m_stats.triangles_count);
+        ImGui::Text("Rasterized triangles: %zu, tile entries: %zu", m_stats.rasterized_triangles_count, m_stats.binned_triangles_count);
+        ImGui::Text("Shaded pixels: %zu", m_stats.shaded_pixels_count);
+        ImGui::Text("Vertex: %.3f ms, binning: %.3f ms, raster: %.3f ms", m_stats.vertex_ms, m_stats.binning_ms, m_stats.raster_ms);
+        ImGui::Text("Total: %.3f ms", m_stats.total_ms);
+        ImGui::End();
+    }
+
+}
\ No newline at end of file
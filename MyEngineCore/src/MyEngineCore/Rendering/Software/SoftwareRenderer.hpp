@@ -0,0 +1,238 @@
+#pragma once
+
+#include "MyEngineCore/Resources/MeshImporter.hpp"
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MyEngine {
+
+    struct PointLight;
+    class SoftwareTexture;
+
+    //   :  (, , uv)     ,  
+    struct SoftwareMesh {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+        glm::vec4 bounding_sphere{ 0.f };
+
+        //  MeshData :    Float3, Float3, Float2. false -  layout
+        bool create(const MeshData& mesh_data);
+    };
+
+    // :      (     Application)    
+    struct SoftwareMaterial {
+        const SoftwareTexture* pTexture = nullptr;
+        glm::vec3 color{ 1.f };
+        bool lit = true;
+    };
+
+    //  :      (  ).
+    //     -   ,     
+    struct SoftwareLighting {
+        glm::vec3 ambient_color{ 0.f };
+        float diffuse_factor = 1.f;
+        float specular_factor = 0.5f;
+        float shininess = 32.f;
+        glm::vec3 sun_direction{ 0.f, 0.f, -1.f };
+        glm::vec3 sun_radiance{ 0.f };
+        const PointLight* pLights = nullptr;
+        size_t lights_count = 0;
+    };
+
+    //    CPU  OpenGL (   GPU).        end_frame:
+    // 1.        ,     ,
+    //       .
+    // 2.           x / y ( 
+    //       +-2^14 ),       1/256  
+    //       s_tile_size x s_tile_size (    -   ,
+    //    ,    ,   ).
+    // 3.   :       1/256  ( double ),
+    //     4    (SSE2)     ,    ()  .
+    //    ,  ,   :     , 
+    //     -    uv.        .
+    //       OpenGL:   ,  [0, 1].    (  ).
+    //     OpenGL (  Application)       (Application::render_software)
+    class SoftwareRenderer {
+    public:
+        //     ( 4)        
+        static constexpr unsigned int s_tile_size = 64;
+        static constexpr size_t s_triangles_per_chunk = 1024;
+        //    
+        static constexpr size_t s_vertices_per_task = 4096;
+
+        //   
+        struct Stats {
+            size_t draws_count = 0;
+            size_t triangles_count = 0;
+            size_t rasterized_triangles_count = 0;
+            size_t binned_triangles_count = 0;
+            size_t shaded_pixels_count = 0;
+            size_t tiles_count = 0;
+            size_t threads_count = 0;
+            double vertex_ms = 0.0;
+            double binning_ms = 0.0;
+            double raster_ms = 0.0;
+            double total_ms = 0.0;
+            bool simd = false;
+        };
+
+        //    RGBA8   RGB
+        struct ImageDifference {
+            double mean_error = 0.0;
+            unsigned int max_error = 0;
+            double mismatched_fraction = 0.0;
+        };
+
+        //  ( )  
+        SoftwareRenderer(const unsigned int width, const unsigned int height);
+        ~SoftwareRenderer();
+
+        //      
+        SoftwareRenderer(const SoftwareRenderer&) = delete;
+        SoftwareRenderer& operator=(const SoftwareRenderer&) = delete;
+        SoftwareRenderer& operator=(SoftwareRenderer&&) = delete;
+        SoftwareRenderer(SoftwareRenderer&&) = delete;
+
+        //    ( )
+        void resize(const unsigned int width, const unsigned int height);
+
+        //  :  ,    (    end_frame)
+        void begin_frame(const glm::vec4& clear_color, const glm::mat4& view, const glm::mat4& projection, const SoftwareLighting& lighting);
+        //  : ,     (      end_frame)
+        void draw(const SoftwareMesh& mesh, const glm::mat4& model, const SoftwareMaterial& material);
+        //  . threads_count -      (0 - )
+        void end_frame(const size_t threads_count = 0);
+
+        //  RGBA8 ( r, g, b, a,      -  glReadPixels)
+        const uint32_t* get_color_data() const { return m_color.data(); }
+        unsigned int get_width() const { return m_width; }
+        unsigned int get_height() const { return m_height; }
+        const Stats& get_stats() const { return m_stats; }
+        //     TGA (RGBA8  ,    -   )
+        bool write_image(const char* path) const;
+
+        //    pixels_count :   ,       tolerance
+        static ImageDifference compare(const uint32_t* pFirst, const uint32_t* pSecond, const size_t pixels_count, const unsigned int tolerance);
+
+        //  
+        void on_ui_draw();
+
+    private:
+        //         ,   
+        struct DrawCommand {
+            const SoftwareMesh* pMesh;
+            glm::mat4 model;
+            SoftwareMaterial material;
+            size_t first_vertex;
+            size_t first_triangle;
+            size_t first_light;
+            size_t lights_count;
+        };
+
+        //   
+        struct TransformedVertex {
+            glm::vec4 clip;
+            glm::vec3 position_eye;
+            glm::vec3 normal_eye;
+            glm::vec2 uv;
+        };
+
+        //    
+        struct EyeLight {
+            glm::vec3 position;
+            float radius_squared;
+            glm::vec3 radiance;
+        };
+
+        // ,    :      , uv
+        static constexpr int s_attributes_count = 8;
+
+        //   . и: e = a * x + b * y + c   1/256  (   double),
+        //       c   1.  (d/dx, d/dy,    0) -
+        //     0: , 1 / w  ,   1 / w
+        struct Triangle {
+            double edges[3][3];
+            float origin_x;
+            float origin_y;
+            float depth[3];
+            float inverse_w[3];
+            float attributes[s_attributes_count][3];
+            int min_x;
+            int min_y;
+            int max_x;
+            int max_y;
+            uint32_t draw_index;
+        };
+
+        //   :       
+        // (   t - entries[offsets[t]] .. entries[offsets[t] + counts[t]], entries_count -  )
+        struct Chunk {
+            std::vector<Triangle> triangles;
+            std::vector<uint32_t> offsets;
+            std::vector<uint32_t> counts;
+            std::vector<uint32_t> entries;
+            size_t entries_count = 0;
+        };
+
+        //  function(item)  items_count   tasks_count  (   )
+        template<typename Function>
+        static void run_tasks(const size_t tasks_count, const size_t items_count, Function&& function);
+
+        //  
+        void transform_vertices(const size_t block_index);
+        void setup_chunk(const size_t chunk_index);
+        void rasterize_tile(const size_t tile_index);
+        //     ( -   )
+        void clip_triangle(Chunk& chunk, const TransformedVertex* pVertices[3], const uint32_t draw_index) const;
+        void setup_triangle(Chunk& chunk, const TransformedVertex& v0, const TransformedVertex& v1, const TransformedVertex& v2,
+            const uint32_t draw_index) const;
+        //      ,    
+        size_t rasterize_triangle(const Triangle& triangle, const int tile_min_x, const int tile_min_y, const int tile_max_x, const int tile_max_y);
+        //      (   )
+        static bool touches_rectangle(const Triangle& triangle, const int min_x, const int min_y, const int max_x, const int max_y);
+        //   ( x + 0.5, y + 0.5)
+        uint32_t shade_pixel(const Triangle& triangle, const int x, const int y) const;
+
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        unsigned int m_tiles_x = 0;
+        unsigned int m_tiles_y = 0;
+        //   .      4:         
+        std::vector<uint32_t> m_color;
+        std::vector<float> m_depth;
+        unsigned int m_depth_stride = 0;
+
+        //  
+        uint32_t m_clear_color = 0;
+        glm::mat4 m_view{ 1.f };
+        glm::mat4 m_projection{ 1.f };
+        SoftwareLighting m_lighting;
+        glm::vec3 m_sun_direction_eye{ 0.f, 0.f, -1.f };
+        //     NDC  x  y
+        float m_guard_band_x = 1.f;
+        float m_guard_band_y = 1.f;
+
+        //   (   )
+        std::vector<DrawCommand> m_draws;
+        std::vector<TransformedVertex> m_vertices;
+        std::vector<EyeLight> m_lights;
+        std::vector<uint32_t> m_draw_lights;
+        std::vector<Chunk> m_chunks;
+        size_t m_vertices_count = 0;
+        size_t m_triangles_count = 0;
+        size_t m_chunks_count = 0;
+        bool m_simd = false;
+        std::atomic<size_t> m_shaded_pixels_count{ 0 };
+
+        Stats m_stats;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "SoftwareTexture.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace MyEngine {
+
+    //     (   r, g, b, a  little-endian )
+    static uint32_t pack_texel(const unsigned char r, const unsigned char g, const unsigned char b, const unsigned char a) {
+        return static_cast<uint32_t>(r) | (static_cast<uint32_t>(g) << 8) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(a) << 24);
+    }
+
+    static glm::vec4 unpack_texel(const uint32_t texel) {
+        return glm::vec4(static_cast<float>(texel & 0xFF), static_cast<float>((texel >> 8) & 0xFF), static_cast<float>((texel >> 16) & 0xFF),
+            static_cast<float>(texel >> 24)) * (1.f / 255.f);
+    }
+
+    //       (GL_REPEAT)
+    static int wrap(const int coordinate, const int size) {
+        const int result = coordinate % size;
+        return result < 0 ? result + size : result;
+    }
+
+    SoftwareTexture::SoftwareTexture(const unsigned int width, const unsigned int height) {
+        unsigned int level_width = std::max(width, 1u);
+        unsigned int level_height = std::max(height, 1u);
+        size_t offset = 0;
+        while (true) {
+            m_levels.push_back(Level{ level_width, level_height, offset });
+            offset += static_cast<size_t>(level_width) * level_height;
+            if (level_width == 1 && level_height == 1) {
+                break;
+            }
+            level_width = std::max(level_width / 2, 1u);
+            level_height = std::max(level_height / 2, 1u);
+        }
+        m_texels.resize(offset, 0);
+    }
+
+    void SoftwareTexture::set_level(const unsigned int level, const unsigned char* pData, const unsigned int channels_count) {
+        if (level >= m_levels.size() || (channels_count != 3 && channels_count != 4)) {
+            return;
+        }
+        const Level& destination = m_levels[level];
+        const size_t texels_count = static_cast<size_t>(destination.width) * destination.height;
+        uint32_t* pTexels = m_texels.data() + destination.offset;
+        for (size_t i = 0; i < texels_count; ++i) {
+            const unsigned char* pTexel = pData + i * channels_count;
+            pTexels[i] = pack_texel(pTexel[0], pTexel[1], pTexel[2], channels_count == 4 ? pTexel[3] : 255);
+        }
+    }
+
+    //  :      
+    void SoftwareTexture::generate_mipmaps(const unsigned int first_level) {
+        for (size_t level = std::max(first_level, 1u); level < m_levels.size(); ++level) {
+            const Level& source = m_levels[level - 1];
+            const Level& destination = m_levels[level];
+            const uint32_t* pSource = m_texels.data() + source.offset;
+            uint32_t* pDestination = m_texels.data() + destination.offset;
+            for (unsigned int y = 0; y < destination.height; ++y) {
+                const unsigned int y0 = std::min(2 * y, source.height - 1);
+                const unsigned int y1 = std::min(2 * y + 1, source.height - 1);
+                for (unsigned int x = 0; x < destination.width; ++x) {
+                    const unsigned int x0 = std::min(2 * x, source.width - 1);
+                    const unsigned int x1 = std::min(2 * x + 1, source.width - 1);
+                    const uint32_t texels[4] = { pSource[static_cast<size_t>(y0) * source.width + x0], pSource[static_cast<size_t>(y0) * source.width + x1],
+                        pSource[static_cast<size_t>(y1) * source.width + x0], pSource[static_cast<size_t>(y1) * source.width + x1] };
+                    unsigned char channels[4];
+                    for (int channel = 0; channel < 4; ++channel) {
+                        unsigned int sum = 2;
+                        for (const uint32_t texel : texels) {
+                            sum += (texel >> (8 * channel)) & 0xFF;
+                        }
+                        channels[channel] = static_cast<unsigned char>(sum / 4);
+                    }
+                    pDestination[static_cast<size_t>(y) * destination.width + x] = pack_texel(channels[0], channels[1], channels[2], channels[3]);
+                }
+            }
+        }
+    }
+
+    // log2         (  OpenGL  )
+    float SoftwareTexture::calculate_lod(const float du_dx, const float dv_dx, const float du_dy, const float dv_dy) const {
+        const float width = static_cast<float>(m_levels[0].width);
+        const float height = static_cast<float>(m_levels[0].height);
+        const float rho_x = (du_dx * width) * (du_dx * width) + (dv_dx * height) * (dv_dx * height);
+        const float rho_y = (du_dy * width) * (du_dy * width) + (dv_dy * height) * (dv_dy * height);
+        // log2(sqrt(rho)) = 0.5 * log2(rho)
+        return 0.5f * std::log2(std::max(std::max(rho_x, rho_y), 1e-12f));
+    }
+
+    glm::vec4 SoftwareTexture::sample(const float u, const float v, const float lod) const {
+        if (lod <= 0.f) {
+            return sample_bilinear(m_levels[0], u, v);
+        }
+        const float max_level = static_cast<float>(m_levels.size() - 1);
+        const float level = std::min(lod, max_level);
+        const size_t level_index = static_cast<size_t>(level);
+        const float fraction = level - static_cast<float>(level_index);
+        const glm::vec4 color = sample_bilinear(m_levels[level_index], u, v);
+        if (fraction <= 0.f || level_index + 1 >= m_levels.size()) {
+            return color;
+        }
+        return color + (sample_bilinear(m_levels[level_index + 1], u, v) - color) * fraction;
+    }
+
+    glm::vec4 SoftwareTexture::sample_bilinear(const Level& level, const float u, const float v) const {
+        const float x = u * static_cast<float>(level.width) - 0.5f;
+        const float y = v * static_cast<float>(level.height) - 0.5f;
+        const float floor_x = std::floor(x);
+        const float floor_y = std::floor(y);
+        const float fraction_x = x - floor_x;
+        const float fraction_y = y - floor_y;
+        const int width = static_cast<int>(level.width);
+        const int height = static_cast<int>(level.height);
+        //        int:  uv   
+        const int x0 = wrap(static_cast<int>(std::fmod(floor_x, static_cast<float>(width))), width);
+        const int y0 = wrap(static_cast<int>(std::fmod(floor_y, static_cast<float>(height))), height);
+        const int x1 = x0 + 1 == width ? 0 : x0 + 1;
+        const int y1 = y0 + 1 == height ? 0 : y0 + 1;
+
+        const uint32_t* pTexels = m_texels.data() + level.offset;
+        const glm::vec4 bottom_left = unpack_texel(pTexels[static_cast<size_t>(y0) * level.width + x0]);
+        const glm::vec4 bottom_right = unpack_texel(pTexels[static_cast<size_t>(y0) * level.width + x1]);
+        const glm::vec4 top_left = unpack_texel(pTexels[static_cast<size_t>(y1) * level.width + x0]);
+        const glm::vec4 top_right = unpack_texel(pTexels[static_cast<size_t>(y1) * level.width + x1]);
+        const glm::vec4 bottom = bottom_left + (bottom_right - bottom_left) * fraction_x;
+        const glm::vec4 top = top_left + (top_right - top_left) * fraction_x;
+        return bottom + (top - bottom) * fraction_y;
+    }
+
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <glm/vec4.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MyEngine {
+
+    //   : RGBA8     (  - floor(size / 2^level),   1,
+    //   OpenGL).    Texture2D: GL_REPEAT, GL_LINEAR_MIPMAP_LINEAR    GL_LINEAR  
+    class SoftwareTexture {
+    public:
+        //  (  ),   
+        SoftwareTexture(const unsigned int width, const unsigned int height);
+
+        //    RGB8  RGBA8 (channels_count - 3  4):   ,   - v = 0
+        void set_level(const unsigned int level, const unsigned char* pData, const unsigned int channels_count);
+        //    first_level -   2 x 2  
+        void generate_mipmaps(const unsigned int first_level = 1);
+
+        //         
+        float calculate_lod(const float du_dx, const float dv_dx, const float du_dy, const float dv_dy) const;
+        //    (uv -  , lod <= 0 - )
+        glm::vec4 sample(const float u, const float v, const float lod) const;
+
+        unsigned int get_width() const { return m_levels[0].width; }
+        unsigned int get_height() const { return m_levels[0].height; }
+        unsigned int get_levels_count() const { return static_cast<unsigned int>(m_levels.size()); }
+        size_t get_memory_size() const { return m_texels.size() * sizeof(uint32_t); }
+
+    private:
+        // :        
+        struct Level {
+            unsigned int width;
+            unsigned int height;
+            size_t offset;
+        };
+
+        //       
+        glm::vec4 sample_bilinear(const Level& level, const float u, const float v) const;
+
+        //     ( r, g, b, a)
+        std::vector<uint32_t> m_texels;
+        std::vector<Level> m_levels;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "TextureFormat.hpp"
+
+#include <algorithm>
+
+namespace MyEngine {
+
+    //   
+    bool is_compressed_format(const ETextureFormat format) {
+        return format != ETextureFormat::RGB8 && format != ETextureFormat::RGBA8;
+    }
+
+    //    
+    size_t get_format_block_size(const ETextureFormat format) {
+        switch (format) {
+        case ETextureFormat::RGB8: return 3;
+        case ETextureFormat::RGBA8: return 4;
+        case ETextureFormat::BC1: return 8;
+        case ETextureFormat::BC4: return 8;
+        case ETextureFormat::BC3: return 16;
+        case ETextureFormat::BC5: return 16;
+        case ETextureFormat::BC7: return 16;
+        }
+        return 0;
+    }
+
+    //  
+    const char* get_format_name(const ETextureFormat format) {
+        switch (format) {
+        case ETextureFormat::RGB8: return "RGB8";
+        case ETextureFormat::RGBA8: return "RGBA8";
+        case ETextureFormat::BC1: return "BC1";
+        case ETextureFormat::BC3: return "BC3";
+        case ETextureFormat::BC4: return "BC4";
+        case ETextureFormat::BC5: return "BC5";
+        case ETextureFormat::BC7: return "BC7";
+        }
+        return "Unknown";
+    }
+
+    //  :      4x4
+    size_t calculate_mip_size(const ETextureFormat format, const unsigned int width, const unsigned int height) {
+        if (is_compressed_format(format)) {
+            return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * get_format_block_size(format);
+        }
+        return static_cast<size_t>(width) * height * get_format_block_size(format);
+    }
+
+    //    
+    unsigned int calculate_mips_count(const unsigned int width, const unsigned int height) {
+        unsigned int mips_count = 1;
+        for (unsigned int size = std::max(width, height); size > 1; size /= 2) {
+            ++mips_count;
+        }
+        return mips_count;
+    }
+
+    //   
+    size_t calculate_texture_size(const ETextureFormat format, const unsigned int width, const unsigned int height, const unsigned int mips_count) {
+        size_t size = 0;
+        for (unsigned int level = 0; level < mips_count; ++level) {
+            size += calculate_mip_size(format, std::max(width >> level, 1u), std::max(height >> level, 1u));
+        }
+        return size;
+    }
+
+    //     
+    ETextureFormat select_texture_format(const ETextureUsage usage, const bool allow_bc1, const bool allow_bc7) {
+        if (usage == ETextureUsage::Color) {
+            return allow_bc1 ? ETextureFormat::BC1 : ETextureFormat::RGB8;
+        }
+        return allow_bc7 ? ETextureFormat::BC7 : ETextureFormat::RGBA8;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MyEngine {
+
+    //   :  RGB8/RGBA8   BC1-BC7 ( 4x4)
+    enum class ETextureFormat : uint32_t {
+        RGB8,
+        RGBA8,
+        BC1,
+        BC3,
+        BC4,
+        BC5,
+        BC7
+    };
+
+    //  :   ,     
+    enum class ETextureUsage {
+        //  
+        Color,
+        //   
+        ColorAlpha,
+        //  
+        Normal
+    };
+
+    //   
+    bool is_compressed_format(const ETextureFormat format);
+    //   4x4       ,  
+    size_t get_format_block_size(const ETextureFormat format);
+    //    
+    const char* get_format_name(const ETextureFormat format);
+    //    
+    size_t calculate_mip_size(const ETextureFormat format, const unsigned int width, const unsigned int height);
+    //     
+    unsigned int calculate_mips_count(const unsigned int width, const unsigned int height);
+    //    [0, mips_count)  
+    size_t calculate_texture_size(const ETextureFormat format, const unsigned int width, const unsigned int height, const unsigned int mips_count);
+    //    : BC1 ( ,  ) -        allow_bc1,
+    //       - BC7  allow_bc7,  RGBA8
+    ETextureFormat select_texture_format(const ETextureUsage usage, const bool allow_bc1, const bool allow_bc7);
+
+}
\ No newline at end of file
@@ -0,0 +1,538 @@
+#include "AssetManager.hpp"
+
+#include "MappedFile.hpp"
+#include "MeshFile.hpp"
+#include "MeshImporter.hpp"
+#include "TextureFile.hpp"
+#include "MyEngineCore/Rendering/OpenGL/Texture_2D.hpp"
+#include "MyEngineCore/Rendering/OpenGL/Mesh.hpp"
+#include "MyEngineCore/Rendering/OpenGL/GpuMemoryTracker.hpp"
+#include "MyEngineCore/Core/JobSystem.hpp"
+#include "MyEngineCore/Core/FrameAllocator.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <imgui/imgui.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+
+namespace MyEngine {
+
+    //       
+    constexpr uint64_t s_destroy_delay_frames = 3;
+    //         
+    constexpr unsigned int s_min_dropped_texture_size = 128;
+
+    //    
+    static const char* get_asset_type_name(const EAssetType type) {
+        switch (type) {
+        case EAssetType::Texture: return "Textures";
+        case EAssetType::Mesh: return "Meshes";
+        case EAssetType::Count: break;
+        }
+        return "Unknown";
+    }
+
+    //    (FNV-1a, 64 )
+    static uint64_t calculate_content_hash(const unsigned char* data, const size_t size) {
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ data[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    //    .      ,       
+    struct AssetManager::PendingLoad {
+        //   
+        EAssetType type = EAssetType::Texture;
+        std::string key;
+        bool from_file = false;
+        TextureLoader texture_loader;
+        MeshLoader mesh_loader;
+        uint32_t index = 0;
+        uint32_t generation = 0;
+
+        //  :  (.tex, .mesh)   ,  -   
+        std::atomic<bool> done{ false };
+        bool decoded = false;
+        uint64_t hash = 0;
+        TextureFile texture_file;
+        MeshFile mesh_file;
+        TextureData texture_data;
+        MeshData mesh_data;
+        double decode_time_ms = 0.0;
+        JobHandle job;
+    };
+
+    //    
+    float AssetManager::Stats::get_hit_rate() const {
+        const size_t hits = path_hits + content_hits;
+        return hits + loads_count == 0 ? 0.f : static_cast<float>(hits) / static_cast<float>(hits + loads_count);
+    }
+
+    //  
+    AssetManager::Content::~Content() {
+        pStats->resident_bytes -= memory_size;
+        --pStats->resident_count;
+    }
+
+    // 
+    AssetManager::AssetManager(const size_t memory_budget) : m_memory_budget(memory_budget) {
+        m_pressure_handler_id = GpuMemoryTracker::add_pressure_handler([this](const size_t bytes_to_free) {
+            return on_memory_pressure(bytes_to_free);
+        });
+    }
+
+    // :    ,    
+    AssetManager::~AssetManager() {
+        GpuMemoryTracker::remove_pressure_handler(m_pressure_handler_id);
+        for (const auto& pending : m_pending_loads) {
+            JobSystem::wait(pending->job);
+        }
+        m_pending_loads.clear();
+        m_records.clear();
+    }
+
+    //    
+    TextureHandle AssetManager::load_texture(const std::string& path) {
+        TextureHandle handle;
+        handle.index = register_asset(EAssetType::Texture, path, true, nullptr, nullptr, handle.generation);
+        return handle;
+    }
+
+    //    
+    TextureHandle AssetManager::add_texture(const std::string& name, TextureLoader loader) {
+        TextureHandle handle;
+        handle.index = register_asset(EAssetType::Texture, name, false, std::move(loader), nullptr, handle.generation);
+        return handle;
+    }
+
+    //    
+    MeshHandle AssetManager::load_mesh(const std::string& path) {
+        MeshHandle handle;
+        handle.index = register_asset(EAssetType::Mesh, path, true, nullptr, nullptr, handle.generation);
+        return handle;
+    }
+
+    //    
+    MeshHandle AssetManager::add_mesh(const std::string& name, MeshLoader loader) {
+        MeshHandle handle;
+        handle.index = register_asset(EAssetType::Mesh, name, false, nullptr, std::move(loader), handle.generation);
+        return handle;
+    }
+
+    //  :      
+    uint32_t AssetManager::register_asset(const EAssetType type, const std::string& key, const bool from_file, TextureLoader texture_loader,
+        MeshLoader mesh_loader, uint32_t& generation) {
+        const std::string normalized_key = from_file ? std::filesystem::path(key).lexically_normal().generic_string() : key;
+        Stats& stats = m_stats[static_cast<size_t>(type)];
+        auto& keys = m_keys[static_cast<size_t>(type)];
+        if (const auto it = keys.find(normalized_key); it != keys.end()) {
+            // ,  ,   
+            Record& record = m_records[it->second];
+            ++record.references_count;
+            ++stats.path_hits;
+            generation = record.generation;
+            return it->second;
+        }
+
+        uint32_t index = 0;
+        if (!m_free_records.empty()) {
+            index = m_free_records.back();
+            m_free_records.pop_back();
+        }
+        else {
+            index = static_cast<uint32_t>(m_records.size());
+            m_records.emplace_back();
+        }
+        Record& record = m_records[index];
+        record.type = type;
+        record.key = normalized_key;
+        record.from_file = from_file;
+        record.texture_loader = std::move(texture_loader);
+        record.mesh_loader = std::move(mesh_loader);
+        record.references_count = 1;
+        record.last_used_frame = m_frame;
+        record.alive = true;
+        record.loading = false;
+        record.load_failed = false;
+        keys.emplace(normalized_key, index);
+        ++stats.assets_count;
+        generation = record.generation;
+        return index;
+    }
+
+    //  
+    void AssetManager::acquire(const uint32_t index, const uint32_t generation) {
+        if (index < m_records.size() && m_records[index].alive && m_records[index].generation == generation) {
+            ++m_records[index].references_count;
+        }
+    }
+
+    //  :       
+    void AssetManager::release(const uint32_t index, const uint32_t generation) {
+        if (index >= m_records.size() || !m_records[index].alive || m_records[index].generation != generation) {
+            LOG_ERROR("AssetManager: release of a stale handle {0}", index);
+            return;
+        }
+        Record& record = m_records[index];
+        if (record.references_count > 0 && --record.references_count == 0) {
+            record.destroy_frame = m_frame + s_destroy_delay_frames;
+        }
+    }
+
+    //   
+    const Texture2D* AssetManager::get(const TextureHandle handle) {
+        Record* record = find_record(handle.index, handle.generation);
+        if (!record) {
+            return nullptr;
+        }
+        if (!record->content && !record->loading && !record->load_failed) {
+            start_load(*record, handle.index);
+        }
+        record->last_used_frame = m_frame;
+        return record->content ? record->content->texture.get() : nullptr;
+    }
+
+    //   
+    const Mesh* AssetManager::get(const MeshHandle handle) {
+        Record* record = find_record(handle.index, handle.generation);
+        if (!record) {
+            return nullptr;
+        }
+        if (!record->content && !record->loading && !record->load_failed) {
+            start_load(*record, handle.index);
+        }
+        record->last_used_frame = m_frame;
+        return record->content ? record->content->mesh.get() : nullptr;
+    }
+
+    //   :      ,   
+    void AssetManager::on_ready(const uint32_t index, const uint32_t generation, ReadyCallback callback) {
+        Record* record = find_record(index, generation);
+        if (!record) {
+            if (callback) {
+                callback(false);
+            }
+            return;
+        }
+        if (record->content || record->load_failed) {
+            if (callback) {
+                callback(record->content != nullptr);
+            }
+            return;
+        }
+        if (callback) {
+            record->callbacks.push_back(std::move(callback));
+        }
+        if (!record->loading) {
+            start_load(*record, index);
+        }
+    }
+
+    //    
+    AssetManager::Record* AssetManager::find_record(const uint32_t index, const uint32_t generation) {
+        if (index >= m_records.size() || !m_records[index].alive || m_records[index].generation != generation) {
+            return nullptr;
+        }
+        return &m_records[index];
+    }
+
+    //   :  ,     
+    void AssetManager::start_load(Record& record, const uint32_t index) {
+        auto pending = std::make_shared<PendingLoad>();
+        pending->type = record.type;
+        pending->key = record.key;
+        pending->from_file = record.from_file;
+        pending->texture_loader = record.texture_loader;
+        pending->mesh_loader = record.mesh_loader;
+        pending->index = index;
+        pending->generation = record.generation;
+        pending->job = JobSystem::schedule_background([pending]() {
+            const auto start_time = std::chrono::steady_clock::now();
+            pending->decoded = decode(*pending);
+            pending->decode_time_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+            pending->done.store(true, std::memory_order_release);
+        });
+        record.loading = true;
+        ++m_stats[static_cast<size_t>(record.type)].loads_in_flight;
+        m_pending_loads.push_back(std::move(pending));
+    }
+
+    //          
+    bool AssetManager::decode(PendingLoad& pending) {
+        if (!pending.from_file) {
+            if (pending.type == EAssetType::Texture) {
+                return pending.texture_loader && pending.texture_loader(pending.texture_data);
+            }
+            return pending.mesh_loader && pending.mesh_loader(pending.mesh_data);
+        }
+        {
+            MappedFile file;
+            if (!file.open(pending.key)) {
+                return false;
+            }
+            pending.hash = calculate_content_hash(file.get_data(), static_cast<size_t>(file.get_size()));
+        }
+        if (pending.type == EAssetType::Texture) {
+            return pending.texture_file.load(pending.key);
+        }
+        if (std::filesystem::path(pending.key).extension() == ".mesh") {
+            return pending.mesh_file.load(pending.key);
+        }
+        return MeshImporter::import(pending.key, pending.mesh_data);
+    }
+
+    //     OpenGL.    ,   
+    void AssetManager::finalize_load(PendingLoad& pending) {
+        Stats& stats = m_stats[static_cast<size_t>(pending.type)];
+        --stats.loads_in_flight;
+        Record* record = find_record(pending.index, pending.generation);
+        if (!record || !record->loading) {
+            return;
+        }
+        const auto start_time = std::chrono::steady_clock::now();
+        const size_t content_hits = stats.content_hits;
+        record->loading = false;
+        if (pending.decoded) {
+            record->content = create_content(pending, stats);
+        }
+        if (!record->content) {
+            LOG_ERROR("AssetManager: failed to load '{0}'", record->key);
+            record->load_failed = true;
+        }
+        //       
+        else if (stats.content_hits == content_hits) {
+            ++stats.loads_count;
+            stats.load_time_ms += pending.decode_time_ms +
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+            stats.peak_resident_bytes = std::max(stats.peak_resident_bytes, stats.resident_bytes);
+        }
+
+        //       m_records,    
+        const std::vector<ReadyCallback> callbacks = std::move(record->callbacks);
+        record->callbacks.clear();
+        const bool loaded = record->content != nullptr;
+        for (const ReadyCallback& callback : callbacks) {
+            callback(loaded);
+        }
+    }
+
+    //  :         
+    std::shared_ptr<AssetManager::Content> AssetManager::create_content(PendingLoad& pending, Stats& stats) {
+        auto& contents = m_contents[static_cast<size_t>(pending.type)];
+        if (pending.from_file) {
+            if (const auto it = contents.find(pending.hash); it != contents.end()) {
+                if (std::shared_ptr<Content> content = it->second.lock()) {
+                    ++stats.content_hits;
+                    return content;
+                }
+            }
+        }
+
+        auto content = std::make_shared<Content>();
+        content->pStats = &stats;
+        ++stats.resident_count;
+        if (pending.type == EAssetType::Texture) {
+            content->texture = pending.texture_file.is_loaded() ? std::make_unique<Texture2D>(pending.texture_file)
+                : std::make_unique<Texture2D>(pending.texture_data);
+            content->memory_size = content->texture->get_memory_size();
+        }
+        else {
+            content->mesh = pending.mesh_file.is_loaded() ? std::make_unique<Mesh>(pending.mesh_file)
+                : std::make_unique<Mesh>(pending.mesh_data);
+            content->memory_size = content->mesh->get_memory_size();
+        }
+        stats.resident_bytes += content->memory_size;
+        if (pending.from_file) {
+            contents[pending.hash] = content;
+        }
+        return content;
+    }
+
+    //    
+    void AssetManager::update(const double finalize_budget_ms) {
+        //     ,     
+        const auto finalize_start_time = std::chrono::steady_clock::now();
+        size_t finalized_count = 0;
+        for (auto it = m_pending_loads.begin(); it != m_pending_loads.end();) {
+            const double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - finalize_start_time).count();
+            if (finalized_count > 0 && elapsed_ms > finalize_budget_ms) {
+                break;
+            }
+            if (!(*it)->done.load(std::memory_order_acquire)) {
+                ++it;
+                continue;
+            }
+            //      ,     
+            const std::shared_ptr<PendingLoad> pending = std::move(*it);
+            it = m_pending_loads.erase(it);
+            const size_t offset = static_cast<size_t>(it - m_pending_loads.begin());
+            finalize_load(*pending);
+            it = m_pending_loads.begin() + offset;
+            ++finalized_count;
+        }
+
+        //  ,     
+        bool destroyed = false;
+        for (uint32_t index = 0; index < m_records.size(); ++index) {
+            Record& record = m_records[index];
+            if (!record.alive || record.references_count > 0 || record.destroy_frame > m_frame) {
+                continue;
+            }
+            m_keys[static_cast<size_t>(record.type)].erase(record.key);
+            --m_stats[static_cast<size_t>(record.type)].assets_count;
+            record.content.reset();
+            record.callbacks.clear();
+            record.loading = false;
+            record.texture_loader = nullptr;
+            record.mesh_loader = nullptr;
+            record.key.clear();
+            record.alive = false;
+            ++record.generation;
+            m_free_records.push_back(index);
+            destroyed = true;
+        }
+
+        enforce_budget();
+
+        //   
+        if (destroyed) {
+            for (auto& contents : m_contents) {
+                for (auto it = contents.begin(); it != contents.end();) {
+                    it = it->second.expired() ? contents.erase(it) : std::next(it);
+                }
+            }
+        }
+        ++m_frame;
+    }
+
+    //     ,      (     )
+    void AssetManager::enforce_budget() {
+        size_t resident_bytes = get_resident_bytes();
+        if (resident_bytes <= m_memory_budget) {
+            return;
+        }
+        FrameVector<Record*> candidates(FrameAllocator::get_resource());
+        candidates.reserve(m_records.size());
+        for (Record& record : m_records) {
+            if (record.alive && record.content && record.last_used_frame < m_frame) {
+                candidates.push_back(&record);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Record* left, const Record* right) {
+            return left->last_used_frame < right->last_used_frame;
+        });
+        for (Record* record : candidates) {
+            if (resident_bytes <= m_memory_budget) {
+                break;
+            }
+            // ,    ,       
+            if (record->content.use_count() == 1) {
+                resident_bytes -= record->content->memory_size;
+            }
+            record->content.reset();
+            ++m_stats[static_cast<size_t>(record->type)].evictions;
+        }
+    }
+
+    //  :       ,   
+    size_t AssetManager::on_memory_pressure(const size_t bytes_to_free) {
+        FrameVector<Record*> candidates(FrameAllocator::get_resource());
+        candidates.reserve(m_records.size());
+        for (Record& record : m_records) {
+            if (record.alive && record.content && record.content->texture && record.last_used_frame < m_frame) {
+                candidates.push_back(&record);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Record* left, const Record* right) {
+            return left->last_used_frame < right->last_used_frame;
+        });
+
+        Stats& stats = m_stats[static_cast<size_t>(EAssetType::Texture)];
+        size_t freed = 0;
+        for (Record* record : candidates) {
+            if (freed >= bytes_to_free) {
+                return freed;
+            }
+            Content& content = *record->content;
+            if (std::max(content.texture->get_width(), content.texture->get_height()) < s_min_dropped_texture_size
+                || !content.texture->drop_mips(1)) {
+                continue;
+            }
+            const size_t memory_size = content.texture->get_memory_size();
+            freed += content.memory_size - memory_size;
+            stats.resident_bytes -= content.memory_size - memory_size;
+            content.memory_size = memory_size;
+            ++stats.dropped_mips;
+        }
+        for (Record* record : candidates) {
+            if (freed >= bytes_to_free) {
+                break;
+            }
+            if (record->content.use_count() == 1) {
+                freed += record->content->memory_size;
+            }
+            record->content.reset();
+            ++stats.evictions;
+        }
+        return freed;
+    }
+
+    //    
+    size_t AssetManager::get_resident_bytes() const {
+        size_t resident_bytes = 0;
+        for (const Stats& stats : m_stats) {
+            resident_bytes += stats.resident_bytes;
+        }
+        return resident_bytes;
+    }
+
+    //  
+    void AssetManager::on_ui_draw() const {
+        ImGui::Begin("Assets");
+        ImGui::Text("Resident: %.1f / %.1f MB", get_resident_bytes() / (1024.0 * 1024.0), m_memory_budget / (1024.0 * 1024.0));
+        if (ImGui::BeginTable("asset_stats", 10, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Type");
+            ImGui::TableSetupColumn("Assets");
+            ImGui::TableSetupColumn("Resident");
+            ImGui::TableSetupColumn("KB (peak)");
+            ImGui::TableSetupColumn("Loads");
+            ImGui::TableSetupColumn("Loading");
+            ImGui::TableSetupColumn("Avg load, ms");
+            ImGui::TableSetupColumn("Hit rate");
+            ImGui::TableSetupColumn("Evictions");
+            ImGui::TableSetupColumn("Mips dropped");
+            ImGui::TableHeadersRow();
+            for (size_t type = 0; type < static_cast<size_t>(EAssetType::Count); ++type) {
+                const Stats& stats = m_stats[type];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(get_asset_type_name(static_cast<EAssetType>(type)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.assets_count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.resident_count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu (%zu)", stats.resident_bytes / 1024, stats.peak_resident_bytes / 1024);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.loads_count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.loads_in_flight);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", stats.loads_count ? stats.load_time_ms / stats.loads_count : 0.0);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f%%", stats.get_hit_rate() * 100.f);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.evictions);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", stats.dropped_mips);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::End();
+    }
+}
\ No newline at end of file
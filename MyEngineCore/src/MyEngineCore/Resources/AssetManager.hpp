@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MyEngine {
+
+    class Texture2D;
+    class Mesh;
+    struct TextureData;
+    struct MeshData;
+
+    //  
+    enum class EAssetType {
+        Texture,
+        Mesh,
+        Count
+    };
+
+    //   :     (     )
+    template<typename T>
+    struct AssetHandle {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool is_valid() const { return index != UINT32_MAX; }
+        bool operator==(const AssetHandle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+    };
+
+    using TextureHandle = AssetHandle<Texture2D>;
+    using MeshHandle = AssetHandle<Mesh>;
+
+    //   GPU.       ()   ,  
+    //   acquire/release.        get ( prefetch/on_ready):
+    //      ,  OpenGL   update     ,
+    //   get  nullptr.     
+    //   (      ),       
+    //    -      .    (GpuMemoryTracker)
+    //         ,   
+    class AssetManager {
+    public:
+        //  ,     ( ,  ).
+        //     , false - 
+        using TextureLoader = std::function<bool(TextureData& texture_data)>;
+        using MeshLoader = std::function<bool(MeshData& mesh_data)>;
+        //     (  OpenGL,  update), false -   
+        using ReadyCallback = std::function<void(const bool loaded)>;
+
+        //    
+        struct Stats {
+            size_t assets_count = 0;
+            size_t resident_count = 0;
+            size_t resident_bytes = 0;
+            size_t peak_resident_bytes = 0;
+            size_t loads_count = 0;
+            double load_time_ms = 0.0;
+            size_t path_hits = 0;
+            size_t content_hits = 0;
+            size_t evictions = 0;
+            size_t dropped_mips = 0;
+            size_t loads_in_flight = 0;
+
+            //  ,   
+            float get_hit_rate() const;
+        };
+
+        //  (   )  
+        explicit AssetManager(const size_t memory_budget = 512 * 1024 * 1024);
+        ~AssetManager();
+
+        //      
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+        AssetManager& operator=(AssetManager&&) = delete;
+        AssetManager(AssetManager&&) = delete;
+
+        //     (.tex  ; .mesh, .obj, .gltf, .glb  )     .
+        //           .    
+        TextureHandle load_texture(const std::string& path);
+        TextureHandle add_texture(const std::string& name, TextureLoader loader);
+        MeshHandle load_mesh(const std::string& path);
+        MeshHandle add_mesh(const std::string& name, MeshLoader loader);
+
+        //  
+        template<typename T>
+        void acquire(const AssetHandle<T> handle) { acquire(handle.index, handle.generation); }
+        template<typename T>
+        void release(const AssetHandle<T> handle) { release(handle.index, handle.generation); }
+
+        //  (    ).     update.
+        // nullptr -   ,      
+        const Texture2D* get(const TextureHandle handle);
+        const Mesh* get(const MeshHandle handle);
+
+        //  ,   
+        template<typename T>
+        void prefetch(const AssetHandle<T> handle) { on_ready(handle.index, handle.generation, nullptr); }
+        //    (,    )
+        template<typename T>
+        void on_ready(const AssetHandle<T> handle, ReadyCallback callback) { on_ready(handle.index, handle.generation, std::move(callback)); }
+
+        //    :   OpenGL    (  finalize_budget_ms,
+        //    ),         
+        void update(const double finalize_budget_ms = 2.0);
+
+        void set_memory_budget(const size_t memory_budget) { m_memory_budget = memory_budget; }
+        size_t get_memory_budget() const { return m_memory_budget; }
+        const Stats& get_stats(const EAssetType type) const { return m_stats[static_cast<size_t>(type)]; }
+
+        //   ImGui
+        void on_ui_draw() const;
+
+    private:
+        //  .       ,
+        //         
+        struct Content {
+            std::unique_ptr<Texture2D> texture;
+            std::unique_ptr<Mesh> mesh;
+            size_t memory_size = 0;
+            Stats* pStats = nullptr;
+
+            ~Content();
+        };
+
+        //    ,    update
+        struct PendingLoad;
+
+        //  
+        struct Record {
+            EAssetType type = EAssetType::Texture;
+            std::string key;
+            bool from_file = false;
+            TextureLoader texture_loader;
+            MeshLoader mesh_loader;
+            std::shared_ptr<Content> content;
+            std::vector<ReadyCallback> callbacks;
+            uint32_t generation = 0;
+            uint32_t references_count = 0;
+            uint64_t last_used_frame = 0;
+            uint64_t destroy_frame = 0;
+            bool alive = false;
+            bool loading = false;
+            bool load_failed = false;
+        };
+
+        //   (    )
+        uint32_t register_asset(const EAssetType type, const std::string& key, const bool from_file, TextureLoader texture_loader,
+            MeshLoader mesh_loader, uint32_t& generation);
+        void acquire(const uint32_t index, const uint32_t generation);
+        void release(const uint32_t index, const uint32_t generation);
+        void on_ready(const uint32_t index, const uint32_t generation, ReadyCallback callback);
+        //    
+        Record* find_record(const uint32_t index, const uint32_t generation);
+        //   
+        void start_load(Record& record, const uint32_t index);
+        //    ( ,   OpenGL)
+        static bool decode(PendingLoad& pending);
+        //   OpenGL    (   )
+        void finalize_load(PendingLoad& pending);
+        std::shared_ptr<Content> create_content(PendingLoad& pending, Stats& stats);
+        //   
+        void enforce_budget();
+        //   :     ,     
+        size_t on_memory_pressure(const size_t bytes_to_free);
+        size_t get_resident_bytes() const;
+
+        //    ,     
+        Stats m_stats[static_cast<size_t>(EAssetType::Count)];
+
+        std::vector<Record> m_records;
+        std::vector<uint32_t> m_free_records;
+        //    -> ,   ->  ( )
+        std::unordered_map<std::string, uint32_t> m_keys[static_cast<size_t>(EAssetType::Count)];
+        std::unordered_map<uint64_t, std::weak_ptr<Content>> m_contents[static_cast<size_t>(EAssetType::Count)];
+        //    
+        std::vector<std::shared_ptr<PendingLoad>> m_pending_loads;
+
+        size_t m_memory_budget;
+        uint64_t m_frame = 0;
+        size_t m_pressure_handler_id = 0;
+    };
+
+}
\ No newline at end of file
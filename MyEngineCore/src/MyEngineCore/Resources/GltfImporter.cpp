@@ -0,0 +1,472 @@
+#include "MeshImporter.hpp"
+
+#include "Json.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace MyEngine {
+
+    //    glTF
+    constexpr int s_gltf_byte = 5120;
+    constexpr int s_gltf_unsigned_byte = 5121;
+    constexpr int s_gltf_short = 5122;
+    constexpr int s_gltf_unsigned_short = 5123;
+    constexpr int s_gltf_unsigned_int = 5125;
+    constexpr int s_gltf_float = 5126;
+    //   ""
+    constexpr int s_gltf_triangles = 4;
+
+    //    .glb
+    constexpr uint32_t s_glb_magic = 0x46546C67;
+    constexpr uint32_t s_glb_chunk_json = 0x4E4F534A;
+    constexpr uint32_t s_glb_chunk_bin = 0x004E4942;
+
+    //  glTF:     ,    
+    struct GltfBuffer {
+        MappedFile file;
+        std::vector<unsigned char> decoded;
+        const unsigned char* data = nullptr;
+        size_t size = 0;
+    };
+
+    //  base64
+    static bool decode_base64(const char* text, const size_t length, std::vector<unsigned char>& output) {
+        static const auto s_table = []() {
+            std::array<int8_t, 256> table{};
+            table.fill(-1);
+            const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            for (int i = 0; i < 64; ++i) {
+                table[static_cast<unsigned char>(alphabet[i])] = static_cast<int8_t>(i);
+            }
+            return table;
+        }();
+
+        output.clear();
+        output.reserve(length / 4 * 3);
+        uint32_t accumulator = 0;
+        int bits = 0;
+        for (size_t i = 0; i < length; ++i) {
+            const unsigned char c = static_cast<unsigned char>(text[i]);
+            if (c == '=') {
+                break;
+            }
+            const int8_t value = s_table[c];
+            if (value < 0) {
+                return false;
+            }
+            accumulator = (accumulator << 6) | static_cast<uint32_t>(value);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                output.push_back(static_cast<unsigned char>((accumulator >> bits) & 0xFF));
+            }
+        }
+        return true;
+    }
+
+    //    JSON    . , , , 
+    //     size_t  : static_cast  double -  
+    static bool get_size(const JsonValue& value, size_t& result) {
+        const double number = value.as_number(-1.0);
+        if (!std::isfinite(number) || number < 0.0 || number != std::floor(number)
+            || number >= static_cast<double>(std::numeric_limits<size_t>::max())) {
+            return false;
+        }
+        result = static_cast<size_t>(number);
+        return true;
+    }
+
+    //  -  (   - default_value)
+    static bool get_size(const JsonValue& object, const char* key, const size_t default_value, size_t& result) {
+        const JsonValue* value = object.find(key);
+        if (!value) {
+            result = default_value;
+            return true;
+        }
+        return get_size(*value, result);
+    }
+
+    //   (  )
+    static std::string get_directory(const std::string& path) {
+        const size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    //    uri:  base64      .gltf
+    static bool load_gltf_buffer(const JsonValue& buffer_json, const std::string& directory, GltfBuffer& buffer) {
+        const std::string uri = buffer_json.get_string("uri");
+        size_t byte_length = 0;
+        if (!get_size(buffer_json, "byteLength", 0, byte_length)) {
+            LOG_ERROR("MeshImporter: invalid byteLength of glTF buffer '{0}'", uri);
+            return false;
+        }
+        if (uri.compare(0, 5, "data:") == 0) {
+            const size_t comma = uri.find(',');
+            if (comma == std::string::npos || uri.find(";base64") > comma) {
+                LOG_ERROR("MeshImporter: unsupported data uri in glTF buffer");
+                return false;
+            }
+            if (!decode_base64(uri.data() + comma + 1, uri.size() - comma - 1, buffer.decoded)) {
+                LOG_ERROR("MeshImporter: invalid base64 in glTF buffer");
+                return false;
+            }
+            buffer.data = buffer.decoded.data();
+            buffer.size = buffer.decoded.size();
+        }
+        else {
+            if (!buffer.file.open(directory + uri)) {
+                return false;
+            }
+            buffer.data = buffer.file.get_data();
+            buffer.size = buffer.file.get_size();
+        }
+        if (buffer.size < byte_length) {
+            LOG_ERROR("MeshImporter: glTF buffer '{0}' is shorter than byteLength", uri);
+            return false;
+        }
+        return true;
+    }
+
+    //  glTF: JSON  
+    class GltfDocument {
+    public:
+        //  .gltf  .glb
+        bool load(const std::string& path) {
+            if (!m_file.open(path)) {
+                return false;
+            }
+            const unsigned char* data = m_file.get_data();
+            const char* json_text = reinterpret_cast<const char*>(data);
+            size_t json_size = m_file.get_size();
+            const unsigned char* glb_bin = nullptr;
+            size_t glb_bin_size = 0;
+
+            //  : ,  JSON,   BIN
+            uint32_t magic = 0;
+            std::memcpy(&magic, data, std::min<size_t>(4, m_file.get_size()));
+            if (magic == s_glb_magic) {
+                size_t offset = 12;
+                json_size = 0;
+                while (offset + 8 <= m_file.get_size()) {
+                    uint32_t chunk_header[2];
+                    std::memcpy(chunk_header, data + offset, sizeof(chunk_header));
+                    offset += 8;
+                    if (chunk_header[0] > m_file.get_size() - offset) {
+                        break;
+                    }
+                    if (chunk_header[1] == s_glb_chunk_json) {
+                        json_text = reinterpret_cast<const char*>(data + offset);
+                        json_size = chunk_header[0];
+                    }
+                    else if (chunk_header[1] == s_glb_chunk_bin) {
+                        glb_bin = data + offset;
+                        glb_bin_size = chunk_header[0];
+                    }
+                    offset += (chunk_header[0] + 3) & ~3u;
+                }
+            }
+
+            std::string error;
+            if (!JsonValue::parse(json_text, json_size, m_json, error)) {
+                LOG_ERROR("MeshImporter: invalid glTF JSON in '{0}': {1}", path, error);
+                return false;
+            }
+
+            // 
+            const JsonValue* buffers = m_json.find("buffers");
+            const size_t buffers_count = buffers ? buffers->size() : 0;
+            m_buffers = std::vector<GltfBuffer>(buffers_count);
+            for (size_t i = 0; i < buffers_count; ++i) {
+                const JsonValue& buffer_json = (*buffers)[i];
+                //  .glb   uri -   BIN
+                if (!buffer_json.find("uri") && glb_bin) {
+                    m_buffers[i].data = glb_bin;
+                    m_buffers[i].size = glb_bin_size;
+                    continue;
+                }
+                if (!load_gltf_buffer(buffer_json, get_directory(path), m_buffers[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        const JsonValue& get_json() const { return m_json; }
+
+        //     float (components -    )
+        bool read_floats(const size_t accessor_index, const int components, std::vector<float>& output) const {
+            const unsigned char* data = nullptr;
+            size_t count = 0;
+            size_t stride = 0;
+            int component_type = 0;
+            bool normalized = false;
+            if (!get_accessor(accessor_index, components, data, count, stride, component_type, normalized)) {
+                return false;
+            }
+            output.resize(count * components);
+            for (size_t i = 0; i < count; ++i) {
+                const unsigned char* element = data + i * stride;
+                for (int component = 0; component < components; ++component) {
+                    output[i * components + component] = read_component(element, component, component_type, normalized);
+                }
+            }
+            return true;
+        }
+
+        //  
+        bool read_indices(const size_t accessor_index, std::vector<uint32_t>& output) const {
+            const unsigned char* data = nullptr;
+            size_t count = 0;
+            size_t stride = 0;
+            int component_type = 0;
+            bool normalized = false;
+            if (!get_accessor(accessor_index, 1, data, count, stride, component_type, normalized)) {
+                return false;
+            }
+            output.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                const unsigned char* element = data + i * stride;
+                switch (component_type) {
+                case s_gltf_unsigned_byte: output[i] = element[0]; break;
+                case s_gltf_unsigned_short: { uint16_t value; std::memcpy(&value, element, 2); output[i] = value; break; }
+                case s_gltf_unsigned_int: { uint32_t value; std::memcpy(&value, element, 4); output[i] = value; break; }
+                default:
+                    LOG_ERROR("MeshImporter: unsupported glTF index type {0}", component_type);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        //    
+        static size_t component_size(const int component_type) {
+            switch (component_type) {
+            case s_gltf_byte:
+            case s_gltf_unsigned_byte: return 1;
+            case s_gltf_short:
+            case s_gltf_unsigned_short: return 2;
+            case s_gltf_unsigned_int:
+            case s_gltf_float: return 4;
+            }
+            return 0;
+        }
+
+        //       
+        static float read_component(const unsigned char* element, const int component, const int component_type, const bool normalized) {
+            switch (component_type) {
+            case s_gltf_float: { float value; std::memcpy(&value, element + component * 4, 4); return value; }
+            case s_gltf_unsigned_byte: { const float value = element[component]; return normalized ? value / 255.f : value; }
+            case s_gltf_byte: { const float value = static_cast<int8_t>(element[component]); return normalized ? std::max(value / 127.f, -1.f) : value; }
+            case s_gltf_unsigned_short: { uint16_t value; std::memcpy(&value, element + component * 2, 2); return normalized ? value / 65535.f : value; }
+            case s_gltf_short: { int16_t value; std::memcpy(&value, element + component * 2, 2); return normalized ? std::max(value / 32767.f, -1.f) : value; }
+            case s_gltf_unsigned_int: { uint32_t value; std::memcpy(&value, element + component * 4, 4); return static_cast<float>(value); }
+            }
+            return 0.f;
+        }
+
+        //       
+        bool get_accessor(const size_t accessor_index, const int components, const unsigned char*& data, size_t& count,
+            size_t& stride, int& component_type, bool& normalized) const {
+            const JsonValue* accessors = m_json.find("accessors");
+            if (!accessors || accessor_index >= accessors->size()) {
+                LOG_ERROR("MeshImporter: glTF accessor {0} is missing", accessor_index);
+                return false;
+            }
+            const JsonValue& accessor = (*accessors)[accessor_index];
+            if (accessor.find("sparse")) {
+                LOG_WARN("MeshImporter: sparse glTF accessors are not supported, using base values");
+            }
+            size_t component_type_value = 0;
+            if (!get_size(accessor, "count", 0, count) || count == 0) {
+                LOG_ERROR("MeshImporter: glTF accessor {0} has invalid count", accessor_index);
+                return false;
+            }
+            if (!get_size(accessor, "componentType", 0, component_type_value)
+                || component_type_value > static_cast<size_t>(std::numeric_limits<int>::max())) {
+                component_type_value = 0;
+            }
+            component_type = static_cast<int>(component_type_value);
+            normalized = accessor.find("normalized") && accessor.find("normalized")->as_bool();
+            const size_t element_size = component_size(component_type) * components;
+            if (element_size == 0) {
+                LOG_ERROR("MeshImporter: glTF accessor {0} has unsupported component type", accessor_index);
+                return false;
+            }
+
+            const JsonValue* buffer_view_index = accessor.find("bufferView");
+            const JsonValue* buffer_views = m_json.find("bufferViews");
+            size_t view_index = 0;
+            if (!buffer_view_index || !buffer_views || !get_size(*buffer_view_index, view_index) || view_index >= buffer_views->size()) {
+                LOG_ERROR("MeshImporter: glTF accessor {0} has no buffer view", accessor_index);
+                return false;
+            }
+            const JsonValue& buffer_view = (*buffer_views)[view_index];
+            size_t buffer_index = 0;
+            if (!get_size(buffer_view, "buffer", 0, buffer_index) || buffer_index >= m_buffers.size()) {
+                LOG_ERROR("MeshImporter: glTF buffer view {0} references missing buffer", view_index);
+                return false;
+            }
+            const GltfBuffer& buffer = m_buffers[buffer_index];
+            size_t view_offset = 0;
+            size_t view_length = 0;
+            size_t accessor_offset = 0;
+            if (!get_size(buffer_view, "byteOffset", 0, view_offset) || !get_size(buffer_view, "byteLength", 0, view_length)
+                || !get_size(accessor, "byteOffset", 0, accessor_offset) || !get_size(buffer_view, "byteStride", 0, stride)) {
+                LOG_ERROR("MeshImporter: glTF accessor {0} has invalid offsets", accessor_index);
+                return false;
+            }
+            if (stride == 0) {
+                stride = element_size;
+            }
+
+            //      .     , 
+            //   ,   (count - 1) * stride  ,   
+            if (view_offset > buffer.size || view_length > buffer.size - view_offset
+                || accessor_offset > view_length || element_size > view_length - accessor_offset
+                || count - 1 > (view_length - accessor_offset - element_size) / stride) {
+                LOG_ERROR("MeshImporter: glTF accessor {0} is out of range", accessor_index);
+                return false;
+            }
+            data = buffer.data + view_offset + accessor_offset;
+            return true;
+        }
+
+        MappedFile m_file;
+        JsonValue m_json;
+        std::vector<GltfBuffer> m_buffers;
+    };
+
+    //  glTF:         .
+    //      -     
+    bool MeshImporter::import_gltf(const std::string& path, MeshData& mesh_data) {
+        GltfDocument document;
+        if (!document.load(path)) {
+            return false;
+        }
+        const JsonValue* meshes = document.get_json().find("meshes");
+        if (!meshes || meshes->size() == 0) {
+            LOG_ERROR("MeshImporter: '{0}' has no meshes", path);
+            return false;
+        }
+
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+        std::vector<MeshSubmesh> submeshes;
+        std::vector<float> positions;
+        std::vector<float> normals;
+        std::vector<float> uvs;
+        std::vector<uint32_t> primitive_indices;
+
+        for (size_t mesh_index = 0; mesh_index < meshes->size(); ++mesh_index) {
+            const JsonValue* primitives = (*meshes)[mesh_index].find("primitives");
+            if (!primitives) {
+                continue;
+            }
+            for (size_t primitive_index = 0; primitive_index < primitives->size(); ++primitive_index) {
+                const JsonValue& primitive = (*primitives)[primitive_index];
+                size_t mode = 0;
+                if (!get_size(primitive, "mode", s_gltf_triangles, mode) || mode != s_gltf_triangles) {
+                    LOG_WARN("MeshImporter: skipping non-triangle primitive {0} of mesh {1}", primitive_index, mesh_index);
+                    continue;
+                }
+                const JsonValue* attributes = primitive.find("attributes");
+                const JsonValue* position_accessor = attributes ? attributes->find("POSITION") : nullptr;
+                if (!position_accessor) {
+                    LOG_WARN("MeshImporter: primitive {0} of mesh {1} has no positions", primitive_index, mesh_index);
+                    continue;
+                }
+
+                // .  ,     ,   
+                // ,  read_floats   
+                const auto get_accessor_index = [](const JsonValue& value) {
+                    size_t index = 0;
+                    return get_size(value, index) ? index : std::numeric_limits<size_t>::max();
+                };
+                if (!document.read_floats(get_accessor_index(*position_accessor), 3, positions)) {
+                    return false;
+                }
+                const size_t vertices_count = positions.size() / 3;
+                normals.clear();
+                uvs.clear();
+                if (const JsonValue* normal_accessor = attributes->find("NORMAL")) {
+                    if (!document.read_floats(get_accessor_index(*normal_accessor), 3, normals)) {
+                        return false;
+                    }
+                }
+                if (const JsonValue* uv_accessor = attributes->find("TEXCOORD_0")) {
+                    if (!document.read_floats(get_accessor_index(*uv_accessor), 2, uvs)) {
+                        return false;
+                    }
+                }
+
+                //  (  -   )
+                if (const JsonValue* indices_accessor = primitive.find("indices")) {
+                    if (!document.read_indices(get_accessor_index(*indices_accessor), primitive_indices)) {
+                        return false;
+                    }
+                }
+                else {
+                    primitive_indices.resize(vertices_count);
+                    for (size_t i = 0; i < vertices_count; ++i) {
+                        primitive_indices[i] = static_cast<uint32_t>(i);
+                    }
+                }
+                for (const uint32_t index : primitive_indices) {
+                    if (index >= vertices_count) {
+                        LOG_ERROR("MeshImporter: primitive {0} of mesh {1} references vertex {2} of {3}",
+                            primitive_index, mesh_index, index, vertices_count);
+                        return false;
+                    }
+                }
+
+                MeshSubmesh submesh{};
+                submesh.first_index = static_cast<uint32_t>(indices.size());
+                submesh.indices_count = static_cast<uint32_t>(primitive_indices.size() / 3 * 3);
+                submesh.base_vertex = static_cast<int32_t>(vertices.size());
+                size_t material_index = 0;
+                if (!get_size(primitive, "material", 0, material_index) || material_index > std::numeric_limits<uint32_t>::max()) {
+                    LOG_WARN("MeshImporter: primitive {0} of mesh {1} has invalid material, using 0", primitive_index, mesh_index);
+                    material_index = 0;
+                }
+                submesh.material_index = static_cast<uint32_t>(material_index);
+                submeshes.push_back(submesh);
+
+                const size_t first_vertex = vertices.size();
+                vertices.resize(first_vertex + vertices_count);
+                for (size_t i = 0; i < vertices_count; ++i) {
+                    MeshVertex& vertex = vertices[first_vertex + i];
+                    std::memcpy(vertex.position, &positions[i * 3], sizeof(vertex.position));
+                    if (normals.size() >= (i + 1) * 3) {
+                        std::memcpy(vertex.normal, &normals[i * 3], sizeof(vertex.normal));
+                    }
+                    else {
+                        vertex.normal[0] = vertex.normal[1] = 0.f;
+                        vertex.normal[2] = 1.f;
+                    }
+                    if (uvs.size() >= (i + 1) * 2) {
+                        std::memcpy(vertex.uv, &uvs[i * 2], sizeof(vertex.uv));
+                    }
+                    else {
+                        vertex.uv[0] = vertex.uv[1] = 0.f;
+                    }
+                }
+                indices.insert(indices.end(), primitive_indices.begin(), primitive_indices.begin() + submesh.indices_count);
+            }
+        }
+
+        if (submeshes.empty()) {
+            LOG_ERROR("MeshImporter: '{0}' has no triangle primitives", path);
+            return false;
+        }
+        const size_t vertices_count = vertices.size();
+        build_mesh_data(std::move(vertices), std::move(indices), std::move(submeshes), mesh_data);
+        LOG_INFO("MeshImporter: '{0}' imported ({1} vertices, {2} submeshes)", path, vertices_count, mesh_data.submeshes.size());
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,290 @@
+#include "Json.hpp"
+
+#include <charconv>
+#include <cstring>
+
+namespace MyEngine {
+
+    //   JSON
+    class JsonParser {
+    public:
+        JsonParser(const char* text, const size_t size) : m_pCurrent(text), m_pEnd(text + size) {}
+
+        //  
+        bool parse_value(JsonValue& value, const int depth) {
+            if (depth > s_max_depth) {
+                return fail("nesting is too deep");
+            }
+            skip_spaces();
+            if (m_pCurrent >= m_pEnd) {
+                return fail("unexpected end of text");
+            }
+            switch (*m_pCurrent) {
+            case '{': return parse_object(value, depth);
+            case '[': return parse_array(value, depth);
+            case '"':
+                value.m_type = JsonValue::EType::String;
+                return parse_string(value.m_string);
+            case 't': return parse_literal("true", value, JsonValue::EType::Bool, true);
+            case 'f': return parse_literal("false", value, JsonValue::EType::Bool, false);
+            case 'n': return parse_literal("null", value, JsonValue::EType::Null, false);
+            default: return parse_number(value);
+            }
+        }
+
+        // ,      
+        bool finish() {
+            skip_spaces();
+            return m_pCurrent == m_pEnd || fail("unexpected characters after value");
+        }
+
+        const std::string& get_error() const { return m_error; }
+
+    private:
+        static constexpr int s_max_depth = 256;
+
+        //   
+        void skip_spaces() {
+            while (m_pCurrent < m_pEnd && (*m_pCurrent == ' ' || *m_pCurrent == '\t' || *m_pCurrent == '\n' || *m_pCurrent == '\r')) {
+                ++m_pCurrent;
+            }
+        }
+
+        //  
+        bool fail(const char* message) {
+            if (m_error.empty()) {
+                m_error = message;
+            }
+            return false;
+        }
+
+        // true, false  null
+        bool parse_literal(const char* literal, JsonValue& value, const JsonValue::EType type, const bool bool_value) {
+            const size_t length = std::strlen(literal);
+            if (static_cast<size_t>(m_pEnd - m_pCurrent) < length || std::strncmp(m_pCurrent, literal, length) != 0) {
+                return fail("unknown literal");
+            }
+            m_pCurrent += length;
+            value.m_type = type;
+            value.m_bool = bool_value;
+            return true;
+        }
+
+        // . from_chars     (strtod        "1.5")
+        //     
+        bool parse_number(JsonValue& value) {
+            size_t length = 0;
+            while (m_pCurrent + length < m_pEnd && std::strchr("+-0123456789.eE", m_pCurrent[length]) != nullptr) {
+                ++length;
+            }
+            const std::from_chars_result result = std::from_chars(m_pCurrent, m_pCurrent + length, value.m_number);
+            if (length == 0 || result.ec == std::errc::invalid_argument || result.ptr != m_pCurrent + length) {
+                return fail("invalid number");
+            }
+            if (result.ec == std::errc::result_out_of_range) {
+                return fail("number is out of range");
+            }
+            value.m_type = JsonValue::EType::Number;
+            m_pCurrent += length;
+            return true;
+        }
+
+        //   Unicode     UTF-8
+        static void append_utf8(std::string& string, const unsigned int code_point) {
+            if (code_point < 0x80) {
+                string += static_cast<char>(code_point);
+            }
+            else if (code_point < 0x800) {
+                string += static_cast<char>(0xC0 | (code_point >> 6));
+                string += static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            else if (code_point < 0x10000) {
+                string += static_cast<char>(0xE0 | (code_point >> 12));
+                string += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                string += static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            else {
+                string += static_cast<char>(0xF0 | (code_point >> 18));
+                string += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                string += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                string += static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+        }
+
+        //     \u
+        bool parse_hex4(unsigned int& code) {
+            if (m_pEnd - m_pCurrent < 4) {
+                return fail("invalid unicode escape");
+            }
+            code = 0;
+            for (int i = 0; i < 4; ++i) {
+                const char c = *m_pCurrent++;
+                code <<= 4;
+                if (c >= '0' && c <= '9') code |= c - '0';
+                else if (c >= 'a' && c <= 'f') code |= c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F') code |= c - 'A' + 10;
+                else return fail("invalid unicode escape");
+            }
+            return true;
+        }
+
+        //   
+        bool parse_string(std::string& string) {
+            ++m_pCurrent;
+            string.clear();
+            while (m_pCurrent < m_pEnd) {
+                const char c = *m_pCurrent++;
+                if (c == '"') {
+                    return true;
+                }
+                if (c != '\\') {
+                    string += c;
+                    continue;
+                }
+                if (m_pCurrent >= m_pEnd) {
+                    break;
+                }
+                const char escaped = *m_pCurrent++;
+                switch (escaped) {
+                case '"': string += '"'; break;
+                case '\\': string += '\\'; break;
+                case '/': string += '/'; break;
+                case 'b': string += '\b'; break;
+                case 'f': string += '\f'; break;
+                case 'n': string += '\n'; break;
+                case 'r': string += '\r'; break;
+                case 't': string += '\t'; break;
+                case 'u': {
+                    unsigned int code_point = 0;
+                    if (!parse_hex4(code_point)) {
+                        return false;
+                    }
+                    //  
+                    if (code_point >= 0xD800 && code_point <= 0xDBFF && m_pEnd - m_pCurrent >= 6
+                        && m_pCurrent[0] == '\\' && m_pCurrent[1] == 'u') {
+                        m_pCurrent += 2;
+                        unsigned int low = 0;
+                        if (!parse_hex4(low)) {
+                            return false;
+                        }
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    append_utf8(string, code_point);
+                    break;
+                }
+                default:
+                    return fail("invalid escape sequence");
+                }
+            }
+            return fail("unterminated string");
+        }
+
+        // 
+        bool parse_array(JsonValue& value, const int depth) {
+            ++m_pCurrent;
+            value.m_type = JsonValue::EType::Array;
+            skip_spaces();
+            if (m_pCurrent < m_pEnd && *m_pCurrent == ']') {
+                ++m_pCurrent;
+                return true;
+            }
+            while (true) {
+                value.m_values.emplace_back();
+                if (!parse_value(value.m_values.back(), depth + 1)) {
+                    return false;
+                }
+                skip_spaces();
+                if (m_pCurrent >= m_pEnd) {
+                    return fail("unterminated array");
+                }
+                const char c = *m_pCurrent++;
+                if (c == ']') {
+                    return true;
+                }
+                if (c != ',') {
+                    return fail("expected ',' or ']'");
+                }
+            }
+        }
+
+        // 
+        bool parse_object(JsonValue& value, const int depth) {
+            ++m_pCurrent;
+            value.m_type = JsonValue::EType::Object;
+            skip_spaces();
+            if (m_pCurrent < m_pEnd && *m_pCurrent == '}') {
+                ++m_pCurrent;
+                return true;
+            }
+            while (true) {
+                skip_spaces();
+                if (m_pCurrent >= m_pEnd || *m_pCurrent != '"') {
+                    return fail("expected object key");
+                }
+                value.m_keys.emplace_back();
+                if (!parse_string(value.m_keys.back())) {
+                    return false;
+                }
+                skip_spaces();
+                if (m_pCurrent >= m_pEnd || *m_pCurrent++ != ':') {
+                    return fail("expected ':'");
+                }
+                value.m_values.emplace_back();
+                if (!parse_value(value.m_values.back(), depth + 1)) {
+                    return false;
+                }
+                skip_spaces();
+                if (m_pCurrent >= m_pEnd) {
+                    return fail("unterminated object");
+                }
+                const char c = *m_pCurrent++;
+                if (c == '}') {
+                    return true;
+                }
+                if (c != ',') {
+                    return fail("expected ',' or '}'");
+                }
+            }
+        }
+
+        const char* m_pCurrent;
+        const char* m_pEnd;
+        std::string m_error;
+    };
+
+    //  
+    bool JsonValue::parse(const char* text, const size_t size, JsonValue& value, std::string& error) {
+        value = JsonValue();
+        JsonParser parser(text, size);
+        if (!parser.parse_value(value, 0) || !parser.finish()) {
+            error = parser.get_error();
+            return false;
+        }
+        return true;
+    }
+
+    //   
+    const JsonValue* JsonValue::find(const char* key) const {
+        if (m_type != EType::Object) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < m_keys.size(); ++i) {
+            if (m_keys[i] == key) {
+                return &m_values[i];
+            }
+        }
+        return nullptr;
+    }
+
+    //  
+    double JsonValue::get_number(const char* key, const double default_value) const {
+        const JsonValue* value = find(key);
+        return value ? value->as_number(default_value) : default_value;
+    }
+
+    //  
+    std::string JsonValue::get_string(const char* key, const std::string& default_value) const {
+        const JsonValue* value = find(key);
+        return value && value->m_type == EType::String ? value->m_string : default_value;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace MyEngine {
+
+    //  DOM- JSON ( glTF  )
+    class JsonValue {
+    public:
+        //  
+        enum class EType {
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        //  .    false     error
+        static bool parse(const char* text, const size_t size, JsonValue& value, std::string& error);
+
+        EType get_type() const { return m_type; }
+        bool is_null() const { return m_type == EType::Null; }
+        bool is_array() const { return m_type == EType::Array; }
+        bool is_object() const { return m_type == EType::Object; }
+
+        //    (      )
+        bool as_bool(const bool default_value = false) const { return m_type == EType::Bool ? m_bool : default_value; }
+        double as_number(const double default_value = 0.0) const { return m_type == EType::Number ? m_number : default_value; }
+        const std::string& as_string() const { return m_string; }
+
+        //     
+        size_t size() const { return m_values.size(); }
+        const JsonValue& operator[](const size_t index) const { return m_values[index]; }
+        const JsonValue* find(const char* key) const;
+        const std::string& get_key(const size_t index) const { return m_keys[index]; }
+
+        //      
+        double get_number(const char* key, const double default_value) const;
+        std::string get_string(const char* key, const std::string& default_value = {}) const;
+
+    private:
+        friend class JsonParser;
+
+        EType m_type = EType::Null;
+        bool m_bool = false;
+        double m_number = 0.0;
+        std::string m_string;
+        //       (   m_keys)
+        std::vector<JsonValue> m_values;
+        std::vector<std::string> m_keys;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "MappedFile.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace MyEngine {
+
+    //   
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    //  
+    MappedFile::MappedFile(MappedFile&& mapped_file) noexcept
+        : m_pData(mapped_file.m_pData), m_size(mapped_file.m_size) {
+#ifdef _WIN32
+        m_file_handle = mapped_file.m_file_handle;
+        m_mapping_handle = mapped_file.m_mapping_handle;
+        mapped_file.m_file_handle = nullptr;
+        mapped_file.m_mapping_handle = nullptr;
+#endif
+        mapped_file.m_pData = nullptr;
+        mapped_file.m_size = 0;
+    }
+
+    //  
+    MappedFile& MappedFile::operator=(MappedFile&& mapped_file) noexcept {
+        close();
+        m_pData = mapped_file.m_pData;
+        m_size = mapped_file.m_size;
+#ifdef _WIN32
+        m_file_handle = mapped_file.m_file_handle;
+        m_mapping_handle = mapped_file.m_mapping_handle;
+        mapped_file.m_file_handle = nullptr;
+        mapped_file.m_mapping_handle = nullptr;
+#endif
+        mapped_file.m_pData = nullptr;
+        mapped_file.m_size = 0;
+        return *this;
+    }
+
+    //    
+    bool MappedFile::open(const std::string& path) {
+        close();
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            LOG_ERROR("MappedFile: can't open '{0}'", path);
+            return false;
+        }
+        LARGE_INTEGER file_size;
+        GetFileSizeEx(file, &file_size);
+        if (file_size.QuadPart == 0) {
+            LOG_ERROR("MappedFile: '{0}' is empty", path);
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            LOG_ERROR("MappedFile: can't map '{0}'", path);
+            CloseHandle(file);
+            return false;
+        }
+        m_pData = static_cast<const unsigned char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        m_file_handle = file;
+        m_mapping_handle = mapping;
+#else
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            LOG_ERROR("MappedFile: can't open '{0}'", path);
+            return false;
+        }
+        struct stat file_stat;
+        if (fstat(file, &file_stat) != 0 || file_stat.st_size == 0) {
+            LOG_ERROR("MappedFile: '{0}' is empty", path);
+            ::close(file);
+            return false;
+        }
+        void* data = mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        //   mmap   
+        ::close(file);
+        if (data == MAP_FAILED) {
+            LOG_ERROR("MappedFile: can't map '{0}'", path);
+            return false;
+        }
+        //   :     
+        madvise(data, static_cast<size_t>(file_stat.st_size), MADV_SEQUENTIAL);
+        madvise(data, static_cast<size_t>(file_stat.st_size), MADV_WILLNEED);
+        m_pData = static_cast<const unsigned char*>(data);
+        m_size = static_cast<size_t>(file_stat.st_size);
+#endif
+        return m_pData != nullptr;
+    }
+
+    //  
+    void MappedFile::close() {
+#ifdef _WIN32
+        if (m_pData) {
+            UnmapViewOfFile(m_pData);
+        }
+        if (m_mapping_handle) {
+            CloseHandle(m_mapping_handle);
+        }
+        if (m_file_handle) {
+            CloseHandle(m_file_handle);
+        }
+        m_file_handle = nullptr;
+        m_mapping_handle = nullptr;
+#else
+        if (m_pData) {
+            munmap(const_cast<unsigned char*>(m_pData), m_size);
+        }
+#endif
+        m_pData = nullptr;
+        m_size = 0;
+    }
+}
\ No newline at end of file
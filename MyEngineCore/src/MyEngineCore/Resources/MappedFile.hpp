@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace MyEngine {
+
+    // ,      
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        //  ,  
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& mapped_file) noexcept;
+        MappedFile& operator=(MappedFile&& mapped_file) noexcept;
+
+        //    
+        bool open(const std::string& path);
+        void close();
+
+        const unsigned char* get_data() const { return m_pData; }
+        size_t get_size() const { return m_size; }
+        bool is_open() const { return m_pData != nullptr; }
+
+    private:
+        const unsigned char* m_pData = nullptr;
+        size_t m_size = 0;
+#ifdef _WIN32
+        void* m_file_handle = nullptr;
+        void* m_mapping_handle = nullptr;
+#endif
+    };
+
+}
\ No newline at end of file
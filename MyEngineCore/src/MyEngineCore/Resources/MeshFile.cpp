@@ -0,0 +1,292 @@
+#include "MeshFile.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+namespace MyEngine {
+
+    // ,   [offset, offset + size)    ( )
+    static bool is_range_valid(const uint64_t offset, const uint64_t size, const uint64_t file_size) {
+        return offset <= file_size && size <= file_size - offset;
+    }
+
+    //   
+    static uint64_t align_up(const uint64_t value, const uint64_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    //   
+    bool MeshFile::load(const std::string& path, const bool validate_indices) {
+        m_pHeader = nullptr;
+        if (!m_file.open(path)) {
+            return false;
+        }
+        if (m_file.get_size() < sizeof(MeshFileHeader)) {
+            LOG_ERROR("MeshFile: '{0}' is too small", path);
+            m_file.close();
+            return false;
+        }
+
+        //           : 
+        //     -   ,     
+        const unsigned char* data = m_file.get_data();
+        const MeshFileHeader* header = reinterpret_cast<const MeshFileHeader*>(data);
+        m_pHeader = header;
+        if (!validate_header()) {
+            LOG_ERROR("MeshFile: '{0}' is corrupted", path);
+            m_pHeader = nullptr;
+            m_file.close();
+            return false;
+        }
+        m_pStreams = reinterpret_cast<const MeshStreamDesc*>(data + header->streams_offset);
+        m_pSubmeshes = reinterpret_cast<const MeshSubmesh*>(data + header->submeshes_offset);
+        m_pLods = reinterpret_cast<const MeshLOD*>(data + header->lods_offset);
+
+        if (!validate(validate_indices)) {
+            LOG_ERROR("MeshFile: '{0}' is corrupted", path);
+            m_pHeader = nullptr;
+            m_pStreams = nullptr;
+            m_pSubmeshes = nullptr;
+            m_pLods = nullptr;
+            m_file.close();
+            return false;
+        }
+        return true;
+    }
+
+    //      (    )
+    bool MeshFile::validate_header() const {
+        const MeshFileHeader& header = *m_pHeader;
+        const uint64_t file_size = m_file.get_size();
+
+        // 
+        if (header.magic != s_mesh_file_magic) {
+            LOG_ERROR("MeshFile: wrong magic");
+            return false;
+        }
+        if (header.version != s_mesh_file_version || header.header_size != sizeof(MeshFileHeader)) {
+            LOG_ERROR("MeshFile: unsupported version {0}", header.version);
+            return false;
+        }
+        if (header.file_size != file_size) {
+            LOG_ERROR("MeshFile: truncated file ({0} of {1} bytes)", file_size, header.file_size);
+            return false;
+        }
+
+        // 
+        if (header.streams_count == 0
+            || !is_range_valid(header.streams_offset, uint64_t(header.streams_count) * sizeof(MeshStreamDesc), file_size)
+            || !is_range_valid(header.submeshes_offset, uint64_t(header.submeshes_count) * sizeof(MeshSubmesh), file_size)
+            || !is_range_valid(header.lods_offset, uint64_t(header.lods_count) * sizeof(MeshLOD), file_size)
+            || header.streams_offset % s_mesh_file_alignment != 0
+            || header.submeshes_offset % s_mesh_file_alignment != 0
+            || header.lods_offset % s_mesh_file_alignment != 0) {
+            LOG_ERROR("MeshFile: tables are out of range");
+            return false;
+        }
+        return true;
+    }
+
+    //      
+    bool MeshFile::validate(const bool validate_indices) const {
+        const MeshFileHeader& header = *m_pHeader;
+        const uint64_t file_size = m_file.get_size();
+
+        //  
+        for (uint32_t i = 0; i < header.streams_count; ++i) {
+            const MeshStreamDesc& stream = m_pStreams[i];
+            if (stream.elements_count == 0 || stream.elements_count > s_mesh_stream_max_elements) {
+                LOG_ERROR("MeshFile: stream {0} has {1} elements", i, stream.elements_count);
+                return false;
+            }
+            uint32_t stride = 0;
+            for (uint32_t element = 0; element < stream.elements_count; ++element) {
+                if (stream.elements[element] > static_cast<uint8_t>(ShaderDataType::Int4)) {
+                    LOG_ERROR("MeshFile: stream {0} has unknown element type", i);
+                    return false;
+                }
+                stride += static_cast<uint32_t>(BufferElement(static_cast<ShaderDataType>(stream.elements[element])).size);
+            }
+            if (stride != stream.stride
+                || header.vertices_count > std::numeric_limits<uint64_t>::max() / stride
+                || stream.data_size != header.vertices_count * stride
+                || stream.data_offset % s_mesh_file_alignment != 0
+                || !is_range_valid(stream.data_offset, stream.data_size, file_size)) {
+                LOG_ERROR("MeshFile: stream {0} is out of range", i);
+                return false;
+            }
+        }
+
+        // 
+        if (header.indices_count > std::numeric_limits<uint64_t>::max() / sizeof(uint32_t)
+            || header.index_data_size != header.indices_count * sizeof(uint32_t)
+            || header.index_data_offset % s_mesh_file_alignment != 0
+            || !is_range_valid(header.index_data_offset, header.index_data_size, file_size)) {
+            LOG_ERROR("MeshFile: index data is out of range");
+            return false;
+        }
+
+        //    
+        for (uint32_t i = 0; i < header.submeshes_count; ++i) {
+            const MeshSubmesh& submesh = m_pSubmeshes[i];
+            if (uint64_t(submesh.first_index) + submesh.indices_count > header.indices_count
+                || submesh.base_vertex < 0
+                || uint64_t(submesh.base_vertex) > header.vertices_count) {
+                LOG_ERROR("MeshFile: submesh {0} is out of range", i);
+                return false;
+            }
+        }
+        for (uint32_t i = 0; i < header.lods_count; ++i) {
+            if (uint64_t(m_pLods[i].first_submesh) + m_pLods[i].submeshes_count > header.submeshes_count) {
+                LOG_ERROR("MeshFile: LOD {0} is out of range", i);
+                return false;
+            }
+        }
+
+        //    ()
+        if (validate_indices) {
+            const uint32_t* indices = get_indices();
+            for (uint32_t i = 0; i < header.submeshes_count; ++i) {
+                const MeshSubmesh& submesh = m_pSubmeshes[i];
+                const uint64_t max_index = header.vertices_count - submesh.base_vertex;
+                for (uint64_t index = submesh.first_index; index < uint64_t(submesh.first_index) + submesh.indices_count; ++index) {
+                    if (indices[index] >= max_index) {
+                        LOG_ERROR("MeshFile: submesh {0} references vertex {1} of {2}", i, indices[index], max_index);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    // Layout  
+    BufferLayout MeshFile::get_stream_layout(const size_t index) const {
+        const MeshStreamDesc& stream = m_pStreams[index];
+        std::vector<BufferElement> elements;
+        elements.reserve(stream.elements_count);
+        for (uint32_t i = 0; i < stream.elements_count; ++i) {
+            elements.emplace_back(static_cast<ShaderDataType>(stream.elements[i]));
+        }
+        return BufferLayout(std::move(elements));
+    }
+
+    //     
+    MeshBounds MeshFile::calculate_bounds(const float* positions, const size_t vertices_count, const size_t stride_in_floats) {
+        MeshBounds bounds{};
+        if (vertices_count == 0) {
+            return bounds;
+        }
+        for (int axis = 0; axis < 3; ++axis) {
+            bounds.min[axis] = std::numeric_limits<float>::max();
+            bounds.max[axis] = std::numeric_limits<float>::lowest();
+        }
+        for (size_t i = 0; i < vertices_count; ++i) {
+            const float* position = positions + i * stride_in_floats;
+            for (int axis = 0; axis < 3; ++axis) {
+                bounds.min[axis] = std::min(bounds.min[axis], position[axis]);
+                bounds.max[axis] = std::max(bounds.max[axis], position[axis]);
+            }
+        }
+        float radius_squared = 0.f;
+        for (int axis = 0; axis < 3; ++axis) {
+            bounds.center[axis] = (bounds.min[axis] + bounds.max[axis]) * 0.5f;
+        }
+        for (size_t i = 0; i < vertices_count; ++i) {
+            const float* position = positions + i * stride_in_floats;
+            const float dx = position[0] - bounds.center[0];
+            const float dy = position[1] - bounds.center[1];
+            const float dz = position[2] - bounds.center[2];
+            radius_squared = std::max(radius_squared, dx * dx + dy * dy + dz * dz);
+        }
+        bounds.radius = std::sqrt(radius_squared);
+        return bounds;
+    }
+
+    //   
+    bool MeshFile::write(const std::string& path, const MeshData& mesh_data) {
+        if (mesh_data.streams.empty()) {
+            LOG_ERROR("MeshFile: nothing to write to '{0}'", path);
+            return false;
+        }
+
+        //  
+        MeshFileHeader header{};
+        header.magic = s_mesh_file_magic;
+        header.version = s_mesh_file_version;
+        header.header_size = sizeof(MeshFileHeader);
+        header.streams_count = static_cast<uint32_t>(mesh_data.streams.size());
+        header.submeshes_count = static_cast<uint32_t>(mesh_data.submeshes.size());
+        header.lods_count = static_cast<uint32_t>(mesh_data.lods.size());
+        header.vertices_count = mesh_data.vertices_count;
+        header.indices_count = mesh_data.indices.size();
+        header.bounds = mesh_data.bounds;
+
+        uint64_t offset = align_up(sizeof(MeshFileHeader), s_mesh_file_alignment);
+        header.streams_offset = offset;
+        offset = align_up(offset + header.streams_count * sizeof(MeshStreamDesc), s_mesh_file_alignment);
+        header.submeshes_offset = offset;
+        offset = align_up(offset + header.submeshes_count * sizeof(MeshSubmesh), s_mesh_file_alignment);
+        header.lods_offset = offset;
+        offset = align_up(offset + header.lods_count * sizeof(MeshLOD), s_mesh_file_alignment);
+
+        std::vector<MeshStreamDesc> streams(mesh_data.streams.size());
+        for (size_t i = 0; i < mesh_data.streams.size(); ++i) {
+            const MeshData::Stream& stream = mesh_data.streams[i];
+            if (stream.elements.empty() || stream.elements.size() > s_mesh_stream_max_elements) {
+                LOG_ERROR("MeshFile: stream {0} has {1} elements", i, stream.elements.size());
+                return false;
+            }
+            streams[i] = {};
+            streams[i].data_offset = offset;
+            streams[i].data_size = stream.data.size();
+            streams[i].elements_count = static_cast<uint32_t>(stream.elements.size());
+            for (size_t element = 0; element < stream.elements.size(); ++element) {
+                streams[i].elements[element] = static_cast<uint8_t>(stream.elements[element]);
+                streams[i].stride += static_cast<uint32_t>(BufferElement(stream.elements[element]).size);
+            }
+            //       :       
+            if (mesh_data.vertices_count > std::numeric_limits<uint64_t>::max() / streams[i].stride
+                || stream.data.size() != mesh_data.vertices_count * streams[i].stride) {
+                LOG_ERROR("MeshFile: stream {0} has {1} bytes, expected {2} vertices of {3} bytes", i, stream.data.size(),
+                    mesh_data.vertices_count, streams[i].stride);
+                return false;
+            }
+            offset = align_up(offset + stream.data.size(), s_mesh_file_alignment);
+        }
+        header.index_data_offset = offset;
+        header.index_data_size = mesh_data.indices.size() * sizeof(uint32_t);
+        header.file_size = offset + header.index_data_size;
+
+        //        
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("MeshFile: can't create '{0}'", path);
+            return false;
+        }
+        const char zeros[s_mesh_file_alignment] = {};
+        auto write_section = [&file, &zeros](const uint64_t section_offset, const void* data, const uint64_t size) {
+            const uint64_t position = static_cast<uint64_t>(file.tellp());
+            file.write(zeros, static_cast<std::streamsize>(section_offset - position));
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        };
+        write_section(0, &header, sizeof(header));
+        write_section(header.streams_offset, streams.data(), streams.size() * sizeof(MeshStreamDesc));
+        write_section(header.submeshes_offset, mesh_data.submeshes.data(), mesh_data.submeshes.size() * sizeof(MeshSubmesh));
+        write_section(header.lods_offset, mesh_data.lods.data(), mesh_data.lods.size() * sizeof(MeshLOD));
+        for (size_t i = 0; i < mesh_data.streams.size(); ++i) {
+            write_section(streams[i].data_offset, mesh_data.streams[i].data.data(), mesh_data.streams[i].data.size());
+        }
+        write_section(header.index_data_offset, mesh_data.indices.data(), header.index_data_size);
+
+        if (!file) {
+            LOG_ERROR("MeshFile: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+}
\ No newline at end of file
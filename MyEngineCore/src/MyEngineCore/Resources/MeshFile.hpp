@@ -0,0 +1,143 @@
+#pragma once
+
+#include "MappedFile.hpp"
+#include "MyEngineCore/Rendering/OpenGL/VertexBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MyEngine {
+
+    //    (.mesh).     s_mesh_file_alignment,
+    //        GPU      
+
+    //  "MEMH",     
+    constexpr uint32_t s_mesh_file_magic = 0x484D454D;
+    constexpr uint32_t s_mesh_file_version = 1;
+    constexpr uint64_t s_mesh_file_alignment = 64;
+    //       
+    constexpr uint32_t s_mesh_stream_max_elements = 8;
+
+    //   (AABB  )
+    struct MeshBounds {
+        float min[3];
+        float max[3];
+        float center[3];
+        float radius;
+    };
+
+    //  
+    struct MeshFileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t header_size;
+        uint32_t flags;
+        uint64_t file_size;
+
+        //   ,    
+        uint32_t streams_count;
+        uint32_t submeshes_count;
+        uint32_t lods_count;
+        uint32_t reserved;
+
+        //     (  uint32)
+        uint64_t vertices_count;
+        uint64_t indices_count;
+
+        //       
+        uint64_t streams_offset;
+        uint64_t submeshes_offset;
+        uint64_t lods_offset;
+        uint64_t index_data_offset;
+        uint64_t index_data_size;
+
+        //   
+        MeshBounds bounds;
+    };
+
+    //   :   layout ( ShaderDataType)
+    struct MeshStreamDesc {
+        uint64_t data_offset;
+        uint64_t data_size;
+        uint32_t stride;
+        uint32_t elements_count;
+        uint8_t elements[s_mesh_stream_max_elements];
+    };
+
+    // :  ,  ,   
+    struct MeshSubmesh {
+        uint32_t first_index;
+        uint32_t indices_count;
+        int32_t base_vertex;
+        uint32_t material_index;
+        MeshBounds bounds;
+    };
+
+    //  :     ,    
+    struct MeshLOD {
+        uint32_t first_submesh;
+        uint32_t submeshes_count;
+        float screen_size;
+        uint32_t reserved;
+    };
+
+    static_assert(sizeof(MeshBounds) == 40, "MeshBounds layout changed");
+    static_assert(sizeof(MeshFileHeader) == 136, "MeshFileHeader layout changed");
+    static_assert(sizeof(MeshStreamDesc) == 32, "MeshStreamDesc layout changed");
+    static_assert(sizeof(MeshSubmesh) == 56, "MeshSubmesh layout changed");
+    static_assert(sizeof(MeshLOD) == 16, "MeshLOD layout changed");
+
+    //     (   )
+    struct MeshData {
+        //  : layout   
+        struct Stream {
+            std::vector<ShaderDataType> elements;
+            std::vector<unsigned char> data;
+        };
+
+        std::vector<Stream> streams;
+        std::vector<uint32_t> indices;
+        std::vector<MeshSubmesh> submeshes;
+        std::vector<MeshLOD> lods;
+        uint64_t vertices_count = 0;
+        MeshBounds bounds{};
+    };
+
+    // ,    .    -     
+    class MeshFile {
+    public:
+        //     (validate_indices -   ,    )
+        bool load(const std::string& path, const bool validate_indices = false);
+        //  
+        static bool write(const std::string& path, const MeshData& mesh_data);
+        //     (  Float3  )
+        static MeshBounds calculate_bounds(const float* positions, const size_t vertices_count, const size_t stride_in_floats);
+
+        const MeshFileHeader& get_header() const { return *m_pHeader; }
+        const MeshStreamDesc& get_stream(const size_t index) const { return m_pStreams[index]; }
+        const MeshSubmesh* get_submeshes() const { return m_pSubmeshes; }
+        const MeshLOD* get_lods() const { return m_pLods; }
+
+        //          
+        const void* get_stream_data(const size_t index) const { return m_file.get_data() + m_pStreams[index].data_offset; }
+        const uint32_t* get_indices() const { return reinterpret_cast<const uint32_t*>(m_file.get_data() + m_pHeader->index_data_offset); }
+        // Layout    VertexBuffer
+        BufferLayout get_stream_layout(const size_t index) const;
+
+        bool is_loaded() const { return m_pHeader != nullptr; }
+
+    private:
+        //     ,      
+        bool validate_header() const;
+        bool validate(const bool validate_indices) const;
+
+        MappedFile m_file;
+        const MeshFileHeader* m_pHeader = nullptr;
+        const MeshStreamDesc* m_pStreams = nullptr;
+        const MeshSubmesh* m_pSubmeshes = nullptr;
+        const MeshLOD* m_pLods = nullptr;
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "MeshImporter.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+
+namespace MyEngine {
+
+    //     
+    static std::string get_extension(const std::string& path) {
+        const size_t dot = path.find_last_of('.');
+        if (dot == std::string::npos) {
+            return {};
+        }
+        std::string extension = path.substr(dot + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+            [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+
+    //   
+    bool MeshImporter::import(const std::string& path, MeshData& mesh_data) {
+        const std::string extension = get_extension(path);
+        if (extension == "obj") {
+            return import_obj(path, mesh_data);
+        }
+        if (extension == "gltf" || extension == "glb") {
+            return import_gltf(path, mesh_data);
+        }
+        LOG_ERROR("MeshImporter: unsupported file '{0}'", path);
+        return false;
+    }
+
+    //     .mesh
+    bool MeshImporter::convert(const std::string& source_path, const std::string& mesh_path) {
+        MeshData mesh_data;
+        if (!import(source_path, mesh_data)) {
+            return false;
+        }
+        return MeshFile::write(mesh_path, mesh_data);
+    }
+
+    //      MeshData:   ,  LOD   
+    void MeshImporter::build_mesh_data(std::vector<MeshVertex>&& vertices, std::vector<uint32_t>&& indices,
+        std::vector<MeshSubmesh>&& submeshes, MeshData& mesh_data) {
+        mesh_data = MeshData();
+        mesh_data.vertices_count = vertices.size();
+        mesh_data.bounds = MeshFile::calculate_bounds(vertices.empty() ? nullptr : vertices.front().position,
+            vertices.size(), sizeof(MeshVertex) / sizeof(float));
+
+        //      
+        for (MeshSubmesh& submesh : submeshes) {
+            MeshBounds& bounds = submesh.bounds;
+            bounds = mesh_data.bounds;
+            if (submesh.indices_count == 0) {
+                continue;
+            }
+            for (int axis = 0; axis < 3; ++axis) {
+                bounds.min[axis] = mesh_data.bounds.max[axis];
+                bounds.max[axis] = mesh_data.bounds.min[axis];
+            }
+            for (uint32_t i = submesh.first_index; i < submesh.first_index + submesh.indices_count; ++i) {
+                const float* position = vertices[indices[i] + submesh.base_vertex].position;
+                for (int axis = 0; axis < 3; ++axis) {
+                    bounds.min[axis] = std::min(bounds.min[axis], position[axis]);
+                    bounds.max[axis] = std::max(bounds.max[axis], position[axis]);
+                }
+            }
+            float radius_squared = 0.f;
+            for (int axis = 0; axis < 3; ++axis) {
+                bounds.center[axis] = (bounds.min[axis] + bounds.max[axis]) * 0.5f;
+                const float half_extent = (bounds.max[axis] - bounds.min[axis]) * 0.5f;
+                radius_squared += half_extent * half_extent;
+            }
+            bounds.radius = std::sqrt(radius_squared);
+        }
+
+        MeshData::Stream stream;
+        stream.elements = { ShaderDataType::Float3, ShaderDataType::Float3, ShaderDataType::Float2 };
+        stream.data.resize(vertices.size() * sizeof(MeshVertex));
+        if (!vertices.empty()) {
+            std::memcpy(stream.data.data(), vertices.data(), stream.data.size());
+        }
+        mesh_data.streams.push_back(std::move(stream));
+        mesh_data.indices = std::move(indices);
+        mesh_data.submeshes = std::move(submeshes);
+        mesh_data.lods.push_back({ 0, static_cast<uint32_t>(mesh_data.submeshes.size()), 0.f, 0 });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "MeshFile.hpp"
+
+#include <string>
+
+namespace MyEngine {
+
+    //    (layout Float3, Float3, Float2 -     Application)
+    struct MeshVertex {
+        float position[3];
+        float normal[3];
+        float uv[2];
+    };
+
+    //    MeshData (   .mesh    Mesh)
+    class MeshImporter {
+    public:
+        //     (.obj, .gltf, .glb)
+        static bool import(const std::string& path, MeshData& mesh_data);
+        // Wavefront OBJ:         
+        static bool import_obj(const std::string& path, MeshData& mesh_data);
+        // glTF 2.0: JSON   .bin   base64 ,    .glb
+        static bool import_gltf(const std::string& path, MeshData& mesh_data);
+        //       .mesh
+        static bool convert(const std::string& source_path, const std::string& mesh_path);
+
+        //  MeshData      (   )
+        static void build_mesh_data(std::vector<MeshVertex>&& vertices, std::vector<uint32_t>&& indices,
+            std::vector<MeshSubmesh>&& submeshes, MeshData& mesh_data);
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,685 @@
+#include "MeshImporter.hpp"
+
+#include "MyEngineCore/Core/Parallel.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+namespace MyEngine {
+
+    // ,    (, f 1//2   )
+    constexpr uint32_t s_obj_missing_index = 0xFFFFFFFF;
+    //       
+    constexpr size_t s_obj_chunk_size = 4 << 20;
+
+    //   OBJ:  ,    
+    struct ObjVertexKey {
+        uint32_t position;
+        uint32_t uv;
+        uint32_t normal;
+
+        bool operator==(const ObjVertexKey& other) const {
+            return position == other.position && uv == other.uv && normal == other.normal;
+        }
+    };
+
+    // -       
+    class ObjVertexMap {
+    public:
+        explicit ObjVertexMap(const size_t expected_count) {
+            size_t capacity = 64;
+            while (capacity < expected_count * 2) {
+                capacity *= 2;
+            }
+            m_keys.resize(capacity);
+            m_values.assign(capacity, s_obj_missing_index);
+            m_mask = capacity - 1;
+        }
+
+        //  ,   -  new_value
+        uint32_t find_or_insert(const ObjVertexKey& key, const uint32_t new_value, bool& inserted) {
+            if ((m_count + 1) * 2 > m_values.size()) {
+                grow();
+            }
+            size_t slot = hash(key) & m_mask;
+            while (m_values[slot] != s_obj_missing_index) {
+                if (m_keys[slot] == key) {
+                    inserted = false;
+                    return m_values[slot];
+                }
+                slot = (slot + 1) & m_mask;
+            }
+            m_keys[slot] = key;
+            m_values[slot] = new_value;
+            ++m_count;
+            inserted = true;
+            return new_value;
+        }
+
+    private:
+        //   
+        static size_t hash(const ObjVertexKey& key) {
+            uint64_t h = key.position * 0x9E3779B97F4A7C15ull;
+            h ^= (key.uv + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+            h ^= (key.normal + 0x8CB92BA72F3D8DD7ull) * 0x165667B19E3779F9ull;
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+
+        //     
+        void grow() {
+            std::vector<ObjVertexKey> keys(m_keys.size() * 2);
+            std::vector<uint32_t> values(m_values.size() * 2, s_obj_missing_index);
+            const size_t mask = keys.size() - 1;
+            for (size_t i = 0; i < m_values.size(); ++i) {
+                if (m_values[i] == s_obj_missing_index) {
+                    continue;
+                }
+                size_t slot = hash(m_keys[i]) & mask;
+                while (values[slot] != s_obj_missing_index) {
+                    slot = (slot + 1) & mask;
+                }
+                keys[slot] = m_keys[i];
+                values[slot] = m_values[i];
+            }
+            m_keys.swap(keys);
+            m_values.swap(values);
+            m_mask = mask;
+        }
+
+        std::vector<ObjVertexKey> m_keys;
+        std::vector<uint32_t> m_values;
+        size_t m_mask = 0;
+        size_t m_count = 0;
+    };
+
+    //  ,   ,    
+    struct ObjChunk {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+
+        //     ( )       
+        uint32_t positions_count = 0;
+        uint32_t uvs_count = 0;
+        uint32_t normals_count = 0;
+        uint32_t positions_base = 0;
+        uint32_t uvs_base = 0;
+        uint32_t normals_base = 0;
+
+        //  : ,      ( ,  )
+        std::vector<float> positions;
+        std::vector<float> uvs;
+        std::vector<float> normals;
+        std::vector<ObjVertexKey> corners;
+        std::vector<std::pair<size_t, std::string>> material_switches;
+
+        //  :   ,   ,   
+        std::vector<uint32_t> local_indices;
+        std::vector<ObjVertexKey> unique_keys;
+        std::vector<uint32_t> remap;
+        //   
+        std::vector<uint32_t> triangle_materials;
+
+        bool failed = false;
+    };
+
+    //    
+    static const char* skip_blanks(const char* p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t')) {
+            ++p;
+        }
+        return p;
+    }
+
+    //      :   19          10.
+    //      nullptr
+    static const char* parse_float(const char* p, const char* end, float& value) {
+        static const double s_powers_of_10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        p = skip_blanks(p, end);
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            ++p;
+        }
+        uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool has_digits = false;
+        //  
+        while (p < end && static_cast<unsigned>(*p - '0') < 10) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+                digits += mantissa != 0;
+            }
+            else {
+                ++exponent;
+            }
+            has_digits = true;
+            ++p;
+        }
+        //  
+        if (p < end && *p == '.') {
+            ++p;
+            while (p < end && static_cast<unsigned>(*p - '0') < 10) {
+                if (digits < 19) {
+                    mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+                    digits += mantissa != 0;
+                    --exponent;
+                }
+                has_digits = true;
+                ++p;
+            }
+        }
+        if (!has_digits) {
+            return nullptr;
+        }
+        //  
+        if (p < end && (*p == 'e' || *p == 'E')) {
+            ++p;
+            bool negative_exponent = false;
+            if (p < end && (*p == '-' || *p == '+')) {
+                negative_exponent = *p == '-';
+                ++p;
+            }
+            int written_exponent = 0;
+            while (p < end && static_cast<unsigned>(*p - '0') < 10) {
+                written_exponent = std::min(written_exponent * 10 + (*p - '0'), 10000);
+                ++p;
+            }
+            exponent += negative_exponent ? -written_exponent : written_exponent;
+        }
+        double result = static_cast<double>(mantissa);
+        if (exponent >= 0 && exponent <= 22) {
+            result *= s_powers_of_10[exponent];
+        }
+        else if (exponent < 0 && exponent >= -22) {
+            result /= s_powers_of_10[-exponent];
+        }
+        else if (mantissa != 0) {
+            result *= std::pow(10.0, exponent);
+        }
+        value = static_cast<float>(negative ? -result : result);
+        return p;
+    }
+
+    //    .    int64_t -  ,   
+    static const char* parse_int(const char* p, const char* end, int64_t& value) {
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            ++p;
+        }
+        if (p >= end || static_cast<unsigned>(*p - '0') >= 10) {
+            return nullptr;
+        }
+        int64_t result = 0;
+        while (p < end && static_cast<unsigned>(*p - '0') < 10) {
+            const int digit = *p - '0';
+            if (result > (std::numeric_limits<int64_t>::max() - digit) / 10) {
+                return nullptr;
+            }
+            result = result * 10 + digit;
+            ++p;
+        }
+        value = negative ? -result : result;
+        return p;
+    }
+
+    //  OBJ ( ,  -  )   . ,    uint32_t, - 
+    static uint32_t resolve_obj_index(const int64_t index, const uint32_t current_count) {
+        if (index > 0 && index <= static_cast<int64_t>(s_obj_missing_index)) {
+            return static_cast<uint32_t>(index - 1);
+        }
+        if (index < 0 && -index <= static_cast<int64_t>(current_count)) {
+            return static_cast<uint32_t>(current_count + index);
+        }
+        return s_obj_missing_index;
+    }
+
+    //   OBJ
+    enum class EObjLine {
+        Position,
+        UV,
+        Normal,
+        Face,
+        Material,
+        Other
+    };
+
+    //   , p -    ,     
+    static EObjLine classify_obj_line(const char*& p, const char* end) {
+        const size_t length = static_cast<size_t>(end - p);
+        if (length >= 2 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
+            p += 2;
+            return EObjLine::Position;
+        }
+        if (length >= 3 && p[0] == 'v' && (p[2] == ' ' || p[2] == '\t')) {
+            if (p[1] == 't') {
+                p += 3;
+                return EObjLine::UV;
+            }
+            if (p[1] == 'n') {
+                p += 3;
+                return EObjLine::Normal;
+            }
+        }
+        if (length >= 2 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+            p += 2;
+            return EObjLine::Face;
+        }
+        if (length >= 7 && std::strncmp(p, "usemtl", 6) == 0 && (p[6] == ' ' || p[6] == '\t')) {
+            p += 7;
+            return EObjLine::Material;
+        }
+        return EObjLine::Other;
+    }
+
+    //   
+    template<typename Function>
+    static void for_each_obj_line(const char* begin, const char* end, Function&& function) {
+        const char* line = begin;
+        while (line < end) {
+            const char* line_end = static_cast<const char*>(std::memchr(line, '\n', static_cast<size_t>(end - line)));
+            if (!line_end) {
+                line_end = end;
+            }
+            const char* p = skip_blanks(line, line_end);
+            const char* content_end = line_end;
+            if (content_end > p && content_end[-1] == '\r') {
+                --content_end;
+            }
+            function(p, content_end);
+            line = line_end + 1;
+        }
+    }
+
+    //  :   v, vt  vn    
+    static void count_obj_chunk(ObjChunk& chunk) {
+        for_each_obj_line(chunk.begin, chunk.end, [&chunk](const char* p, const char* end) {
+            switch (classify_obj_line(p, end)) {
+            case EObjLine::Position: ++chunk.positions_count; break;
+            case EObjLine::UV: ++chunk.uvs_count; break;
+            case EObjLine::Normal: ++chunk.normals_count; break;
+            default: break;
+            }
+        });
+    }
+
+    //  
+    static void parse_obj_chunk(ObjChunk& chunk) {
+        chunk.positions.reserve(chunk.positions_count * 3);
+        chunk.uvs.reserve(chunk.uvs_count * 2);
+        chunk.normals.reserve(chunk.normals_count * 3);
+        std::vector<ObjVertexKey> polygon;
+
+        //   required  count   target,   
+        auto parse_floats = [&chunk](const char* p, const char* end, const int required, const int count, std::vector<float>& target) {
+            for (int i = 0; i < count; ++i) {
+                float value = 0.f;
+                const char* next = parse_float(p, end, value);
+                if (!next && i < required) {
+                    chunk.failed = true;
+                    return;
+                }
+                if (next) {
+                    p = next;
+                }
+                target.push_back(value);
+            }
+        };
+
+        for_each_obj_line(chunk.begin, chunk.end, [&](const char* p, const char* end) {
+            if (chunk.failed) {
+                return;
+            }
+            switch (classify_obj_line(p, end)) {
+            case EObjLine::Position:
+                parse_floats(p, end, 3, 3, chunk.positions);
+                break;
+            case EObjLine::Normal:
+                parse_floats(p, end, 3, 3, chunk.normals);
+                break;
+            case EObjLine::UV:
+                //   vt ( ) 
+                parse_floats(p, end, 1, 2, chunk.uvs);
+                break;
+            case EObjLine::Face: {
+                //       (  )
+                const uint32_t positions_count = chunk.positions_base + static_cast<uint32_t>(chunk.positions.size() / 3);
+                const uint32_t uvs_count = chunk.uvs_base + static_cast<uint32_t>(chunk.uvs.size() / 2);
+                const uint32_t normals_count = chunk.normals_base + static_cast<uint32_t>(chunk.normals.size() / 3);
+                polygon.clear();
+                while (true) {
+                    p = skip_blanks(p, end);
+                    if (p >= end) {
+                        break;
+                    }
+                    int64_t index = 0;
+                    p = parse_int(p, end, index);
+                    if (!p) {
+                        chunk.failed = true;
+                        return;
+                    }
+                    ObjVertexKey key{ resolve_obj_index(index, positions_count), s_obj_missing_index, s_obj_missing_index };
+                    if (p < end && *p == '/') {
+                        ++p;
+                        if (p < end && *p != '/') {
+                            p = parse_int(p, end, index);
+                            if (!p) {
+                                chunk.failed = true;
+                                return;
+                            }
+                            key.uv = resolve_obj_index(index, uvs_count);
+                        }
+                        if (p < end && *p == '/') {
+                            ++p;
+                            p = parse_int(p, end, index);
+                            if (!p) {
+                                chunk.failed = true;
+                                return;
+                            }
+                            key.normal = resolve_obj_index(index, normals_count);
+                        }
+                    }
+                    if (key.position == s_obj_missing_index) {
+                        chunk.failed = true;
+                        return;
+                    }
+                    polygon.push_back(key);
+                }
+                //     
+                for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+                    chunk.corners.push_back(polygon[0]);
+                    chunk.corners.push_back(polygon[i]);
+                    chunk.corners.push_back(polygon[i + 1]);
+                }
+                break;
+            }
+            case EObjLine::Material:
+                chunk.material_switches.emplace_back(chunk.corners.size(), std::string(skip_blanks(p, end), end));
+                break;
+            default:
+                break;
+            }
+        });
+    }
+
+    //     
+    static void deduplicate_obj_chunk(ObjChunk& chunk, const uint32_t positions_total, const uint32_t uvs_total, const uint32_t normals_total) {
+        ObjVertexMap map(chunk.corners.size() / 2);
+        chunk.local_indices.resize(chunk.corners.size());
+        for (size_t i = 0; i < chunk.corners.size(); ++i) {
+            const ObjVertexKey& key = chunk.corners[i];
+            if (key.position >= positions_total
+                || (key.uv != s_obj_missing_index && key.uv >= uvs_total)
+                || (key.normal != s_obj_missing_index && key.normal >= normals_total)) {
+                chunk.failed = true;
+                return;
+            }
+            bool inserted = false;
+            chunk.local_indices[i] = map.find_or_insert(key, static_cast<uint32_t>(chunk.unique_keys.size()), inserted);
+            if (inserted) {
+                chunk.unique_keys.push_back(key);
+            }
+        }
+    }
+
+    //  OBJ
+    bool MeshImporter::import_obj(const std::string& path, MeshData& mesh_data) {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        MappedFile file;
+        if (!file.open(path)) {
+            return false;
+        }
+        const char* const data = reinterpret_cast<const char*>(file.get_data());
+        const char* const data_end = data + file.get_size();
+
+        //      
+        std::vector<ObjChunk> chunks;
+        const char* chunk_begin = data;
+        while (chunk_begin < data_end) {
+            const char* chunk_end = chunk_begin + std::min(s_obj_chunk_size, static_cast<size_t>(data_end - chunk_begin));
+            if (chunk_end < data_end) {
+                const char* line_end = static_cast<const char*>(std::memchr(chunk_end, '\n', static_cast<size_t>(data_end - chunk_end)));
+                chunk_end = line_end ? line_end + 1 : data_end;
+            }
+            chunks.emplace_back();
+            chunks.back().begin = chunk_begin;
+            chunks.back().end = chunk_end;
+            chunk_begin = chunk_end;
+        }
+
+        //        
+        parallel_for(chunks.size(), 1, [&chunks](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                count_obj_chunk(chunks[i]);
+            }
+        });
+        uint64_t positions_total = 0;
+        uint64_t uvs_total = 0;
+        uint64_t normals_total = 0;
+        for (ObjChunk& chunk : chunks) {
+            chunk.positions_base = static_cast<uint32_t>(positions_total);
+            chunk.uvs_base = static_cast<uint32_t>(uvs_total);
+            chunk.normals_base = static_cast<uint32_t>(normals_total);
+            positions_total += chunk.positions_count;
+            uvs_total += chunk.uvs_count;
+            normals_total += chunk.normals_count;
+        }
+        if (positions_total >= s_obj_missing_index || uvs_total >= s_obj_missing_index || normals_total >= s_obj_missing_index) {
+            LOG_ERROR("MeshImporter: '{0}' has too many vertices", path);
+            return false;
+        }
+
+        //   
+        parallel_for(chunks.size(), 1, [&chunks](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                parse_obj_chunk(chunks[i]);
+            }
+        });
+
+        //    
+        parallel_for(chunks.size(), 1, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (!chunks[i].failed) {
+                    deduplicate_obj_chunk(chunks[i], static_cast<uint32_t>(positions_total),
+                        static_cast<uint32_t>(uvs_total), static_cast<uint32_t>(normals_total));
+                }
+            }
+        });
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            if (chunks[i].failed) {
+                LOG_ERROR("MeshImporter: '{0}' is malformed (chunk {1})", path, i);
+                return false;
+            }
+        }
+
+        //      (),   .
+        //    usemtl    0 ()
+        std::unordered_map<std::string, uint32_t> material_indices;
+        for (const ObjChunk& chunk : chunks) {
+            if (chunk.corners.empty() && chunk.material_switches.empty()) {
+                continue;
+            }
+            if (!chunk.corners.empty() && (chunk.material_switches.empty() || chunk.material_switches.front().first > 0)) {
+                material_indices.emplace(std::string(), 0);
+            }
+            break;
+        }
+        uint32_t current_material = 0;
+        uint32_t materials_count = 1;
+        for (ObjChunk& chunk : chunks) {
+            chunk.triangle_materials.resize(chunk.corners.size() / 3);
+            size_t switch_index = 0;
+            for (size_t triangle = 0; triangle < chunk.triangle_materials.size(); ++triangle) {
+                while (switch_index < chunk.material_switches.size() && chunk.material_switches[switch_index].first <= triangle * 3) {
+                    const auto found = material_indices.emplace(chunk.material_switches[switch_index].second,
+                        static_cast<uint32_t>(material_indices.size()));
+                    current_material = found.first->second;
+                    materials_count = std::max(materials_count, current_material + 1);
+                    ++switch_index;
+                }
+                chunk.triangle_materials[triangle] = current_material;
+            }
+            //         
+            for (; switch_index < chunk.material_switches.size(); ++switch_index) {
+                const auto found = material_indices.emplace(chunk.material_switches[switch_index].second,
+                    static_cast<uint32_t>(material_indices.size()));
+                current_material = found.first->second;
+                materials_count = std::max(materials_count, current_material + 1);
+            }
+        }
+
+        //   :     
+        size_t unique_total = 0;
+        for (const ObjChunk& chunk : chunks) {
+            unique_total += chunk.unique_keys.size();
+        }
+        ObjVertexMap global_map(unique_total);
+        std::vector<ObjVertexKey> vertex_keys;
+        vertex_keys.reserve(unique_total);
+        for (ObjChunk& chunk : chunks) {
+            chunk.remap.resize(chunk.unique_keys.size());
+            for (size_t i = 0; i < chunk.unique_keys.size(); ++i) {
+                bool inserted = false;
+                chunk.remap[i] = global_map.find_or_insert(chunk.unique_keys[i], static_cast<uint32_t>(vertex_keys.size()), inserted);
+                if (inserted) {
+                    vertex_keys.push_back(chunk.unique_keys[i]);
+                }
+            }
+        }
+
+        //       :      
+        std::vector<size_t> material_offsets(materials_count + 1, 0);
+        std::vector<std::vector<size_t>> chunk_material_offsets(chunks.size(), std::vector<size_t>(materials_count, 0));
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            for (const uint32_t material : chunks[i].triangle_materials) {
+                chunk_material_offsets[i][material] += 3;
+            }
+        }
+        for (uint32_t material = 0; material < materials_count; ++material) {
+            size_t offset = material_offsets[material];
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                const size_t count = chunk_material_offsets[i][material];
+                chunk_material_offsets[i][material] = offset;
+                offset += count;
+            }
+            material_offsets[material + 1] = offset;
+        }
+        std::vector<uint32_t> indices(material_offsets[materials_count]);
+        parallel_for(chunks.size(), 1, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const ObjChunk& chunk = chunks[i];
+                std::vector<size_t>& cursors = chunk_material_offsets[i];
+                for (size_t triangle = 0; triangle < chunk.triangle_materials.size(); ++triangle) {
+                    size_t& cursor = cursors[chunk.triangle_materials[triangle]];
+                    for (size_t corner = triangle * 3; corner < triangle * 3 + 3; ++corner) {
+                        indices[cursor++] = chunk.remap[chunk.local_indices[corner]];
+                    }
+                }
+            }
+        });
+
+        //       
+        std::vector<float> positions(positions_total * 3);
+        std::vector<float> uvs(uvs_total * 2);
+        std::vector<float> normals(normals_total * 3);
+        parallel_for(chunks.size(), 1, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const ObjChunk& chunk = chunks[i];
+                std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + size_t(chunk.positions_base) * 3);
+                std::copy(chunk.uvs.begin(), chunk.uvs.end(), uvs.begin() + size_t(chunk.uvs_base) * 2);
+                std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + size_t(chunk.normals_base) * 3);
+            }
+        });
+        chunks.clear();
+
+        // 
+        std::vector<MeshVertex> vertices(vertex_keys.size());
+        std::atomic<bool> missing_normals{ false };
+        parallel_for(vertices.size(), 4096, [&](const size_t begin, const size_t end) {
+            bool chunk_missing_normals = false;
+            for (size_t i = begin; i < end; ++i) {
+                const ObjVertexKey& key = vertex_keys[i];
+                MeshVertex& vertex = vertices[i];
+                std::memcpy(vertex.position, &positions[size_t(key.position) * 3], sizeof(vertex.position));
+                if (key.uv != s_obj_missing_index) {
+                    std::memcpy(vertex.uv, &uvs[size_t(key.uv) * 2], sizeof(vertex.uv));
+                }
+                else {
+                    vertex.uv[0] = vertex.uv[1] = 0.f;
+                }
+                if (key.normal != s_obj_missing_index) {
+                    std::memcpy(vertex.normal, &normals[size_t(key.normal) * 3], sizeof(vertex.normal));
+                }
+                else {
+                    vertex.normal[0] = vertex.normal[1] = vertex.normal[2] = 0.f;
+                    chunk_missing_normals = true;
+                }
+            }
+            if (chunk_missing_normals) {
+                missing_normals = true;
+            }
+        });
+
+        //     -     
+        if (missing_normals) {
+            std::vector<float> accumulated(vertices.size() * 3, 0.f);
+            for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+                const float* a = vertices[indices[i]].position;
+                const float* b = vertices[indices[i + 1]].position;
+                const float* c = vertices[indices[i + 2]].position;
+                const float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+                const float ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+                const float normal[3] = { ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0] };
+                for (size_t corner = i; corner < i + 3; ++corner) {
+                    for (int axis = 0; axis < 3; ++axis) {
+                        accumulated[size_t(indices[corner]) * 3 + axis] += normal[axis];
+                    }
+                }
+            }
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                if (vertex_keys[i].normal != s_obj_missing_index) {
+                    continue;
+                }
+                const float* normal = &accumulated[i * 3];
+                const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+                for (int axis = 0; axis < 3; ++axis) {
+                    vertices[i].normal[axis] = length > 0.f ? normal[axis] / length : 0.f;
+                }
+            }
+        }
+
+        //     
+        std::vector<MeshSubmesh> submeshes;
+        for (uint32_t material = 0; material < materials_count; ++material) {
+            if (material_offsets[material + 1] == material_offsets[material]) {
+                continue;
+            }
+            MeshSubmesh submesh{};
+            submesh.first_index = static_cast<uint32_t>(material_offsets[material]);
+            submesh.indices_count = static_cast<uint32_t>(material_offsets[material + 1] - material_offsets[material]);
+            submesh.material_index = material;
+            submeshes.push_back(submesh);
+        }
+
+        const size_t vertices_count = vertices.size();
+        const size_t indices_count = indices.size();
+        build_mesh_data(std::move(vertices), std::move(indices), std::move(submeshes), mesh_data);
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        LOG_INFO("MeshImporter: '{0}' imported in {1:.3f} s ({2} vertices, {3} triangles, {4} submeshes)",
+            path, seconds, vertices_count, indices_count / 3, mesh_data.submeshes.size());
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "ProceduralTexture.hpp"
+
+#include "MyEngineCore/Core/Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace MyEngine {
+
+    //      (48  -  16- )
+    constexpr size_t s_span_block_pixels = 16;
+    //       
+    constexpr size_t s_pixels_per_task = 64 * 1024;
+
+    //    :   16     ,
+    // memcpy       
+    static void fill_span(unsigned char* row, const unsigned int x_begin, const unsigned int x_end, const ColorRGB8 color) {
+        unsigned char pattern[s_span_block_pixels * 3];
+        for (size_t i = 0; i < s_span_block_pixels; ++i) {
+            pattern[i * 3 + 0] = color.r;
+            pattern[i * 3 + 1] = color.g;
+            pattern[i * 3 + 2] = color.b;
+        }
+        unsigned char* destination = row + static_cast<size_t>(x_begin) * 3;
+        size_t count = x_end - x_begin;
+        for (; count >= s_span_block_pixels; count -= s_span_block_pixels) {
+            std::memcpy(destination, pattern, sizeof(pattern));
+            destination += sizeof(pattern);
+        }
+        std::memcpy(destination, pattern, count * 3);
+    }
+
+    // 
+    ProceduralTexture::ProceduralTexture(const unsigned int width, const unsigned int height) : m_width(width), m_height(height) {
+    }
+
+    // 
+    void ProceduralTexture::set_background(const ColorRGB8 color) {
+        m_background = color;
+    }
+
+    // :    ,        
+    void ProceduralTexture::add_circle(const unsigned int center_x, const unsigned int center_y, const unsigned int radius, const ColorRGB8 color) {
+        Shape shape{};
+        shape.type = Shape::EType::Circle;
+        shape.color = color;
+        shape.center_x = center_x;
+        shape.center_y = center_y;
+        shape.radius_squared = static_cast<long long>(radius) * radius;
+        const long long y_begin = shape.center_y - radius + 1;
+        const long long y_end = shape.center_y + radius;
+        shape.y_begin = static_cast<unsigned int>(std::clamp<long long>(y_begin, 0, m_height));
+        shape.y_end = static_cast<unsigned int>(std::clamp<long long>(y_end, 0, m_height));
+        shape.x_begin = 0;
+        shape.x_end = m_width;
+        if (shape.y_begin < shape.y_end) {
+            m_shapes.push_back(shape);
+        }
+    }
+
+    // 
+    void ProceduralTexture::add_rectangle(const unsigned int x_begin, const unsigned int y_begin, const unsigned int x_end, const unsigned int y_end,
+        const ColorRGB8 color) {
+        Shape shape{};
+        shape.type = Shape::EType::Rectangle;
+        shape.color = color;
+        shape.x_begin = std::min(x_begin, m_width);
+        shape.x_end = std::min(x_end, m_width);
+        shape.y_begin = std::min(y_begin, m_height);
+        shape.y_end = std::min(y_end, m_height);
+        if (shape.x_begin < shape.x_end && shape.y_begin < shape.y_end) {
+            m_shapes.push_back(shape);
+        }
+    }
+
+    //  :    ,       
+    void ProceduralTexture::generate_rows(unsigned char* data, const size_t row_pitch, const unsigned int y_begin, const unsigned int y_end) const {
+        for (unsigned int y = y_begin; y < y_end; ++y) {
+            unsigned char* row = data + y * row_pitch;
+            fill_span(row, 0, m_width, m_background);
+
+            for (const Shape& shape : m_shapes) {
+                if (y < shape.y_begin || y >= shape.y_end) {
+                    continue;
+                }
+                if (shape.type == Shape::EType::Rectangle) {
+                    fill_span(row, shape.x_begin, shape.x_end, shape.color);
+                    continue;
+                }
+
+                //     :  h,   h^2 < r^2 - dy^2
+                const long long dy = static_cast<long long>(y) - shape.center_y;
+                const long long remainder = shape.radius_squared - dy * dy;
+                if (remainder <= 0) {
+                    continue;
+                }
+                long long half_width = static_cast<long long>(std::sqrt(static_cast<double>(remainder - 1)));
+                while ((half_width + 1) * (half_width + 1) < remainder) {
+                    ++half_width;
+                }
+                while (half_width * half_width >= remainder) {
+                    --half_width;
+                }
+                const long long x_begin = std::max<long long>(shape.center_x - half_width, 0);
+                const long long x_end = std::min<long long>(shape.center_x + half_width + 1, m_width);
+                if (x_begin < x_end) {
+                    fill_span(row, static_cast<unsigned int>(x_begin), static_cast<unsigned int>(x_end), shape.color);
+                }
+            }
+        }
+    }
+
+    // :    
+    void ProceduralTexture::generate(unsigned char* data, size_t row_pitch) const {
+        if (row_pitch == 0) {
+            row_pitch = static_cast<size_t>(m_width) * 3;
+        }
+        const size_t rows_per_task = std::max<size_t>(1, s_pixels_per_task / std::max(m_width, 1u));
+        parallel_for(m_height, rows_per_task, [&](const size_t begin, const size_t end) {
+            generate_rows(data, row_pitch, static_cast<unsigned int>(begin), static_cast<unsigned int>(end));
+        });
+    }
+
+    //  
+    ProceduralTexture ProceduralTexture::smile(const unsigned int width, const unsigned int height) {
+        ProceduralTexture texture(width, height);
+        // background
+        texture.set_background({ 200, 191, 231 });
+
+        // face - 
+        texture.add_circle(static_cast<unsigned int>(width * 0.5), static_cast<unsigned int>(height * 0.5), static_cast<unsigned int>(width * 0.4), { 255, 255, 0 });
+
+        // smile - /
+        texture.add_circle(static_cast<unsigned int>(width * 0.5), static_cast<unsigned int>(height * 0.4), static_cast<unsigned int>(width * 0.2), { 0, 0, 0 });
+        texture.add_circle(static_cast<unsigned int>(width * 0.5), static_cast<unsigned int>(height * 0.45), static_cast<unsigned int>(width * 0.2), { 255, 255, 0 });
+
+        // eyes - 
+        texture.add_circle(static_cast<unsigned int>(width * 0.35), static_cast<unsigned int>(height * 0.6), static_cast<unsigned int>(width * 0.07), { 255, 0, 255 });
+        texture.add_circle(static_cast<unsigned int>(width * 0.65), static_cast<unsigned int>(height * 0.6), static_cast<unsigned int>(width * 0.07), { 0, 0, 255 });
+        return texture;
+    }
+
+    //   
+    ProceduralTexture ProceduralTexture::quads(const unsigned int width, const unsigned int height) {
+        ProceduralTexture texture(width, height);
+        texture.set_background({ 255, 255, 255 });
+        texture.add_rectangle(0, 0, width / 2, height / 2, { 0, 0, 0 });
+        texture.add_rectangle(width / 2, height / 2, width, height, { 0, 0, 0 });
+        return texture;
+    }
+}
\ No newline at end of file
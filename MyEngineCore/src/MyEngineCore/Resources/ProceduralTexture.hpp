@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MyEngine {
+
+    //   RGB8
+    struct ColorRGB8 {
+        unsigned char r;
+        unsigned char g;
+        unsigned char b;
+    };
+
+    //   RGB8:  ,      .
+    //   :           ,
+    //     16 ,    
+    class ProceduralTexture {
+    public:
+        //  (  )
+        ProceduralTexture(const unsigned int width, const unsigned int height);
+
+        // 
+        void set_background(const ColorRGB8 color);
+        // : ,   dx^2 + dy^2 < radius^2
+        void add_circle(const unsigned int center_x, const unsigned int center_y, const unsigned int radius, const ColorRGB8 color);
+        //  [x_begin, x_end) x [y_begin, y_end)
+        void add_rectangle(const unsigned int x_begin, const unsigned int y_begin, const unsigned int x_end, const unsigned int y_end,
+            const ColorRGB8 color);
+
+        //    (     pixel unpack ), row_pitch = 0 -   
+        void generate(unsigned char* data, size_t row_pitch = 0) const;
+
+        unsigned int get_width() const { return m_width; }
+        unsigned int get_height() const { return m_height; }
+        size_t get_data_size() const { return static_cast<size_t>(m_width) * m_height * 3; }
+
+        //    
+        static ProceduralTexture smile(const unsigned int width, const unsigned int height);
+        static ProceduralTexture quads(const unsigned int width, const unsigned int height);
+
+    private:
+        //   ,   
+        struct Shape {
+            enum class EType {
+                Circle,
+                Rectangle
+            };
+
+            EType type;
+            ColorRGB8 color;
+            long long center_x;
+            long long center_y;
+            long long radius_squared;
+            unsigned int x_begin;
+            unsigned int x_end;
+            unsigned int y_begin;
+            unsigned int y_end;
+        };
+
+        //   [y_begin, y_end)
+        void generate_rows(unsigned char* data, const size_t row_pitch, const unsigned int y_begin, const unsigned int y_end) const;
+
+        unsigned int m_width;
+        unsigned int m_height;
+        ColorRGB8 m_background{ 0, 0, 0 };
+        std::vector<Shape> m_shapes;
+    };
+
+}
\ No newline at end of file
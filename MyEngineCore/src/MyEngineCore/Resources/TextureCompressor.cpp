@@ -0,0 +1,677 @@
+#include "TextureCompressor.hpp"
+
+#include "MyEngineCore/Core/Parallel.hpp"
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+namespace MyEngine {
+
+    //       
+    constexpr size_t s_blocks_per_task = 256;
+
+    //   4-  BC7 ( )
+    constexpr int s_bc7_weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    //  4x4  RGBA   [0, 255]
+    struct ColorBlock {
+        float pixels[16][4];
+    };
+
+    //       
+    static int get_refine_iterations(const ECompressionQuality quality) {
+        switch (quality) {
+        case ECompressionQuality::Fast: return 0;
+        case ECompressionQuality::Normal: return 1;
+        case ECompressionQuality::High: return 3;
+        }
+        return 0;
+    }
+
+    //  :      
+    static void load_block(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+        const unsigned int block_x, const unsigned int block_y, ColorBlock& block) {
+        for (unsigned int j = 0; j < 4; ++j) {
+            const unsigned int y = std::min(block_y * 4 + j, height - 1);
+            for (unsigned int i = 0; i < 4; ++i) {
+                const unsigned int x = std::min(block_x * 4 + i, width - 1);
+                const unsigned char* pixel = pixels + (static_cast<size_t>(y) * width + x) * channels;
+                float* destination = block.pixels[j * 4 + i];
+                destination[0] = pixel[0];
+                destination[1] = pixel[1];
+                destination[2] = pixel[2];
+                destination[3] = channels == 4 ? pixel[3] : 255.f;
+            }
+        }
+    }
+
+    //  ,      ( channels ).
+    // Fast -   ,  -    
+    static void find_endpoints(const ColorBlock& block, const int channels, const ECompressionQuality quality, float endpoint0[4], float endpoint1[4]) {
+        float min_color[4] = { 255.f, 255.f, 255.f, 255.f };
+        float max_color[4] = { 0.f, 0.f, 0.f, 0.f };
+        float mean[4] = {};
+        for (const auto& pixel : block.pixels) {
+            for (int c = 0; c < channels; ++c) {
+                min_color[c] = std::min(min_color[c], pixel[c]);
+                max_color[c] = std::max(max_color[c], pixel[c]);
+                mean[c] += pixel[c] / 16.f;
+            }
+        }
+
+        if (quality == ECompressionQuality::Fast) {
+            //   ,      
+            for (int c = 0; c < channels; ++c) {
+                const float inset = (max_color[c] - min_color[c]) / 16.f;
+                endpoint0[c] = min_color[c] + inset;
+                endpoint1[c] = max_color[c] - inset;
+            }
+            return;
+        }
+
+        //        
+        float covariance[4][4] = {};
+        for (const auto& pixel : block.pixels) {
+            for (int a = 0; a < channels; ++a) {
+                for (int b = a; b < channels; ++b) {
+                    covariance[a][b] += (pixel[a] - mean[a]) * (pixel[b] - mean[b]);
+                }
+            }
+        }
+        for (int a = 0; a < channels; ++a) {
+            for (int b = 0; b < a; ++b) {
+                covariance[a][b] = covariance[b][a];
+            }
+        }
+        float axis[4] = {};
+        for (int c = 0; c < channels; ++c) {
+            axis[c] = max_color[c] - min_color[c];
+        }
+        for (int iteration = 0; iteration < 8; ++iteration) {
+            float next[4] = {};
+            float length = 0.f;
+            for (int a = 0; a < channels; ++a) {
+                for (int b = 0; b < channels; ++b) {
+                    next[a] += covariance[a][b] * axis[b];
+                }
+                length = std::max(length, std::fabs(next[a]));
+            }
+            if (length < 1e-6f) {
+                break;
+            }
+            for (int c = 0; c < channels; ++c) {
+                axis[c] = next[c] / length;
+            }
+        }
+        float axis_length_squared = 0.f;
+        for (int c = 0; c < channels; ++c) {
+            axis_length_squared += axis[c] * axis[c];
+        }
+        if (axis_length_squared < 1e-12f) {
+            //  
+            for (int c = 0; c < channels; ++c) {
+                endpoint0[c] = endpoint1[c] = mean[c];
+            }
+            return;
+        }
+
+        //       
+        float min_projection = 1e30f;
+        float max_projection = -1e30f;
+        for (const auto& pixel : block.pixels) {
+            float projection = 0.f;
+            for (int c = 0; c < channels; ++c) {
+                projection += (pixel[c] - mean[c]) * axis[c];
+            }
+            min_projection = std::min(min_projection, projection);
+            max_projection = std::max(max_projection, projection);
+        }
+        for (int c = 0; c < channels; ++c) {
+            endpoint0[c] = std::clamp(mean[c] + axis[c] * min_projection / axis_length_squared, 0.f, 255.f);
+            endpoint1[c] = std::clamp(mean[c] + axis[c] * max_projection / axis_length_squared, 0.f, 255.f);
+        }
+    }
+
+    //       t ( = (1 - t) * e0 + t * e1)   
+    static bool refine_endpoints(const ColorBlock& block, const int channels, const float weights[16], float endpoint0[4], float endpoint1[4]) {
+        float a = 0.f;
+        float b = 0.f;
+        float c = 0.f;
+        float x0[4] = {};
+        float x1[4] = {};
+        for (int i = 0; i < 16; ++i) {
+            const float t = weights[i];
+            a += (1.f - t) * (1.f - t);
+            b += (1.f - t) * t;
+            c += t * t;
+            for (int channel = 0; channel < channels; ++channel) {
+                x0[channel] += (1.f - t) * block.pixels[i][channel];
+                x1[channel] += t * block.pixels[i][channel];
+            }
+        }
+        const float determinant = a * c - b * b;
+        if (std::fabs(determinant) < 1e-6f) {
+            return false;
+        }
+        for (int channel = 0; channel < channels; ++channel) {
+            endpoint0[channel] = std::clamp((c * x0[channel] - b * x1[channel]) / determinant, 0.f, 255.f);
+            endpoint1[channel] = std::clamp((a * x1[channel] - b * x0[channel]) / determinant, 0.f, 255.f);
+        }
+        return true;
+    }
+
+    //    
+    static float color_distance(const float* color0, const float* color1, const int channels) {
+        float distance = 0.f;
+        for (int c = 0; c < channels; ++c) {
+            const float delta = color0[c] - color1[c];
+            distance += delta * delta;
+        }
+        return distance;
+    }
+
+    //  16-  32-   little-endian
+    static void store_u16(unsigned char* output, const uint32_t value) {
+        output[0] = static_cast<unsigned char>(value);
+        output[1] = static_cast<unsigned char>(value >> 8);
+    }
+    static void store_u32(unsigned char* output, const uint32_t value) {
+        store_u16(output, value & 0xFFFF);
+        store_u16(output + 2, value >> 16);
+    }
+
+    //---------------------------------------//
+    // BC1:   RGB565  2- 
+
+    //    RGB565
+    static uint32_t pack_565(const float color[4]) {
+        const uint32_t r = static_cast<uint32_t>(std::clamp(color[0] * 31.f / 255.f + 0.5f, 0.f, 31.f));
+        const uint32_t g = static_cast<uint32_t>(std::clamp(color[1] * 63.f / 255.f + 0.5f, 0.f, 63.f));
+        const uint32_t b = static_cast<uint32_t>(std::clamp(color[2] * 31.f / 255.f + 0.5f, 0.f, 31.f));
+        return (r << 11) | (g << 5) | b;
+    }
+
+    //  RGB565  [0, 255]
+    static void unpack_565(const uint32_t packed, float color[4]) {
+        const uint32_t r = (packed >> 11) & 31;
+        const uint32_t g = (packed >> 5) & 63;
+        const uint32_t b = packed & 31;
+        color[0] = static_cast<float>((r << 3) | (r >> 2));
+        color[1] = static_cast<float>((g << 2) | (g >> 4));
+        color[2] = static_cast<float>((b << 3) | (b >> 2));
+        color[3] = 255.f;
+    }
+
+    //   BC1   .  ,  weights -   
+    //  (endpoint0, endpoint1)  
+    static float encode_bc1_endpoints(const ColorBlock& block, const float endpoint0[4], const float endpoint1[4], unsigned char* output, float weights[16]) {
+        uint32_t color0 = pack_565(endpoint0);
+        uint32_t color1 = pack_565(endpoint1);
+        //     color0 > color1
+        const bool swapped = color0 < color1;
+        if (swapped) {
+            std::swap(color0, color1);
+        }
+
+        float palette[4][4];
+        unpack_565(color0, palette[0]);
+        unpack_565(color1, palette[1]);
+        for (int c = 0; c < 3; ++c) {
+            palette[2][c] = (2.f * palette[0][c] + palette[1][c]) / 3.f;
+            palette[3][c] = (palette[0][c] + 2.f * palette[1][c]) / 3.f;
+        }
+        static constexpr float s_palette_weights[4] = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+        //       :    0
+        const int palette_size = color0 == color1 ? 1 : 4;
+
+        uint32_t indices = 0;
+        float error = 0.f;
+        for (int i = 0; i < 16; ++i) {
+            int best_index = 0;
+            float best_distance = color_distance(block.pixels[i], palette[0], 3);
+            for (int index = 1; index < palette_size; ++index) {
+                const float distance = color_distance(block.pixels[i], palette[index], 3);
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best_index = index;
+                }
+            }
+            indices |= static_cast<uint32_t>(best_index) << (i * 2);
+            error += best_distance;
+            weights[i] = swapped ? 1.f - s_palette_weights[best_index] : s_palette_weights[best_index];
+        }
+
+        store_u16(output, color0);
+        store_u16(output + 2, color1);
+        store_u32(output + 4, indices);
+        return error;
+    }
+
+    //   BC1
+    static void encode_bc1(const ColorBlock& block, const ECompressionQuality quality, unsigned char* output) {
+        float endpoint0[4];
+        float endpoint1[4];
+        find_endpoints(block, 3, quality, endpoint0, endpoint1);
+        float weights[16];
+        float best_error = encode_bc1_endpoints(block, endpoint0, endpoint1, output, weights);
+
+        unsigned char candidate[8];
+        for (int iteration = get_refine_iterations(quality); iteration > 0 && best_error > 0.f; --iteration) {
+            if (!refine_endpoints(block, 3, weights, endpoint0, endpoint1)) {
+                break;
+            }
+            float candidate_weights[16];
+            const float error = encode_bc1_endpoints(block, endpoint0, endpoint1, candidate, candidate_weights);
+            if (error >= best_error) {
+                break;
+            }
+            best_error = error;
+            std::memcpy(output, candidate, sizeof(candidate));
+            std::memcpy(weights, candidate_weights, sizeof(weights[0]) * 16);
+        }
+    }
+
+    //---------------------------------------//
+    // BC4:  ,    3- 
+
+    //    : a0 > a1 - 8 ,  6   0  255
+    static float encode_bc4_endpoints(const float values[16], const int value0, const int value1, unsigned char* output, float weights[16]) {
+        float palette[8];
+        palette[0] = static_cast<float>(value0);
+        palette[1] = static_cast<float>(value1);
+        float palette_weights[8] = { 0.f, 1.f };
+        if (value0 > value1) {
+            for (int i = 1; i < 7; ++i) {
+                palette[i + 1] = ((7 - i) * palette[0] + i * palette[1]) / 7.f;
+                palette_weights[i + 1] = i / 7.f;
+            }
+        }
+        else {
+            for (int i = 1; i < 5; ++i) {
+                palette[i + 1] = ((5 - i) * palette[0] + i * palette[1]) / 5.f;
+                palette_weights[i + 1] = i / 5.f;
+            }
+            //      ,     
+            palette[6] = 0.f;
+            palette[7] = 255.f;
+            palette_weights[6] = -1.f;
+            palette_weights[7] = -1.f;
+        }
+
+        uint64_t indices = 0;
+        float error = 0.f;
+        for (int i = 0; i < 16; ++i) {
+            int best_index = 0;
+            float best_distance = (values[i] - palette[0]) * (values[i] - palette[0]);
+            for (int index = 1; index < 8; ++index) {
+                const float distance = (values[i] - palette[index]) * (values[i] - palette[index]);
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best_index = index;
+                }
+            }
+            indices |= static_cast<uint64_t>(best_index) << (i * 3);
+            error += best_distance;
+            weights[i] = palette_weights[best_index];
+        }
+
+        output[0] = static_cast<unsigned char>(value0);
+        output[1] = static_cast<unsigned char>(value1);
+        for (int i = 0; i < 6; ++i) {
+            output[2 + i] = static_cast<unsigned char>(indices >> (i * 8));
+        }
+        return error;
+    }
+
+    //   BC4    
+    static void encode_bc4(const ColorBlock& block, const int channel, const ECompressionQuality quality, unsigned char* output) {
+        float values[16];
+        float min_value = 255.f;
+        float max_value = 0.f;
+        for (int i = 0; i < 16; ++i) {
+            values[i] = block.pixels[i][channel];
+            min_value = std::min(min_value, values[i]);
+            max_value = std::max(max_value, values[i]);
+        }
+
+        int value0 = static_cast<int>(max_value + 0.5f);
+        int value1 = static_cast<int>(min_value + 0.5f);
+        if (value0 == value1) {
+            float weights[16];
+            encode_bc4_endpoints(values, value0, value1, output, weights);
+            return;
+        }
+        float weights[16];
+        float best_error = encode_bc4_endpoints(values, value0, value1, output, weights);
+        unsigned char candidate[8];
+        float candidate_weights[16];
+
+        //     
+        for (int iteration = get_refine_iterations(quality); iteration > 0 && best_error > 0.f; --iteration) {
+            float a = 0.f, b = 0.f, c = 0.f, x0 = 0.f, x1 = 0.f;
+            for (int i = 0; i < 16; ++i) {
+                const float t = weights[i];
+                a += (1.f - t) * (1.f - t);
+                b += (1.f - t) * t;
+                c += t * t;
+                x0 += (1.f - t) * values[i];
+                x1 += t * values[i];
+            }
+            const float determinant = a * c - b * b;
+            if (std::fabs(determinant) < 1e-6f) {
+                break;
+            }
+            const int refined0 = static_cast<int>(std::clamp((c * x0 - b * x1) / determinant + 0.5f, 0.f, 255.f));
+            const int refined1 = static_cast<int>(std::clamp((a * x1 - b * x0) / determinant + 0.5f, 0.f, 255.f));
+            if (refined0 <= refined1) {
+                break;
+            }
+            const float error = encode_bc4_endpoints(values, refined0, refined1, candidate, candidate_weights);
+            if (error >= best_error) {
+                break;
+            }
+            best_error = error;
+            std::memcpy(output, candidate, sizeof(candidate));
+            std::memcpy(weights, candidate_weights, sizeof(weights));
+        }
+
+        //  6  ,     0  255     
+        if (quality == ECompressionQuality::High) {
+            float inner_min = 255.f;
+            float inner_max = 0.f;
+            for (const float value : values) {
+                if (value > 0.f && value < 255.f) {
+                    inner_min = std::min(inner_min, value);
+                    inner_max = std::max(inner_max, value);
+                }
+            }
+            if (inner_min <= inner_max) {
+                const float error = encode_bc4_endpoints(values, static_cast<int>(inner_min + 0.5f), static_cast<int>(inner_max + 0.5f),
+                    candidate, candidate_weights);
+                if (error < best_error) {
+                    std::memcpy(output, candidate, sizeof(candidate));
+                }
+            }
+        }
+    }
+
+    //---------------------------------------//
+    // BC7:   6 -   RGBA,  7777  p-, 4- 
+
+    //      
+    class BitWriter {
+    public:
+        explicit BitWriter(unsigned char* output) : m_pOutput(output) {
+            std::memset(m_pOutput, 0, 16);
+        }
+
+        void write(const uint32_t value, const int bits) {
+            for (int i = 0; i < bits; ++i) {
+                if ((value >> i) & 1) {
+                    m_pOutput[m_position >> 3] |= static_cast<unsigned char>(1 << (m_position & 7));
+                }
+                ++m_position;
+            }
+        }
+
+    private:
+        unsigned char* m_pOutput;
+        int m_position = 0;
+    };
+
+    //   BC7  6   . pbits: -1 -    ,   p0 | p1 << 1
+    static float encode_bc7_endpoints(const ColorBlock& block, const float endpoint0[4], const float endpoint1[4], const int pbits,
+        unsigned char* output, float weights[16]) {
+        //  :  = 7  * 2 + p-
+        int quantized[2][4];
+        int pbit[2];
+        const float* endpoints[2] = { endpoint0, endpoint1 };
+        for (int e = 0; e < 2; ++e) {
+            int best_pbit = 0;
+            if (pbits >= 0) {
+                best_pbit = (pbits >> e) & 1;
+            }
+            else {
+                float best_error = 1e30f;
+                for (int p = 0; p < 2; ++p) {
+                    float error = 0.f;
+                    for (int c = 0; c < 4; ++c) {
+                        const int q = std::clamp(static_cast<int>((endpoints[e][c] - p) / 2.f + 0.5f), 0, 127);
+                        const float delta = endpoints[e][c] - static_cast<float>(q * 2 + p);
+                        error += delta * delta;
+                    }
+                    if (error < best_error) {
+                        best_error = error;
+                        best_pbit = p;
+                    }
+                }
+            }
+            pbit[e] = best_pbit;
+            for (int c = 0; c < 4; ++c) {
+                quantized[e][c] = std::clamp(static_cast<int>((endpoints[e][c] - best_pbit) / 2.f + 0.5f), 0, 127);
+            }
+        }
+
+        //   16 
+        float palette[16][4];
+        for (int index = 0; index < 16; ++index) {
+            for (int c = 0; c < 4; ++c) {
+                const int value0 = quantized[0][c] * 2 + pbit[0];
+                const int value1 = quantized[1][c] * 2 + pbit[1];
+                palette[index][c] = static_cast<float>(((64 - s_bc7_weights[index]) * value0 + s_bc7_weights[index] * value1 + 32) >> 6);
+            }
+        }
+
+        int indices[16];
+        float error = 0.f;
+        for (int i = 0; i < 16; ++i) {
+            int best_index = 0;
+            float best_distance = color_distance(block.pixels[i], palette[0], 4);
+            for (int index = 1; index < 16; ++index) {
+                const float distance = color_distance(block.pixels[i], palette[index], 4);
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best_index = index;
+                }
+            }
+            indices[i] = best_index;
+            error += best_distance;
+            weights[i] = s_bc7_weights[best_index] / 64.f;
+        }
+
+        //       :    ,    
+        if (indices[0] & 8) {
+            for (int c = 0; c < 4; ++c) {
+                std::swap(quantized[0][c], quantized[1][c]);
+            }
+            std::swap(pbit[0], pbit[1]);
+            for (int i = 0; i < 16; ++i) {
+                indices[i] = 15 - indices[i];
+            }
+        }
+
+        BitWriter writer(output);
+        writer.write(1 << 6, 7);
+        for (int c = 0; c < 4; ++c) {
+            writer.write(static_cast<uint32_t>(quantized[0][c]), 7);
+            writer.write(static_cast<uint32_t>(quantized[1][c]), 7);
+        }
+        writer.write(static_cast<uint32_t>(pbit[0]), 1);
+        writer.write(static_cast<uint32_t>(pbit[1]), 1);
+        writer.write(static_cast<uint32_t>(indices[0]), 3);
+        for (int i = 1; i < 16; ++i) {
+            writer.write(static_cast<uint32_t>(indices[i]), 4);
+        }
+        return error;
+    }
+
+    //   BC7
+    static void encode_bc7(const ColorBlock& block, const ECompressionQuality quality, unsigned char* output) {
+        float endpoint0[4];
+        float endpoint1[4];
+        find_endpoints(block, 4, quality, endpoint0, endpoint1);
+
+        // High    p-,       
+        const int first_pbits = quality == ECompressionQuality::High ? 0 : -1;
+        const int last_pbits = quality == ECompressionQuality::High ? 3 : -1;
+        float weights[16];
+        float best_error = 1e30f;
+        unsigned char candidate[16];
+        float candidate_weights[16];
+        for (int pbits = first_pbits; pbits <= last_pbits; ++pbits) {
+            const float error = encode_bc7_endpoints(block, endpoint0, endpoint1, pbits, candidate, candidate_weights);
+            if (error < best_error) {
+                best_error = error;
+                std::memcpy(output, candidate, sizeof(candidate));
+                std::memcpy(weights, candidate_weights, sizeof(weights));
+            }
+        }
+
+        for (int iteration = get_refine_iterations(quality); iteration > 0 && best_error > 0.f; --iteration) {
+            if (!refine_endpoints(block, 4, weights, endpoint0, endpoint1)) {
+                break;
+            }
+            bool improved = false;
+            for (int pbits = first_pbits; pbits <= last_pbits; ++pbits) {
+                const float error = encode_bc7_endpoints(block, endpoint0, endpoint1, pbits, candidate, candidate_weights);
+                if (error < best_error) {
+                    best_error = error;
+                    improved = true;
+                    std::memcpy(output, candidate, sizeof(candidate));
+                    std::memcpy(weights, candidate_weights, sizeof(weights));
+                }
+            }
+            if (!improved) {
+                break;
+            }
+        }
+    }
+
+    //---------------------------------------//
+
+    //      
+    static void encode_block(const ColorBlock& block, const ETextureFormat format, const ECompressionQuality quality, unsigned char* output) {
+        switch (format) {
+        case ETextureFormat::BC1:
+            encode_bc1(block, quality, output);
+            break;
+        case ETextureFormat::BC3:
+            encode_bc4(block, 3, quality, output);
+            encode_bc1(block, quality, output + 8);
+            break;
+        case ETextureFormat::BC4:
+            encode_bc4(block, 0, quality, output);
+            break;
+        case ETextureFormat::BC5:
+            encode_bc4(block, 0, quality, output);
+            encode_bc4(block, 1, quality, output + 8);
+            break;
+        case ETextureFormat::BC7:
+            encode_bc7(block, quality, output);
+            break;
+        default:
+            break;
+        }
+    }
+
+    //  
+    bool TextureCompressor::compress(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+        const ETextureFormat format, const ECompressionQuality quality, unsigned char* output) {
+        if ((channels != 3 && channels != 4) || width == 0 || height == 0) {
+            LOG_ERROR("TextureCompressor: unsupported image {0}x{1} with {2} channels", width, height, channels);
+            return false;
+        }
+
+        //   -   
+        if (!is_compressed_format(format)) {
+            const size_t output_channels = get_format_block_size(format);
+            const size_t pixels_count = static_cast<size_t>(width) * height;
+            for (size_t i = 0; i < pixels_count; ++i) {
+                for (size_t c = 0; c < output_channels; ++c) {
+                    output[i * output_channels + c] = c < channels ? pixels[i * channels + c] : 255;
+                }
+            }
+            return true;
+        }
+
+        const unsigned int blocks_x = (width + 3) / 4;
+        const unsigned int blocks_y = (height + 3) / 4;
+        const size_t block_size = get_format_block_size(format);
+        const size_t rows_per_task = std::max<size_t>(1, s_blocks_per_task / blocks_x);
+        parallel_for(blocks_y, rows_per_task, [&](const size_t begin, const size_t end) {
+            ColorBlock block;
+            for (size_t block_y = begin; block_y < end; ++block_y) {
+                unsigned char* row_output = output + block_y * blocks_x * block_size;
+                for (unsigned int block_x = 0; block_x < blocks_x; ++block_x) {
+                    load_block(pixels, width, height, channels, block_x, static_cast<unsigned int>(block_y), block);
+                    encode_block(block, format, quality, row_output + block_x * block_size);
+                }
+            }
+        });
+        return true;
+    }
+
+    //    2x2
+    void TextureCompressor::downsample(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+        std::vector<unsigned char>& output) {
+        const unsigned int output_width = std::max(width / 2, 1u);
+        const unsigned int output_height = std::max(height / 2, 1u);
+        output.resize(static_cast<size_t>(output_width) * output_height * channels);
+        parallel_for(output_height, 64, [&](const size_t begin, const size_t end) {
+            for (size_t y = begin; y < end; ++y) {
+                const size_t y0 = std::min<size_t>(y * 2, height - 1);
+                const size_t y1 = std::min<size_t>(y * 2 + 1, height - 1);
+                for (size_t x = 0; x < output_width; ++x) {
+                    const size_t x0 = std::min<size_t>(x * 2, width - 1);
+                    const size_t x1 = std::min<size_t>(x * 2 + 1, width - 1);
+                    for (size_t c = 0; c < channels; ++c) {
+                        const unsigned int sum = pixels[(y0 * width + x0) * channels + c] + pixels[(y0 * width + x1) * channels + c]
+                            + pixels[(y1 * width + x0) * channels + c] + pixels[(y1 * width + x1) * channels + c];
+                        output[(y * output_width + x) * channels + c] = static_cast<unsigned char>((sum + 2) / 4);
+                    }
+                }
+            }
+        });
+    }
+
+    //      
+    bool TextureCompressor::compress_with_mips(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+        const ETextureFormat format, const ECompressionQuality quality, TextureData& texture_data) {
+        const auto start_time = std::chrono::steady_clock::now();
+        texture_data = TextureData();
+        texture_data.format = format;
+        texture_data.width = width;
+        texture_data.height = height;
+
+        const unsigned int mips_count = std::min(calculate_mips_count(width, height), s_texture_file_max_mips);
+        texture_data.mips.resize(mips_count);
+        std::vector<unsigned char> current;
+        std::vector<unsigned char> next;
+        const unsigned char* level_pixels = pixels;
+        for (unsigned int level = 0; level < mips_count; ++level) {
+            TextureData::Mip& mip = texture_data.mips[level];
+            mip.width = std::max(width >> level, 1u);
+            mip.height = std::max(height >> level, 1u);
+            mip.data.resize(calculate_mip_size(format, mip.width, mip.height));
+            if (!compress(level_pixels, mip.width, mip.height, channels, format, quality, mip.data.data())) {
+                return false;
+            }
+            if (level + 1 < mips_count) {
+                downsample(level_pixels, mip.width, mip.height, channels, next);
+                current.swap(next);
+                level_pixels = current.data();
+            }
+        }
+
+        const size_t compressed_size = calculate_texture_size(format, width, height, mips_count);
+        const size_t uncompressed_size = calculate_texture_size(ETextureFormat::RGBA8, width, height, mips_count);
+        LOG_INFO("TextureCompressor: {0}x{1} {2} in {3:.1f} ms, {4} KB instead of {5} KB RGBA8 ({6:.1f}x smaller)",
+            width, height, get_format_name(format),
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count(),
+            compressed_size / 1024, uncompressed_size / 1024, static_cast<double>(uncompressed_size) / compressed_size);
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "TextureFile.hpp"
+
+namespace MyEngine {
+
+    //  : Fast -      ,
+    // Normal -    (PCA)      , High -     
+    enum class ECompressionQuality {
+        Fast,
+        Normal,
+        High
+    };
+
+    // CPU    BC1/BC3/BC4/BC5/BC7.    
+    class TextureCompressor {
+    public:
+        //   . pixels - RGB8  RGBA8 (channels = 3  4)    ,
+        // output - calculate_mip_size(format, width, height) 
+        static bool compress(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+            const ETextureFormat format, const ECompressionQuality quality, unsigned char* output);
+
+        //    ( 2x2)    
+        static bool compress_with_mips(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+            const ETextureFormat format, const ECompressionQuality quality, TextureData& texture_data);
+
+        //    2     (  )
+        static void downsample(const unsigned char* pixels, const unsigned int width, const unsigned int height, const unsigned int channels,
+            std::vector<unsigned char>& output);
+    };
+
+}
\ No newline at end of file
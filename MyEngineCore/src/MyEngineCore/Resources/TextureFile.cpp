@@ -0,0 +1,143 @@
+#include "TextureFile.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+namespace MyEngine {
+
+    // ,   [offset, offset + size)    ( )
+    static bool is_range_valid(const uint64_t offset, const uint64_t size, const uint64_t file_size) {
+        return offset <= file_size && size <= file_size - offset;
+    }
+
+    //   
+    static uint64_t align_up(const uint64_t value, const uint64_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    //   
+    bool TextureFile::load(const std::string& path) {
+        m_pHeader = nullptr;
+        m_pMips = nullptr;
+        if (!m_file.open(path)) {
+            return false;
+        }
+        if (m_file.get_size() < sizeof(TextureFileHeader)) {
+            LOG_ERROR("TextureFile: '{0}' is too small", path);
+            m_file.close();
+            return false;
+        }
+
+        //            
+        if (!validate()) {
+            LOG_ERROR("TextureFile: '{0}' is corrupted", path);
+            m_file.close();
+            return false;
+        }
+        m_pHeader = reinterpret_cast<const TextureFileHeader*>(m_file.get_data());
+        m_pMips = reinterpret_cast<const TextureMipDesc*>(m_file.get_data() + m_pHeader->mips_offset);
+        return true;
+    }
+
+    //   
+    bool TextureFile::validate() const {
+        const TextureFileHeader& header = *reinterpret_cast<const TextureFileHeader*>(m_file.get_data());
+        const uint64_t file_size = m_file.get_size();
+
+        if (header.magic != s_texture_file_magic) {
+            LOG_ERROR("TextureFile: wrong magic");
+            return false;
+        }
+        if (header.version != s_texture_file_version || header.header_size != sizeof(TextureFileHeader)) {
+            LOG_ERROR("TextureFile: unsupported version {0}", header.version);
+            return false;
+        }
+        if (header.file_size != file_size) {
+            LOG_ERROR("TextureFile: truncated file ({0} of {1} bytes)", file_size, header.file_size);
+            return false;
+        }
+        if (header.format > static_cast<uint32_t>(ETextureFormat::BC7) || header.width == 0 || header.height == 0
+            || header.mips_count == 0 || header.mips_count > std::min(s_texture_file_max_mips, calculate_mips_count(header.width, header.height))) {
+            LOG_ERROR("TextureFile: invalid format or size");
+            return false;
+        }
+        if (header.mips_offset % s_texture_file_alignment != 0
+            || !is_range_valid(header.mips_offset, uint64_t(header.mips_count) * sizeof(TextureMipDesc), file_size)) {
+            LOG_ERROR("TextureFile: mip table is out of range");
+            return false;
+        }
+
+        // :     ,  -   
+        const ETextureFormat format = static_cast<ETextureFormat>(header.format);
+        const TextureMipDesc* pMips = reinterpret_cast<const TextureMipDesc*>(m_file.get_data() + header.mips_offset);
+        for (uint32_t level = 0; level < header.mips_count; ++level) {
+            const TextureMipDesc& mip = pMips[level];
+            if (mip.width != std::max(header.width >> level, 1u) || mip.height != std::max(header.height >> level, 1u)
+                || mip.data_size != calculate_mip_size(format, mip.width, mip.height)
+                || mip.data_offset % s_texture_file_alignment != 0
+                || !is_range_valid(mip.data_offset, mip.data_size, file_size)) {
+                LOG_ERROR("TextureFile: mip {0} is out of range", level);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //   
+    bool TextureFile::write(const std::string& path, const TextureData& texture_data) {
+        if (texture_data.mips.empty() || texture_data.mips.size() > s_texture_file_max_mips) {
+            LOG_ERROR("TextureFile: invalid mips count {0} for '{1}'", texture_data.mips.size(), path);
+            return false;
+        }
+
+        //  
+        TextureFileHeader header{};
+        header.magic = s_texture_file_magic;
+        header.version = s_texture_file_version;
+        header.header_size = sizeof(TextureFileHeader);
+        header.format = static_cast<uint32_t>(texture_data.format);
+        header.width = texture_data.width;
+        header.height = texture_data.height;
+        header.mips_count = static_cast<uint32_t>(texture_data.mips.size());
+        header.mips_offset = align_up(sizeof(TextureFileHeader), s_texture_file_alignment);
+
+        uint64_t offset = align_up(header.mips_offset + header.mips_count * sizeof(TextureMipDesc), s_texture_file_alignment);
+        std::vector<TextureMipDesc> mips(texture_data.mips.size());
+        for (size_t level = 0; level < texture_data.mips.size(); ++level) {
+            const TextureData::Mip& mip = texture_data.mips[level];
+            if (mip.data.size() != calculate_mip_size(texture_data.format, mip.width, mip.height)) {
+                LOG_ERROR("TextureFile: mip {0} has wrong data size", level);
+                return false;
+            }
+            mips[level] = { offset, mip.data.size(), mip.width, mip.height };
+            offset = align_up(offset + mip.data.size(), s_texture_file_alignment);
+        }
+        header.file_size = mips.back().data_offset + mips.back().data_size;
+
+        //        
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("TextureFile: can't create '{0}'", path);
+            return false;
+        }
+        const char zeros[s_texture_file_alignment] = {};
+        auto write_section = [&file, &zeros](const uint64_t section_offset, const void* data, const uint64_t size) {
+            const uint64_t position = static_cast<uint64_t>(file.tellp());
+            file.write(zeros, static_cast<std::streamsize>(section_offset - position));
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        };
+        write_section(0, &header, sizeof(header));
+        write_section(header.mips_offset, mips.data(), mips.size() * sizeof(TextureMipDesc));
+        for (size_t level = 0; level < mips.size(); ++level) {
+            write_section(mips[level].data_offset, texture_data.mips[level].data.data(), mips[level].data_size);
+        }
+
+        if (!file) {
+            LOG_ERROR("TextureFile: failed to write '{0}'", path);
+            return false;
+        }
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "MappedFile.hpp"
+#include "MyEngineCore/Rendering/TextureFormat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MyEngine {
+
+    //    (.tex)      GPU.
+    //    s_texture_file_alignment      
+
+    //  "TEXH",  ,     
+    constexpr uint32_t s_texture_file_magic = 0x48584554;
+    constexpr uint32_t s_texture_file_version = 1;
+    constexpr uint64_t s_texture_file_alignment = 64;
+    constexpr uint32_t s_texture_file_max_mips = 16;
+
+    //  
+    struct TextureFileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t header_size;
+        uint32_t format;
+        uint64_t file_size;
+
+        uint32_t width;
+        uint32_t height;
+        uint32_t mips_count;
+        uint32_t reserved;
+        uint64_t mips_offset;
+    };
+
+    //  
+    struct TextureMipDesc {
+        uint64_t data_offset;
+        uint64_t data_size;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    static_assert(sizeof(TextureFileHeader) == 48, "TextureFileHeader layout changed");
+    static_assert(sizeof(TextureMipDesc) == 24, "TextureMipDesc layout changed");
+
+    //    ( TextureCompressor)
+    struct TextureData {
+        //  
+        struct Mip {
+            unsigned int width = 0;
+            unsigned int height = 0;
+            std::vector<unsigned char> data;
+        };
+
+        ETextureFormat format = ETextureFormat::RGBA8;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<Mip> mips;
+    };
+
+    // ,    .    -     
+    class TextureFile {
+    public:
+        //    
+        bool load(const std::string& path);
+        //  
+        static bool write(const std::string& path, const TextureData& texture_data);
+
+        const TextureFileHeader& get_header() const { return *m_pHeader; }
+        ETextureFormat get_format() const { return static_cast<ETextureFormat>(m_pHeader->format); }
+        const TextureMipDesc& get_mip(const size_t level) const { return m_pMips[level]; }
+        const unsigned char* get_mip_data(const size_t level) const { return m_file.get_data() + m_pMips[level].data_offset; }
+
+        bool is_loaded() const { return m_pHeader != nullptr; }
+
+    private:
+        //      (   m_pHeader  m_pMips)
+        bool validate() const;
+
+        MappedFile m_file;
+        const TextureFileHeader* m_pHeader = nullptr;
+        const TextureMipDesc* m_pMips = nullptr;
+    };
+
+}
\ No newline at end of file
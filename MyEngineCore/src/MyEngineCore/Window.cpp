@@ -5,19 +5,32 @@
 #include "MyEngineCore/Modules/UIModule.hpp"
 
 #include "MyEngineCore/Rendering/OpenGL/Render_OpenGL.hpp"
+#include "MyEngineCore/Rendering/OpenGL/LatencyTracker.hpp"
 #include <GLFW/glfw3.h>
 
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
 
-#include <imgui/backends/imgui_impl_glfw.h>
-
 namespace MyEngine {   
 
+    //    ();   -    wake_event_loop
+    constexpr double s_event_wait_timeout = 0.1;
+
+    //         (   GLFW   )
+    template<typename T>
+    void Window::push_event(GLFWwindow* pWindow, const T& event) {
+        WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
+        if (!data.events.push(Event(event, get_event_timestamp()))) {
+            if (data.dropped_events.fetch_add(1, std::memory_order_relaxed) == 0) {
+                LOG_WARN("Window event queue is full ({0} events), new events are dropped", s_events_queue_size);
+            }
+        }
+    }
+
     //     
 	Window::Window(std::string title, const unsigned int width, const unsigned int height)
-        : m_data({ std::move(title), width, height }) {
-		int resultCode = init();
+        : m_data{ std::move(title), width, height } {
+		m_bCreated = init() == 0;
 	}
 
     //     
@@ -29,7 +42,7 @@ namespace MyEngine {
     int Window::init() {
 
         //     : ,   
-        LOG_INFO("Creating window '{0}' width size {1}x{2}!", m_data.title, m_data.width, m_data.height);
+        LOG_INFO("Creating window '{0}' width size {1}x{2}!", m_data.title, get_width(), get_height());
 
         //   - 
 
@@ -49,9 +62,9 @@ namespace MyEngine {
         glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
 
         //   
-        m_pWindow = glfwCreateWindow(m_data.width, m_data.height, m_data.title.c_str(), nullptr, nullptr);
+        m_pWindow = glfwCreateWindow(get_width(), get_height(), m_data.title.c_str(), nullptr, nullptr);
         if (!m_pWindow){
-            LOG_CRITICAL("Can't create window {0} width size {1}x{2}!", m_data.title, m_data.width, m_data.height);
+            LOG_CRITICAL("Can't create window {0} width size {1}x{2}!", m_data.title, get_width(), get_height());
             return -2;
         }
 
@@ -64,26 +77,26 @@ namespace MyEngine {
 
         //     
         glfwSetWindowUserPointer(m_pWindow, &m_data);
+        int framebuffer_width = 0;
+        int framebuffer_height = 0;
+        glfwGetFramebufferSize(m_pWindow, &framebuffer_width, &framebuffer_height);
+        m_data.framebuffer_width.store(framebuffer_width, std::memory_order_relaxed);
+        m_data.framebuffer_height.store(framebuffer_height, std::memory_order_relaxed);
 
         //    
         glfwSetKeyCallback(m_pWindow, [](GLFWwindow* pWindow, int key, int scancode, int action, int mods) {
-                // 
-                WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
                 //   (,    )
                 switch (action) {
                 case GLFW_PRESS: {
-                    EventKeyPressed event(static_cast<KeyCode>(key), false);
-                    data.eventCallbackFn(event);
+                    push_event(pWindow, EventKeyPressed(static_cast<KeyCode>(key), false, mods));
                     break;
                 }
                 case GLFW_RELEASE: {
-                    EventKeyReleased event(static_cast<KeyCode>(key));
-                    data.eventCallbackFn(event);
+                    push_event(pWindow, EventKeyReleased(static_cast<KeyCode>(key), mods));
                     break;
                 }
                 case GLFW_REPEAT: {
-                    EventKeyPressed event(static_cast<KeyCode>(key), true);
-                    data.eventCallbackFn(event);
+                    push_event(pWindow, EventKeyPressed(static_cast<KeyCode>(key), true, mods));
                     break;
                 }
                 }
@@ -91,21 +104,18 @@ namespace MyEngine {
 
         //  
         glfwSetMouseButtonCallback(m_pWindow, [](GLFWwindow* pWindow, int button, int action, int mods){
-                // ,    
-                WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
+                //    
                 double x_pos;
                 double y_pos;
                 glfwGetCursorPos(pWindow, &x_pos, &y_pos);
                 //   (  )
                 switch (action){
                 case GLFW_PRESS: {
-                    EventMouseButtonPressed event(static_cast<MouseButton>(button), x_pos, y_pos);
-                    data.eventCallbackFn(event);
+                    push_event(pWindow, EventMouseButtonPressed(static_cast<MouseButton>(button), x_pos, y_pos, mods));
                     break;
                 }
                 case GLFW_RELEASE: {
-                    EventMouseButtonReleased event(static_cast<MouseButton>(button), x_pos, y_pos);
-                    data.eventCallbackFn(event);
+                    push_event(pWindow, EventMouseButtonReleased(static_cast<MouseButton>(button), x_pos, y_pos, mods));
                     break;
                 }
                 }
@@ -115,33 +125,49 @@ namespace MyEngine {
         //   
         glfwSetWindowSizeCallback(m_pWindow, [](GLFWwindow* pWindow, int width, int height) {
             WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
-            data.width = width;
-            data.height = height;
+            data.width.store(width, std::memory_order_relaxed);
+            data.height.store(height, std::memory_order_relaxed);
 
-            EventWindowResize event(width, height);
-            data.eventCallbackFn(event);
+            push_event(pWindow, EventWindowResize(width, height));
         });
 
         //   
         glfwSetCursorPosCallback(m_pWindow, [](GLFWwindow* pWindow, double x, double y) {
-            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
+            push_event(pWindow, EventMouseMoved(x, y));
+            });
+
+        //        
+        glfwSetCursorEnterCallback(m_pWindow, [](GLFWwindow* pWindow, int entered) {
+            push_event(pWindow, EventCursorEnter(entered == GLFW_TRUE));
+            });
+
+        //    
+        glfwSetWindowFocusCallback(m_pWindow, [](GLFWwindow* pWindow, int focused) {
+            push_event(pWindow, EventWindowFocus(focused == GLFW_TRUE));
+            });
 
-            EventMouseMoved event(x, y);
-            data.eventCallbackFn(event);
+        //   
+        glfwSetScrollCallback(m_pWindow, [](GLFWwindow* pWindow, double x_offset, double y_offset) {
+            push_event(pWindow, EventMouseScrolled(x_offset, y_offset));
+            });
+
+        //  
+        glfwSetCharCallback(m_pWindow, [](GLFWwindow* pWindow, unsigned int codepoint) {
+            push_event(pWindow, EventCharTyped(codepoint));
             });
 
         //  
         glfwSetWindowCloseCallback(m_pWindow, [](GLFWwindow* pWindow) {
-            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
-
-            EventWindowClose event;
-            data.eventCallbackFn(event);
+            push_event(pWindow, EventWindowClose());
         });
 
-        //      
+        //      (    OpenGL)
         glfwSetFramebufferSizeCallback(m_pWindow,
             [](GLFWwindow* pWindow, int width, int height){
-                Render_OpenGL::set_viewport(width, height);
+                WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(pWindow));
+                data.framebuffer_width.store(width, std::memory_order_relaxed);
+                data.framebuffer_height.store(height, std::memory_order_relaxed);
+                push_event(pWindow, EventFramebufferResize(width, height));
             });
 
         //   
@@ -152,24 +178,42 @@ namespace MyEngine {
 
     //    
     void Window::shutdown() {
-        //   
-        UIModule::on_window_close();
-        glfwDestroyWindow(m_pWindow);
+        //    (    OpenGL,     )
+        //     init,        
+        if (m_bCreated) {
+            glfwMakeContextCurrent(m_pWindow);
+            UIModule::on_window_close();
+        }
+        if (m_pWindow) {
+            glfwDestroyWindow(m_pWindow);
+        }
         glfwTerminate();
     }
 
     //    
     void Window::on_update() {
         glfwSwapBuffers(m_pWindow);
-        glfwPollEvents();
+        LatencyTracker::on_frame_presented();
+    }
+
+    //    :    glfwWaitEventsTimeout.
+    //      (  Windows)    
+    void Window::run_event_loop(const std::atomic<bool>& stop) {
+        while (!stop.load(std::memory_order_acquire)) {
+            glfwWaitEventsTimeout(s_event_wait_timeout);
+        }
+    }
+
+    void Window::wake_event_loop() {
+        glfwPostEmptyEvent();
+    }
+
+    bool Window::pop_event(Event& event) {
+        return m_data.events.pop(event);
     }
 
-    //     
-    glm::vec2 Window::get_current_cursor_position() const {
-        double x_pos;
-        double y_pos;
-        glfwGetCursorPos(m_pWindow, &x_pos, &y_pos);
-        return { x_pos, y_pos };
+    void Window::make_context_current(const bool current) {
+        glfwMakeContextCurrent(current ? m_pWindow : nullptr);
     }
 
 }
\ No newline at end of file
@@ -1,21 +1,23 @@
 //       
 #pragma once
 
-#include <MyEngineCore/Event.hpp>
 #include "MyEngineCore/Event.hpp"
+#include "MyEngineCore/Core/SpscQueue.hpp"
 
-#include <functional>
+#include <atomic>
 #include <string>
-#include <glm/ext/vector_float2.hpp>
 
 struct GLFWwindow;
 
 namespace MyEngine {
 
-	//    
+	//    .         (  GLFW),
+	//     :          ,
+	//   vsync        
 	class Window {
 	public:
-		using EventCallbackFn = std::function<void(BaseEvent&)>;
+		//    
+		static constexpr size_t s_events_queue_size = 4096;
 
 		//   
 		Window(std::string title, const unsigned int width, const unsigned int height);
@@ -27,32 +29,52 @@ namespace MyEngine {
 		Window& operator = (const Window&) = delete;
 		Window& operator = (Window&&) = delete;
 
-		// ,         .   
-		void on_update();
-		unsigned int get_width() const { return m_data.width; };
-		unsigned int get_height() const { return m_data.height; };
-		glm::vec2 get_current_cursor_position() const;
+		//     ,    stop (  ,   )
+		void run_event_loop(const std::atomic<bool>& stop);
+		//      
+		void wake_event_loop();
+		//     . false -  
+		bool pop_event(Event& event);
+		//  ,  -  
+		size_t get_dropped_events_count() const { return m_data.dropped_events.load(std::memory_order_relaxed); }
+
+		// ,  OpenGL    (   ,     )
+		bool is_created() const { return m_bCreated; }
 
-		void set_event_callback(const EventCallbackFn& callback) {
-			m_data.eventCallbackFn = callback;
-		}
+		//  OpenGL     ( ,  current = false)
+		void make_context_current(const bool current);
+
+		// ,        ( )
+		void on_update();
+		unsigned int get_width() const { return m_data.width.load(std::memory_order_relaxed); };
+		unsigned int get_height() const { return m_data.height.load(std::memory_order_relaxed); };
+		//      (  ,   )
+		unsigned int get_framebuffer_width() const { return m_data.framebuffer_width.load(std::memory_order_relaxed); };
+		unsigned int get_framebuffer_height() const { return m_data.framebuffer_height.load(std::memory_order_relaxed); };
 
 	private:
-		//    : , ,    
+		//    : , , ,      
 		struct WindowData {
 			std::string title;
-			unsigned int width;
-			unsigned int height;
-			EventCallbackFn eventCallbackFn;
+			std::atomic<unsigned int> width;
+			std::atomic<unsigned int> height;
+			std::atomic<unsigned int> framebuffer_width{ 0 };
+			std::atomic<unsigned int> framebuffer_height{ 0 };
+			SpscQueue<Event, s_events_queue_size> events;
+			std::atomic<size_t> dropped_events{ 0 };
 		};
 
 		//    
 		int init();
 		void shutdown();
+		//     GLFW
+		template<typename T>
+		static void push_event(GLFWwindow* pWindow, const T& event);
 
 		//      
 		GLFWwindow* m_pWindow = nullptr;
 		WindowData m_data;
+		bool m_bCreated = false;
 	};
 
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <memory>
+#include <string>
 
 #include <MyEngineCore/Input.hpp>
 #include "MyEngineCore/Application.hpp"
@@ -152,6 +153,33 @@ class MyEngineEditor : public MyEngine::Application {
         ImGui::SliderFloat3("light source position", light_source_position, -10.f, 10.f);
         ImGui::ColorEdit3("light source color", light_source_color);
 
+        ImGui::SliderInt("point lights", &point_lights_count, 0, 4095);
+        //  :     RenderPath
+        int render_path_index = static_cast<int>(render_path);
+        if (ImGui::Combo("render path", &render_path_index, "Forward\0Deferred\0Software\0")) {
+            render_path = static_cast<MyEngine::Application::RenderPath>(render_path_index);
+        }
+        ImGui::SliderInt("software threads", &software_threads_count, 0, 64);
+        ImGui::Checkbox("Depth pre-pass", &depth_prepass);
+        ImGui::Checkbox("Overdraw view", &overdraw_visualization);
+
+        //    
+        ImGui::SliderFloat3("sun direction", sun_direction, -1.f, 1.f);
+        ImGui::ColorEdit3("sun color", sun_color);
+        ImGui::SliderFloat("sun intensity", &sun_intensity, 0.f, 2.f);
+        ImGui::Checkbox("Shadows", &shadows_enabled);
+        ImGui::SliderInt("shadow updates per frame", &shadow_updates_per_frame, 0, 52);
+
+        //  
+        ImGui::Checkbox("Dynamic resolution", &dynamic_resolution);
+        ImGui::SliderFloat("scene GPU target, ms", &dynamic_resolution_target_ms, 1.f, 33.f);
+        ImGui::SliderFloat("min resolution scale", &dynamic_resolution_min_scale, 0.25f, 1.f);
+        ImGui::SliderFloat("upscale sharpness", &upscale_sharpness, 0.f, 1.f);
+
+        //      GPU
+        ImGui::SliderInt("GPU culled instances", &gpu_culled_instances_count, 0, 1000000);
+        ImGui::Checkbox("Occlusion culling", &gpu_occlusion_culling);
+
         ImGui::SliderFloat("ambient factor", &ambient_factor, 0.f, 1.f);
         ImGui::SliderFloat("diffuse factor", &diffuse_factor, 0.f, 1.f);
         ImGui::SliderFloat("specular factor", &specular_factor, 0.f, 1.f);
@@ -181,11 +209,16 @@ class MyEngineEditor : public MyEngine::Application {
 	int frame = 0;
 };
 
-int main() {
+int main(int argc, char** argv) {
 	
 	//  
 	auto p_MyEngineEditor = make_unique<MyEngineEditor>();
 
+	//   GPU: "--software-output <.tga>"        OpenGL
+	if (argc == 3 && string(argv[1]) == "--software-output") {
+		return p_MyEngineEditor->render_software(1024, 1024, argv[2]);
+	}
+
 	//   
 	int returnCode = p_MyEngineEditor ->start(1024, 1024, "My Engine Editor");
 
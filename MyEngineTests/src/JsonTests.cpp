@@ -0,0 +1,53 @@
+#include "Tests.hpp"
+
+#include "MyEngineCore/Resources/Json.hpp"
+
+#include <clocale>
+#include <cstring>
+#include <string>
+
+using MyEngine::JsonValue;
+
+static bool parse_json(const char* text, JsonValue& value) {
+    std::string error;
+    return JsonValue::parse(text, std::strlen(text), value, error);
+}
+
+//    
+TEST_CASE(json_parse_values) {
+    JsonValue value;
+    CHECK(parse_json("{ \"a\": [1, -2.5, 3e2], \"b\": true, \"c\": \"text\", \"d\": null }", value));
+    CHECK(value.is_object());
+    const JsonValue* pArray = value.find("a");
+    CHECK(pArray && pArray->is_array() && pArray->size() == 3);
+    if (pArray && pArray->size() == 3) {
+        CHECK((*pArray)[0].as_number() == 1.0);
+        CHECK((*pArray)[1].as_number() == -2.5);
+        CHECK((*pArray)[2].as_number() == 300.0);
+    }
+    CHECK(value.find("b") && value.find("b")->as_bool());
+    CHECK(value.find("c") && value.find("c")->as_string() == "text");
+    CHECK(value.find("d") && value.find("d")->is_null());
+}
+
+//      double  
+TEST_CASE(json_parse_invalid_numbers) {
+    JsonValue value;
+    CHECK(!parse_json("1.2.3", value));
+    CHECK(!parse_json("--1", value));
+    CHECK(!parse_json("1e", value));
+    CHECK(!parse_json("1e999", value));
+}
+
+//     :    "1.5"   
+TEST_CASE(json_parse_number_ignores_locale) {
+    const std::string previous_locale = std::setlocale(LC_NUMERIC, nullptr);
+    const bool comma_locale = std::setlocale(LC_NUMERIC, "de_DE.UTF-8") || std::setlocale(LC_NUMERIC, "ru_RU.UTF-8")
+        || std::setlocale(LC_NUMERIC, "German") || std::setlocale(LC_NUMERIC, "Russian");
+    JsonValue value;
+    CHECK(parse_json("[1.5, 0.25]", value));
+    CHECK(value.size() == 2 && value[0].as_number() == 1.5 && value[1].as_number() == 0.25);
+    if (comma_locale) {
+        std::setlocale(LC_NUMERIC, previous_locale.c_str());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "Tests.hpp"
+
+#include "MyEngineCore/Log.hpp"
+
+#include <thread>
+#include <vector>
+
+using MyEngine::Log;
+
+// Critical     , Off   
+TEST_CASE(log_critical_is_always_enabled) {
+    CHECK(MyEngine::is_log_enabled(MyEngine::ELogCategory::Core, MyEngine::ELogLevel::Critical));
+    CHECK(MyEngine::is_log_enabled(MyEngine::ELogCategory::Render, MyEngine::ELogLevel::Critical));
+    CHECK(!MyEngine::is_log_enabled(MyEngine::ELogCategory::Core, MyEngine::ELogLevel::Off));
+}
+
+//        flush,      
+TEST_CASE(log_flush_writes_queued_messages) {
+    if (!MyEngine::is_log_enabled(MyEngine::ELogCategory::Core, MyEngine::ELogLevel::Error)) {
+        return;
+    }
+    const Log::Stats before = Log::get_stats();
+    constexpr int threads_count = 4;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread) {
+        threads.emplace_back([thread]() {
+            for (int i = 0; i < 2; ++i) {
+                LOG_ERROR("log test: thread {0}, message {1}", thread, i);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    Log::flush();
+    const Log::Stats after = Log::get_stats();
+    CHECK(after.written_count - before.written_count == threads_count * 2);
+    CHECK(after.dropped_count == before.dropped_count);
+}
+
+// flush      ,     
+TEST_CASE(log_flush_after_shutdown) {
+    Log::shutdown();
+    Log::flush();
+    if (!MyEngine::is_log_enabled(MyEngine::ELogCategory::Core, MyEngine::ELogLevel::Error)) {
+        return;
+    }
+    const size_t written_count = Log::get_stats().written_count;
+    LOG_ERROR("log test: after shutdown");
+    Log::flush();
+    CHECK(Log::get_stats().written_count == written_count + 1);
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "Tests.hpp"
+
+#include "MyEngineCore/Resources/MeshFile.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace MyEngine;
+
+// :    ,      
+static MeshData create_triangle_mesh_data() {
+    const float vertices[] = {
+        0.f, 0.f, 0.f,  0.f, 0.f,
+        1.f, 0.f, 0.f,  1.f, 0.f,
+        0.f, 2.f, 0.f,  0.f, 1.f
+    };
+    MeshData mesh_data;
+    mesh_data.streams.resize(1);
+    mesh_data.streams[0].elements = { ShaderDataType::Float3, ShaderDataType::Float2 };
+    mesh_data.streams[0].data.resize(sizeof(vertices));
+    std::memcpy(mesh_data.streams[0].data.data(), vertices, sizeof(vertices));
+    mesh_data.vertices_count = 3;
+    mesh_data.indices = { 0, 1, 2 };
+    mesh_data.submeshes.push_back({ 0, 3, 0, 0, {} });
+    mesh_data.lods.push_back({ 0, 1, 0.f, 0 });
+    mesh_data.bounds = MeshFile::calculate_bounds(vertices, 3, 5);
+    return mesh_data;
+}
+
+//      ,  
+TEST_CASE(mesh_file_round_trip) {
+    const std::string path = "mesh_file_round_trip.mesh";
+    const MeshData mesh_data = create_triangle_mesh_data();
+    CHECK(MeshFile::write(path, mesh_data));
+    {
+        MeshFile mesh_file;
+        CHECK(mesh_file.load(path, true));
+        if (mesh_file.is_loaded()) {
+            const MeshFileHeader& header = mesh_file.get_header();
+            CHECK(header.vertices_count == 3 && header.indices_count == 3);
+            CHECK(header.streams_count == 1 && header.submeshes_count == 1 && header.lods_count == 1);
+            CHECK(header.bounds.max[1] == 2.f && header.bounds.radius > 0.f);
+            const MeshStreamDesc& stream = mesh_file.get_stream(0);
+            CHECK(stream.stride == 20 && stream.elements_count == 2);
+            CHECK(stream.data_offset % s_mesh_file_alignment == 0 && header.index_data_offset % s_mesh_file_alignment == 0);
+            CHECK(std::memcmp(mesh_file.get_stream_data(0), mesh_data.streams[0].data.data(), mesh_data.streams[0].data.size()) == 0);
+            CHECK(std::memcmp(mesh_file.get_indices(), mesh_data.indices.data(), sizeof(uint32_t) * 3) == 0);
+            CHECK(mesh_file.get_submeshes()[0].indices_count == 3 && mesh_file.get_lods()[0].submeshes_count == 1);
+        }
+    }
+    std::remove(path.c_str());
+}
+
+//       :   
+TEST_CASE(mesh_file_write_rejects_stream_size_mismatch) {
+    const std::string path = "mesh_file_mismatch.mesh";
+    MeshData mesh_data = create_triangle_mesh_data();
+    mesh_data.vertices_count = 4;
+    CHECK(!MeshFile::write(path, mesh_data));
+    mesh_data.vertices_count = 3;
+    mesh_data.streams[0].data.pop_back();
+    CHECK(!MeshFile::write(path, mesh_data));
+    std::FILE* pFile = std::fopen(path.c_str(), "rb");
+    CHECK(pFile == nullptr);
+    if (pFile) {
+        std::fclose(pFile);
+        std::remove(path.c_str());
+    }
+}
+
+//    
+TEST_CASE(mesh_file_rejects_truncated_file) {
+    const std::string path = "mesh_file_truncated.mesh";
+    CHECK(MeshFile::write(path, create_triangle_mesh_data()));
+    std::string data;
+    if (std::FILE* pFile = std::fopen(path.c_str(), "rb")) {
+        char buffer[4096];
+        size_t read_size = 0;
+        while ((read_size = std::fread(buffer, 1, sizeof(buffer), pFile)) > 0) {
+            data.append(buffer, read_size);
+        }
+        std::fclose(pFile);
+    }
+    CHECK(data.size() > sizeof(MeshFileHeader));
+    if (std::FILE* pFile = std::fopen(path.c_str(), "wb")) {
+        std::fwrite(data.data(), 1, data.size() - 4, pFile);
+        std::fclose(pFile);
+    }
+    MeshFile mesh_file;
+    CHECK(!mesh_file.load(path));
+    CHECK(!mesh_file.is_loaded());
+    std::remove(path.c_str());
+}
\ No newline at end of file
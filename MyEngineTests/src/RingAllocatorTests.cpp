@@ -0,0 +1,95 @@
+#include "Tests.hpp"
+
+#include "MyEngineCore/Core/RingAllocator.hpp"
+
+using MyEngine::RingAllocator;
+
+//    ,    
+TEST_CASE(ring_allocator_sequential) {
+    RingAllocator ring(1024, 64);
+    size_t offset = 0;
+    size_t allocated_size = 0;
+    CHECK(ring.allocate(100, offset, allocated_size));
+    CHECK(offset == 0 && allocated_size == 128);
+    CHECK(ring.allocate(64, offset, allocated_size));
+    CHECK(offset == 128 && allocated_size == 64);
+    CHECK(ring.get_used() == 192);
+    ring.release(128);
+    ring.release(64);
+    CHECK(ring.get_used() == 0);
+    CHECK(ring.allocate(64, offset, allocated_size));
+    CHECK(offset == 0);
+}
+
+//     :    ,    offset == size
+TEST_CASE(ring_allocator_exact_fit) {
+    RingAllocator ring(1024, 64);
+    size_t offset = 0;
+    size_t first_size = 0;
+    size_t second_size = 0;
+    CHECK(ring.allocate(256, offset, first_size));
+    CHECK(ring.allocate(768, offset, second_size));
+    CHECK(offset == 256 && offset + second_size == 1024);
+    CHECK(!ring.allocate(64, offset, first_size));
+
+    ring.release(256);
+    size_t third_size = 0;
+    CHECK(ring.allocate(256, offset, third_size));
+    CHECK(offset == 0 && third_size == 256);
+    CHECK(offset + third_size <= ring.get_size());
+}
+
+//     :       
+TEST_CASE(ring_allocator_wrap) {
+    RingAllocator ring(1024, 64);
+    size_t offset = 0;
+    size_t first_size = 0;
+    size_t second_size = 0;
+    CHECK(ring.allocate(512, offset, first_size));
+    CHECK(ring.allocate(320, offset, second_size));
+    CHECK(offset == 512);
+    //  [0, 832): 384       
+    size_t wrapped_size = 0;
+    CHECK(!ring.allocate(384, offset, wrapped_size));
+    ring.release(first_size);
+    CHECK(ring.allocate(384, offset, wrapped_size));
+    CHECK(offset == 0 && wrapped_size == 192 + 384);
+    CHECK(ring.get_used() == second_size + wrapped_size);
+    ring.release(second_size);
+    ring.release(wrapped_size);
+    CHECK(ring.get_used() == 0);
+}
+
+//    :           
+TEST_CASE(ring_allocator_stress) {
+    RingAllocator ring(32 * 1024 * 1024, 64);
+    struct Region {
+        size_t offset;
+        size_t size;
+        size_t allocated_size;
+    };
+    std::vector<Region> regions;
+    size_t first = 0;
+    unsigned int random = 12345;
+    for (int i = 0; i < 20000; ++i) {
+        random = random * 1103515245u + 12345u;
+        const size_t size = 4 * 1024 * 1024 >> (random >> 28 & 7);
+        Region region{ 0, size, 0 };
+        while (!ring.allocate(size, region.offset, region.allocated_size)) {
+            CHECK(first < regions.size());
+            if (first >= regions.size()) {
+                return;
+            }
+            ring.release(regions[first++].allocated_size);
+        }
+        CHECK(region.offset + size <= ring.get_size());
+        for (size_t j = first; j < regions.size(); ++j) {
+            const Region& other = regions[j];
+            CHECK(region.offset + size <= other.offset || other.offset + other.size <= region.offset);
+        }
+        regions.push_back(region);
+        if (regions.size() - first > 64) {
+            ring.release(regions[first++].allocated_size);
+        }
+    }
+}
\ No newline at end of file
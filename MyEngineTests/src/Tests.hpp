@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+//      :  - ,   ,
+// CHECK        ,    
+#define TEST_CASE(name) \
+    static void name(); \
+    static ::MyEngineTests::TestRegistrar s_##name##_registrar(#name, &name); \
+    static void name()
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            ::MyEngineTests::on_check_failed(__FILE__, __LINE__, #condition); \
+        } \
+    } while (false)
+
+namespace MyEngineTests {
+
+    using TestFunction = void (*)();
+
+    struct TestCase {
+        const char* name;
+        TestFunction function;
+    };
+
+    std::vector<TestCase>& get_tests();
+    //       
+    void on_check_failed(const char* file, const int line, const char* condition);
+
+    struct TestRegistrar {
+        TestRegistrar(const char* name, const TestFunction function) {
+            get_tests().push_back({ name, function });
+        }
+    };
+
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+//   :   -    (0 -  )
+
+#include "Tests.hpp"
+
+namespace MyEngineTests {
+
+    static int s_failed_checks_count = 0;
+
+    std::vector<TestCase>& get_tests() {
+        static std::vector<TestCase> tests;
+        return tests;
+    }
+
+    void on_check_failed(const char* file, const int line, const char* condition) {
+        std::printf("%s:%d: check failed: %s\n", file, line, condition);
+        ++s_failed_checks_count;
+    }
+
+}
+
+int main() {
+    int failed_tests_count = 0;
+    for (const MyEngineTests::TestCase& test : MyEngineTests::get_tests()) {
+        const int failed_checks_before = MyEngineTests::s_failed_checks_count;
+        test.function();
+        const bool passed = MyEngineTests::s_failed_checks_count == failed_checks_before;
+        std::printf("[%s] %s\n", passed ? "PASSED" : "FAILED", test.name);
+        failed_tests_count += passed ? 0 : 1;
+    }
+    std::printf("%zu tests, %d failed\n", MyEngineTests::get_tests().size(), failed_tests_count);
+    return failed_tests_count;
+}
\ No newline at end of file